@@ -52,6 +52,7 @@ struct EventListener : public AnimationStateListenerObject {
 
 typedef struct _spine_atlas {
 	void *atlas;
+	void *textureLoader;
 	utf8 **imagePaths;
 	int32_t numImagePaths;
 	utf8 *error;
@@ -227,15 +228,16 @@ public:
 	}
 };
 
-CallbackTextureLoad callbackLoader;
-
 spine_atlas spine_atlas_load_callback(const utf8 *atlasData, const utf8 *atlasDir, spine_texture_loader_load_func load, spine_texture_loader_unload_func unload) {
 	if (!atlasData) return nullptr;
 	int32_t length = (int32_t) strlen(atlasData);
-	callbackLoader.setCallbacks(load, unload);
-	auto atlas = new (__FILE__, __LINE__) Atlas(atlasData, length, (const char *) atlasDir, &callbackLoader, true);
+	// Each atlas gets its own loader, so atlases can be loaded from several threads with different callbacks.
+	auto loader = new (__FILE__, __LINE__) CallbackTextureLoad();
+	loader->setCallbacks(load, unload);
+	auto atlas = new (__FILE__, __LINE__) Atlas(atlasData, length, (const char *) atlasDir, loader, true);
 	_spine_atlas *result = SpineExtension::calloc<_spine_atlas>(1, __FILE__, __LINE__);
 	result->atlas = atlas;
+	result->textureLoader = loader;
 	result->numImagePaths = (int32_t) atlas->getPages().size();
 	result->imagePaths = SpineExtension::calloc<utf8 *>(result->numImagePaths, __FILE__, __LINE__);
 	for (int i = 0; i < result->numImagePaths; i++) {
@@ -273,6 +275,7 @@ void spine_atlas_dispose(spine_atlas atlas) {
 	if (!atlas) return;
 	_spine_atlas *_atlas = (_spine_atlas *) atlas;
 	if (_atlas->atlas) delete (Atlas *) _atlas->atlas;
+	if (_atlas->textureLoader) delete (CallbackTextureLoad *) _atlas->textureLoader;
 	if (_atlas->error) free(_atlas->error);
 	for (int i = 0; i < _atlas->numImagePaths; i++) {
 		free(_atlas->imagePaths[i]);
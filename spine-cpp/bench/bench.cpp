@@ -0,0 +1,361 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Times runtime hot paths against the paths they replace. The skeletons are built in code so the benchmarks need no
+// exported files. Pass a benchmark name to run only that benchmark.
+
+#include <spine/spine.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+namespace {
+	typedef std::chrono::steady_clock Clock;
+
+	template<typename Body>
+	void measure(const char *name, int count, Body body) {
+		body();
+		Clock::time_point start = Clock::now();
+		for (int i = 0; i < count; i++) body();
+		double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+		printf("  %-52s %12.1f ns\n", name, ns);
+	}
+
+	/// Creates a root bone with chainCount chains of chainLength bones, each bone with a slot. With constraints, the first
+	/// two bones of each chain get an IK constraint and the last bone a transform constraint, both targeting a bone
+	/// parented to the root.
+	SkeletonData *createSkeletonData(int chainCount, int chainLength, bool constraints) {
+		SkeletonData *data = new SkeletonData();
+		Vector<BoneData *> &bones = data->getBones();
+		Vector<SlotData *> &slots = data->getSlots();
+		char name[32];
+		BoneData *root = new BoneData(0, "root");
+		bones.add(root);
+		for (int c = 0; c < chainCount; c++) {
+			BoneData *parent = root;
+			for (int i = 0; i < chainLength; i++) {
+				snprintf(name, sizeof(name), "chain%d-%d", c, i);
+				BoneData *bone = new BoneData((int) bones.size(), name, parent);
+				bone->setX(10);
+				bone->setRotation(5);
+				bone->setLength(10);
+				bones.add(bone);
+				slots.add(new SlotData((int) slots.size(), name, *bone));
+				parent = bone;
+			}
+			if (!constraints || chainLength < 3) continue;
+			snprintf(name, sizeof(name), "target%d", c);
+			BoneData *target = new BoneData((int) bones.size(), name, root);
+			target->setX(20.0f * chainLength);
+			target->setY(10.0f * c);
+			bones.add(target);
+
+			snprintf(name, sizeof(name), "ik%d", c);
+			IkConstraintData *ik = new IkConstraintData(name);
+			ik->setOrder(data->getIkConstraints().size() + data->getTransformConstraints().size());
+			ik->getBones().add(bones[bones.size() - 1 - chainLength]);
+			ik->getBones().add(bones[bones.size() - chainLength]);
+			ik->setTarget(target);
+			ik->setMix(1);
+			data->getIkConstraints().add(ik);
+
+			snprintf(name, sizeof(name), "transform%d", c);
+			TransformConstraintData *transform = new TransformConstraintData(name);
+			transform->setOrder(data->getIkConstraints().size() + data->getTransformConstraints().size());
+			transform->getBones().add(bones[bones.size() - 2]);
+			transform->setTarget(target);
+			transform->setMixRotate(0.5f);
+			data->getTransformConstraints().add(transform);
+		}
+		data->buildIndices();
+		return data;
+	}
+
+	/// Keys the rotation of boneCount bones, starting after the root, with frameCount linear frames over duration seconds.
+	Animation *createAnimation(SkeletonData *data, const char *name, int boneCount, int frameCount, float duration) {
+		Vector<Timeline *> timelines;
+		for (int b = 1; b <= boneCount; b++) {
+			RotateTimeline *timeline = new RotateTimeline(frameCount, 0, b);
+			for (int frame = 0; frame < frameCount; frame++)
+				timeline->setFrame(frame, duration * frame / (frameCount - 1), (frame & 1) ? 30.0f : -30.0f);
+			timelines.add(timeline);
+		}
+		Animation *animation = new Animation(name, timelines, duration);
+		data->getAnimations().add(animation);
+		data->buildIndices();
+		return animation;
+	}
+
+	/// Full versus incremental world transform updates for an idle skeleton and for one with the first two of its twenty
+	/// chains keyed.
+	void benchIncrementalUpdate() {
+		SkeletonData *data = createSkeletonData(20, 10, true);
+		Animation *partial = createAnimation(data, "partial", 22, 30, 1);
+		printf("%d bones, %d keyed\n", (int) data->getBones().size(), (int) partial->getTimelines().size());
+		for (int incremental = 0; incremental < 2; incremental++) {
+			Skeleton skeleton(data);
+			skeleton.setIncrementalUpdate(incremental != 0);
+			skeleton.updateWorldTransform(Physics_None);
+			measure(incremental ? "idle, incremental" : "idle, full", 20000, [&]() {
+				skeleton.updateWorldTransform(Physics_None);
+			});
+			float time = 0;
+			measure(incremental ? "partially animated, incremental" : "partially animated, full", 20000, [&]() {
+				float lastTime = time;
+				time += 1 / 60.0f;
+				partial->apply(skeleton, lastTime, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+				skeleton.updateWorldTransform(Physics_None);
+			});
+		}
+		delete data;
+	}
+
+	/// The linear scan Animation::search used before it kept cursors.
+	int linearSearch(Vector<float> &frames, float target, int step) {
+		size_t n = frames.size();
+		for (size_t i = step; i < n; i += step)
+			if (frames[i] > target) return (int) (i - step);
+		return (int) (n - step);
+	}
+
+	/// Keyframe search in a timeline with thousands of keys, and playback of an animation made of such timelines.
+	void benchLongTimelines() {
+		const int frameCount = 5000, playbackSteps = 6000;
+		const float duration = 100, delta = duration / playbackSteps;
+		Vector<float> frames;
+		frames.setSize(frameCount * 2, 0);
+		for (int i = 0; i < frameCount; i++) frames[i * 2] = duration * i / (frameCount - 1);
+		printf("%d keys per timeline\n", frameCount);
+
+		volatile int found = 0;
+		int step = 0;
+		measure("search, linear scan", playbackSteps, [&]() {
+			found = linearSearch(frames, delta * (step++ % playbackSteps), 2);
+		});
+		measure("search, binary", playbackSteps, [&]() {
+			found = Animation::search(frames, delta * (step++ % playbackSteps), 2);
+		});
+		{
+			int cursor = -1;
+			SearchCursorScope scope(&cursor);
+			measure("search, cursor", playbackSteps, [&]() {
+				found = Animation::search(frames, delta * (step++ % playbackSteps), 2);
+			});
+		}
+
+		SkeletonData *data = createSkeletonData(4, 5, false);
+		Animation *animation = createAnimation(data, "long", 20, frameCount, duration);
+		{
+			Skeleton skeleton(data);
+			float time = 0;
+			measure("apply 20 timelines, Animation::apply (binary)", playbackSteps, [&]() {
+				float lastTime = time;
+				time += delta;
+				animation->apply(skeleton, lastTime, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+			});
+		}
+		{
+			Skeleton skeleton(data);
+			AnimationStateData stateData(data);
+			AnimationState state(&stateData);
+			state.setAnimation(0, animation, true);
+			measure("apply 20 timelines, AnimationState (cursors)", playbackSteps, [&]() {
+				state.update(delta);
+				state.apply(skeleton);
+			});
+		}
+		delete data;
+	}
+
+	/// Resolves the bones and target of each IK and transform constraint the way the constraint constructors do, either
+	/// by name with the linear scan Skeleton::findBone used before, or by the BoneData index. Returns the bones resolved.
+	int resolveConstraintBones(Skeleton &skeleton, bool byName, Vector<Bone *> &resolved) {
+		Vector<Bone *> &bones = skeleton.getBones();
+		SkeletonData *data = skeleton.getData();
+		int count = 0;
+		for (size_t i = 0, n = data->getIkConstraints().size() + data->getTransformConstraints().size(); i < n; i++) {
+			size_t ikCount = data->getIkConstraints().size();
+			Vector<BoneData *> &constrained = i < ikCount ? data->getIkConstraints()[i]->getBones()
+														  : data->getTransformConstraints()[i - ikCount]->getBones();
+			BoneData *target = i < ikCount ? data->getIkConstraints()[i]->getTarget()
+										   : data->getTransformConstraints()[i - ikCount]->getTarget();
+			resolved.clear();
+			resolved.ensureCapacity(constrained.size() + 1);
+			for (size_t ii = 0; ii < constrained.size(); ii++) {
+				BoneData *boneData = constrained[ii];
+				resolved.add(byName ? ContainerUtil::findWithDataName(bones, boneData->getName())
+									: bones[boneData->getIndex()]);
+			}
+			resolved.add(byName ? ContainerUtil::findWithDataName(bones, target->getName()) : bones[target->getIndex()]);
+			count += (int) resolved.size();
+		}
+		return count;
+	}
+
+	/// Skeleton instantiation, the constraint bone resolution it does by index against the former resolution by name,
+	/// and the per instance name indices it builds.
+	void benchInstantiation() {
+		SkeletonData *data = createSkeletonData(50, 10, true);
+		printf("%d bones, %d constraints\n", (int) data->getBones().size(),
+			   (int) (data->getIkConstraints().size() + data->getTransformConstraints().size()));
+		measure("new Skeleton", 2000, [&]() {
+			delete new Skeleton(data);
+		});
+
+		Skeleton skeleton(data);
+		Vector<Bone *> resolved;
+		volatile int count = 0;
+		measure("resolve constraint bones, by name (former)", 2000, [&]() {
+			count = resolveConstraintBones(skeleton, true, resolved);
+		});
+		measure("resolve constraint bones, by index", 2000, [&]() {
+			count = resolveConstraintBones(skeleton, false, resolved);
+		});
+		measure("build the six name indices of a Skeleton", 2000, [&]() {
+			NameIndex bones, slots, ikConstraints, transformConstraints, pathConstraints, physicsConstraints;
+			bones.buildWithData(skeleton.getBones());
+			slots.buildWithData(skeleton.getSlots());
+			ikConstraints.buildWithData(skeleton.getIkConstraints());
+			transformConstraints.buildWithData(skeleton.getTransformConstraints());
+			pathConstraints.buildWithData(skeleton.getPathConstraints());
+			physicsConstraints.buildWithData(skeleton.getPhysicsConstraints());
+		});
+		delete data;
+	}
+
+	/// The doubly linked list HashMap was before it used open addressing, reduced to what AnimationState calls.
+	class ListMap {
+	public:
+		ListMap() : _head(NULL) {
+		}
+
+		~ListMap() {
+			clear();
+		}
+
+		void clear() {
+			for (Entry *entry = _head; entry != NULL;) {
+				Entry *next = entry->next;
+				delete entry;
+				entry = next;
+			}
+			_head = NULL;
+		}
+
+		bool put(PropertyId key, bool value) {
+			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
+				if (entry->key == key) {
+					entry->value = value;
+					return false;
+				}
+			}
+			Entry *entry = new (__FILE__, __LINE__) Entry();
+			entry->key = key;
+			entry->value = value;
+			entry->prev = NULL;
+			entry->next = _head;
+			if (_head) _head->prev = entry;
+			_head = entry;
+			return true;
+		}
+
+		bool addAll(Vector<PropertyId> &keys, bool value) {
+			bool added = false;
+			for (size_t i = 0; i < keys.size(); i++)
+				if (put(keys[i], value)) added = true;
+			return added;
+		}
+
+	private:
+		class Entry : public SpineObject {
+		public:
+			PropertyId key;
+			bool value;
+			Entry *next, *prev;
+		};
+
+		Entry *_head;
+	};
+
+	/// The property id bookkeeping AnimationState::computeHold does when animations change: clearing the map, then adding
+	/// the ids of each timeline of two tracks keying the same properties.
+	void benchPropertyIds() {
+		const int timelineCount = 200;
+		Vector<Vector<PropertyId> > ids;
+		ids.setSize(timelineCount, Vector<PropertyId>());
+		for (int i = 0; i < timelineCount; i++) {
+			ids[i].add(((PropertyId) Property_Rotate << 32) | i);
+			ids[i].add(((PropertyId) Property_X << 32) | i);
+		}
+		printf("%d timelines with 2 property ids each, 2 tracks\n", timelineCount);
+
+		volatile int added = 0;
+		ListMap list;
+		measure("clear and add, linked list", 2000, [&]() {
+			list.clear();
+			for (int track = 0; track < 2; track++)
+				for (int i = 0; i < timelineCount; i++) added = list.addAll(ids[i], true);
+		});
+		HashMap<PropertyId, bool> map;
+		measure("clear and add, HashMap", 2000, [&]() {
+			map.clear();
+			for (int track = 0; track < 2; track++)
+				for (int i = 0; i < timelineCount; i++) added = map.addAll(ids[i], true);
+		});
+	}
+
+	struct Benchmark {
+		const char *name;
+		void (*run)();
+	};
+
+	const Benchmark benchmarks[] = {
+			{"incremental-update", benchIncrementalUpdate},
+			{"long-timelines", benchLongTimelines},
+			{"instantiation", benchInstantiation},
+			{"property-ids", benchPropertyIds},
+	};
+}
+
+int main(int argc, char **argv) {
+	const char *filter = argc > 1 ? argv[1] : NULL;
+	for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		if (filter && strcmp(filter, benchmarks[i].name) != 0) continue;
+		printf("%s\n", benchmarks[i].name);
+		benchmarks[i].run();
+	}
+	return 0;
+}
@@ -96,6 +96,10 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class SkeletonData;
+
+		friend class ISkeletonBinaryLoader;
+
 	public:
 		Animation(const String &name, Vector<Timeline *> &timelines, float duration);
 
@@ -110,18 +114,17 @@ namespace spine {
 
 		Vector<Timeline *> &getTimelines();
 
+		/// Replaces the timelines, deleting the current ones.
+		void setTimelines(Vector<Timeline *> &timelines);
+
 		bool hasTimeline(Vector<PropertyId> &ids);
 
 		float getDuration();
 
 		void setDuration(float inValue);
 
-        /// @param target After the first and before the last entry.
-        static int binarySearch(Vector<float> &values, float target, int step);
-
-        /// @param target After the first and before the last entry.
-        static int binarySearch(Vector<float> &values, float target);
-
+		/// Returns the index of the last frame whose time is less than or equal to target, or 0. Starts from the
+		/// calling thread's SearchCursorScope, if any, and otherwise uses a binary search.
 		/// @param target After the first and before the last entry.
 		static int search(Vector<float> &values, float target);
 
@@ -131,6 +134,24 @@ namespace spine {
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+		int _decoderIndex;// The index in the SkeletonData's AnimationDecoder, or -1 if not loaded lazily.
+	};
+
+	/// Makes Animation::search on the calling thread check, and then update, the frame index in cursor for the lifetime of
+	/// the scope. AnimationState keeps one cursor per timeline of each TrackEntry, so during playback the frame is
+	/// usually found where the previous search left off or one frame later, and only seeks fall back to a binary search.
+	class SP_API SearchCursorScope {
+	public:
+		explicit SearchCursorScope(int *cursor);
+
+		~SearchCursorScope();
+
+	private:
+		int *_previous;
+
+		SearchCursorScope(const SearchCursorScope &);
+
+		SearchCursorScope &operator=(const SearchCursorScope &);
 	};
 }
 
@@ -32,6 +32,7 @@
 
 #include <spine/Vector.h>
 #include <spine/Pool.h>
+#include <spine/HashMap.h>
 #include <spine/Property.h>
 #include <spine/MixBlend.h>
 #include <spine/SpineObject.h>
@@ -59,6 +60,8 @@ namespace spine {
 
 	class Animation;
 
+	class BakedAnimation;
+
 	class Event;
 
 	class AnimationStateData;
@@ -135,6 +138,13 @@ namespace spine {
 
 		void setShortestRotation(bool inValue);
 
+		/// A baked version of the animation to apply instead of evaluating the timelines it bakes, or NULL. It is used when
+		/// this entry is applied on track 0 at full alpha or with MixBlend_Add and no other way, so while mixing the
+		/// animation's timelines are applied as usual. Defaults to AnimationStateData::getBakedAnimation(Animation*).
+		BakedAnimation *getBakedAnimation();
+
+		void setBakedAnimation(BakedAnimation *inValue);
+
 		/// Seconds to postpone playing the animation. When a track entry is the current track entry, delay postpones incrementing
 		/// the track time. When a track entry is queued, delay is the time from the start of the previous animation to when the
 		/// track entry will become the current track entry.
@@ -307,6 +317,8 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<int> _timelineCursors;
+		BakedAnimation *_bakedAnimation;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
@@ -453,6 +465,11 @@ namespace spine {
 
 		void disposeTrackEntry(TrackEntry *entry);
 
+		/// Preallocates track entries so that up to count of them can be in use without allocating, for example before
+		/// many animations are set or queued at once. Track entries are owned by the animation state and are destroyed
+		/// with it.
+		void reserveTrackEntries(size_t count);
+
 	private:
 		static const int Subsequent = 0;
 		static const int First = 1;
@@ -41,6 +41,8 @@ namespace spine {
 
 	class Animation;
 
+	class BakedAnimation;
+
 	/// Stores mix (crossfade) durations to be applied when AnimationState animations are changed.
 	class SP_API AnimationStateData : public SpineObject {
 		friend class AnimationState;
@@ -67,6 +69,16 @@ namespace spine {
 		/// or the DefaultMix if no mix duration has been set.
 		float getMix(Animation *from, Animation *to);
 
+		/// Sets the baked animation that new track entries for its animation use, see TrackEntry::setBakedAnimation. The
+		/// baked animation is not owned and must outlive the track entries that use it.
+		void setBakedAnimation(BakedAnimation *baked);
+
+		/// Removes the baked animation set for the animation, if any.
+		void removeBakedAnimation(Animation *animation);
+
+		/// The baked animation set for the animation, or NULL.
+		BakedAnimation *getBakedAnimation(Animation *animation);
+
 		/// Removes all mixes and sets the default mix to 0.
 		void clear();
 
@@ -81,9 +93,16 @@ namespace spine {
 			bool operator==(const AnimationPair &other) const;
 		};
 
+		/// Hashes the animation names, as AnimationPair compares them.
+		class AnimationPairHash {
+		public:
+			static size_t hash(const AnimationPair &pair);
+		};
+
 		SkeletonData *_skeletonData;
 		float _defaultMix;
-		HashMap<AnimationPair, float> _animationToMixTime;
+		HashMap<AnimationPair, float, AnimationPairHash> _animationToMixTime;
+		HashMap<Animation *, BakedAnimation *> _bakedAnimations;
 	};
 }
 
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Arena_h
+#define Spine_Arena_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// A region of memory handed out in increasing addresses from a few large blocks and released all at once when the
+	/// arena is destroyed. Individual allocations are never returned to the SpineExtension; releasing the most recent one
+	/// only rolls the arena back.
+	///
+	/// While an ArenaScope is active on a thread, SpineExtension::alloc, calloc, realloc and free on that thread are
+	/// served by the arena, which is how SkeletonBinary places all the data of a SkeletonData in one region.
+	class SP_API Arena : public SpineObject {
+	public:
+		/// @param blockSize The size of the first block. Each further block is twice the size of the previous one, up to
+		/// 64 times the first block.
+		explicit Arena(size_t blockSize = 64 * 1024);
+
+		~Arena();
+
+		/// Returns NULL if size is 0. The memory is aligned to 8 bytes.
+		void *allocate(size_t size);
+
+		/// Grows the allocation in place if it is the most recent one, otherwise moves it. Shrinking keeps the allocation.
+		void *reallocate(void *ptr, size_t size);
+
+		/// Rolls the arena back if ptr is the most recent allocation, otherwise does nothing.
+		void release(void *ptr);
+
+		/// Whether ptr points into one of the blocks of this arena.
+		bool owns(const void *ptr) const;
+
+		/// The requested size of an allocation made by this arena.
+		size_t getSize(const void *ptr) const;
+
+		/// The total size of the blocks allocated from the SpineExtension.
+		size_t getCapacity() const;
+
+		/// The bytes handed out, including per allocation headers and padding.
+		size_t getUsed() const;
+
+		/// The arena active on the calling thread, or NULL.
+		static Arena *getCurrent();
+
+		/// Whether allocations on the calling thread are served by the current arena, rather than only its frees.
+		static bool isAllocating();
+
+	private:
+		friend class ArenaScope;
+
+		friend class ArenaOwner;
+
+		struct Block;
+
+		Block *_blocks;
+		size_t _nextBlockSize;
+		size_t _maxBlockSize;
+
+		static void setCurrent(Arena *arena, bool allocating);
+
+		Block *addBlock(size_t minSize);
+	};
+
+	/// Makes an arena current on the calling thread for the lifetime of the scope and restores the previous one afterward.
+	/// With allocating false, frees of memory in the arena are ignored while new allocations still go to the
+	/// SpineExtension. That is the mode for modifying or destroying data that lives in an arena.
+	class SP_API ArenaScope {
+	public:
+		explicit ArenaScope(Arena *arena, bool allocating = true);
+
+		~ArenaScope();
+
+	private:
+		Arena *_previous;
+		bool _previousAllocating;
+
+		ArenaScope(const ArenaScope &);
+
+		ArenaScope &operator=(const ArenaScope &);
+	};
+
+	/// Owns an arena on behalf of the object it is a member of. Declare it before the members that may live in the arena,
+	/// so that it is destroyed after them, and call beginDestruction at the start of the owner's destructor. The arena then
+	/// stays current, without allocating, until the members are gone.
+	class SP_API ArenaOwner {
+	public:
+		ArenaOwner();
+
+		~ArenaOwner();
+
+		Arena *get() { return _arena; }
+
+		/// Takes ownership of the arena.
+		void set(Arena *arena);
+
+		void beginDestruction();
+
+	private:
+		Arena *_arena;
+		Arena *_previous;
+		bool _previousAllocating;
+		bool _destroying;
+
+		ArenaOwner(const ArenaOwner &);
+
+		ArenaOwner &operator=(const ArenaOwner &);
+	};
+}
+
+#endif /* Spine_Arena_h */
@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/MixBlend.h>
+#include <spine/MixDirection.h>
+#include <spine/Property.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class Event;
+
+	class Skeleton;
+
+	class SkeletonData;
+
+	/// An animation pre-sampled at a fixed rate into a table of poses, for skeletons that play the same animations many
+	/// times, such as crowds.
+	///
+	/// Baking applies the animation's bone timelines, and optionally its slot color timelines, at every frame of the
+	/// chosen rate and stores the local values they key as one row per frame. Applying a baked animation interpolates
+	/// linearly between the two rows around the time instead of evaluating the timelines' curves. Attachment, draw order,
+	/// event, deform, constraint and other timelines are not baked and are applied from the animation as usual.
+	///
+	/// The baked values can differ from the curves between rows. The error getters report the largest difference found
+	/// halfway between rows when baking, which can be used to choose the rate.
+	class SP_API BakedAnimation : public SpineObject {
+		friend class AnimationState;
+
+	public:
+		/// Bakes the animation, which must belong to the skeleton data. A lazily loaded animation is decoded first.
+		/// @param fps The rows per second of animation time.
+		/// @param colors If true, slot color timelines are baked too.
+		BakedAnimation(SkeletonData &skeletonData, Animation &animation, float fps, bool colors = false);
+
+		~BakedAnimation();
+
+		Animation &getAnimation();
+
+		float getFps();
+
+		/// The number of rows, one per frame from 0 to the animation duration.
+		size_t getRowCount();
+
+		/// The number of values in each row.
+		size_t getRowSize();
+
+		/// The number of bytes used by the baked table and the channel and timeline bookkeeping.
+		size_t getMemorySize();
+
+		/// Returns true if the timeline at the index in the animation's timelines is baked.
+		bool isBaked(size_t timelineIndex);
+
+		/// The largest translate error found when baking, in skeleton units.
+		float getTranslateError();
+
+		/// The largest rotate or shear error found when baking, in degrees.
+		float getRotateError();
+
+		/// The largest scale error found when baking.
+		float getScaleError();
+
+		/// The largest color channel error found when baking, from 0 to 1.
+		float getColorError();
+
+		/// Applies the baked rows and the timelines that are not baked to the skeleton, as Animation::apply does.
+		void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
+				   MixBlend blend, MixDirection direction);
+
+	private:
+		Animation &_animation;
+		float _fps, _duration;
+		size_t _rowCount, _rowSize;
+		Vector<PropertyId> _channels;// Baked properties, in row order.
+		Vector<float> _channelStarts;// Time of the first frame of each channel's timeline.
+		Vector<unsigned char> _baked;// Per timeline of the animation.
+		Vector<float> _rows;
+		float _translateError, _rotateError, _scaleError, _colorError;
+
+		float getRowTime(size_t row);
+
+		void applyRows(Skeleton &skeleton, float time, float alpha, MixBlend blend, MixDirection direction);
+
+		void sample(Skeleton &skeleton, float time);
+
+		void capture(Skeleton &skeleton, float *values);
+
+		void measure(const float *values, const float *row);
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
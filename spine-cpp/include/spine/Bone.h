@@ -62,6 +62,12 @@ namespace spine {
 
 		friend class Skeleton;
 
+		friend class SkeletonPose;
+
+		friend class DirtyTracker;
+
+		friend class BakedAnimation;
+
 		friend class RegionAttachment;
 
 		friend class PointAttachment;
@@ -101,8 +107,11 @@ namespace spine {
 	RTTI_DECL
 
 	public:
+		/// Sets whether the y-axis points down when no RuntimeContext is current on the calling thread.
 		static void setYDown(bool inValue);
 
+		/// Whether the y-axis points down, from the RuntimeContext current on the calling thread, or else as set with
+		/// setYDown.
 		static bool isYDown();
 
 		/// @param parent May be NULL.
@@ -42,7 +42,6 @@ namespace spine {
 
 	public:
 		explicit RGBATimeline(size_t frameCount, size_t bezierCount, int slotIndex);
-        explicit RGBATimeline(size_t frameCount, int slotIndex);
         virtual ~RGBATimeline();
 
 		virtual void
@@ -131,7 +130,6 @@ namespace spine {
 
 	public:
 		explicit RGBA2Timeline(size_t frameCount, size_t bezierCount, int slotIndex);
-        explicit RGBA2Timeline(size_t frameCount, int slotIndex);
         virtual ~RGBA2Timeline();
 
 		virtual void
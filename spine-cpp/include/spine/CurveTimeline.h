@@ -38,11 +38,10 @@ namespace spine {
 	class SP_API CurveTimeline : public Timeline {
 	RTTI_DECL
 
-        void setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2);
+		friend class SkeletonSnapshot;
 
     public:
 		explicit CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount);
-        explicit CurveTimeline(size_t frameCount, size_t frameEntries);
 
 		virtual ~CurveTimeline();
 
@@ -56,7 +55,11 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
-        float getCurvePercent(size_t frameIndex, float percent);
+		/// Sets curves given as control points normalized to the duration of a frame and its change in value, as stored
+		/// before 4.0, after all frames have been set. Each curve is 5 floats: the frame index, then cx1, cy1, cx2, cy2.
+		/// The first valueCount values of the frame each get a bezier. Frames without values, such as deform frames, use
+		/// a valueCount of 0 and get a single bezier from 0 to 1.
+		void setNormalizedCurves(Vector<float> &curves, size_t valueCount);
 
 		Vector<float> &getCurves();
 
@@ -64,7 +67,7 @@ namespace spine {
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
 		static const int BEZIER = 2;
-		int BEZIER_SIZE = 18;//Switch to non-constant to distinguish whether this is an old version
+		static const int BEZIER_SIZE = 18;
 
 		Vector<float> _curves; // type, x, y, ...
     };
@@ -74,7 +77,6 @@ namespace spine {
 
 	public:
 		explicit CurveTimeline1(size_t frameCount, size_t bezierCount);
-		explicit CurveTimeline1(size_t frameCount);
 
 		virtual ~CurveTimeline1();
 
@@ -100,7 +102,6 @@ namespace spine {
 
 	public:
 		explicit CurveTimeline2(size_t frameCount, size_t bezierCount);
-		explicit CurveTimeline2(size_t frameCount);
 
 		virtual ~CurveTimeline2();
 
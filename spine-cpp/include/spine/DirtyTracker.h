@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_DirtyTracker_h
+#define Spine_DirtyTracker_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+#include <spine/Physics.h>
+
+namespace spine {
+	class Bone;
+
+	class Skeleton;
+
+	class Updatable;
+
+	/// Updates the world transforms of a skeleton incrementally, recomputing only the bones and constraints whose result
+	/// may differ from the previous update.
+	///
+	/// Rather than relying on every timeline and setter to report what it touches, the tracker keeps the local, applied
+	/// and world transform and the inherit mode of each bone as they were after the previous update and compares them
+	/// before the next one. A bone whose values differ is changed, as is every bone below a changed bone. A constraint is
+	/// applied when a bone it reads or writes is changed or when its mix values or target have changed. Path constraints are always applied, as
+	/// their path can be deformed, and physics constraints are applied unless the update uses Physics_None. The bones a
+	/// constraint writes are recomputed before it is applied and count as changed afterward.
+	///
+	/// A change of the skeleton's position, scale, coordinate convention or Physics mode, or of the update cache,
+	/// updates everything.
+	class SP_API DirtyTracker : public SpineObject {
+	public:
+		DirtyTracker();
+
+		/// Makes the next update recompute everything.
+		void invalidate() { _valid = false; }
+
+		/// Updates the world transform of the skeleton's bones, see Skeleton::updateWorldTransform(Physics).
+		void update(Skeleton &skeleton, Physics physics);
+
+		/// The number of bones and constraints updated by the last update.
+		size_t getUpdatedCount() { return _updatedCount; }
+
+	private:
+		enum Kind {
+			Kind_Bone, Kind_IkConstraint, Kind_TransformConstraint, Kind_PathConstraint, Kind_PhysicsConstraint, Kind_Unknown
+		};
+
+		static const int BoneValues = 21;
+		static const int ConstraintValues = 8;
+
+		Vector<float> _bones;// BoneValues per bone, after the last update.
+		Vector<float> _constraints;// ConstraintValues per update cache entry, after the last update.
+		Vector<unsigned char> _changed;// Per bone.
+		Vector<unsigned char> _recompute;// Per bone.
+		Vector<unsigned char> _apply;// Per update cache entry.
+		Vector<unsigned char> _kinds;// Per update cache entry, see Kind.
+		Vector<int> _cacheBones;// Per update cache entry, the index of the bone or -1.
+		Vector<int> _parents;// Per bone, the index of the parent or -1.
+		float _x, _y, _scaleX, _scaleY;
+		Physics _physics;
+		size_t _updatedCount;
+		bool _valid;
+
+		void updateAll(Skeleton &skeleton, Physics physics);
+
+		void capture(Skeleton &skeleton, Physics physics);
+
+		static void getBoneValues(Bone *bone, float *values);
+
+		static void getConstraintValues(Updatable *updatable, unsigned char kind, float *values);
+	};
+}
+
+#endif /* Spine_DirtyTracker_h */
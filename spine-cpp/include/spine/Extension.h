@@ -43,22 +43,22 @@ namespace spine {
 	public:
 		template<typename T>
 		static T *alloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_alloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, false, file, line);
 		}
 
 		template<typename T>
 		static T *calloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_calloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, true, file, line);
 		}
 
 		template<typename T>
 		static T *realloc(T *ptr, size_t num, const char *file, int line) {
-			return (T *) getInstance()->_realloc(ptr, sizeof(T) * num, file, line);
+			return (T *) reallocate((void *) ptr, sizeof(T) * num, file, line);
 		}
 
 		template<typename T>
 		static void free(T *ptr, const char *file, int line) {
-			getInstance()->_free((void *) ptr, file, line);
+			deallocate((void *) ptr, file, line);
 		}
 
 		template<typename T>
@@ -70,8 +70,20 @@ namespace spine {
 			return getInstance()->_readFile(path, length);
 		}
 
+		/// Maps a file read-only into memory. Release the returned data with unmapFile.
+		static const unsigned char *mapFile(const String &path, int *length) {
+			return getInstance()->_mapFile(path, length);
+		}
+
+		static void unmapFile(const unsigned char *data, int length) {
+			getInstance()->_unmapFile(data, length);
+		}
+
+		/// Sets the extension used when no RuntimeContext with an extension is current on the calling thread.
 		static void setInstance(SpineExtension *inSpineExtension);
 
+		/// The extension of the RuntimeContext current on the calling thread, or else the one set with setInstance. If none
+		/// was set, the first call creates it with getDefaultExtension.
 		static SpineExtension *getInstance();
 
 		virtual ~SpineExtension();
@@ -88,13 +100,23 @@ namespace spine {
 
 		virtual char *_readFile(const String &path, int *length) = 0;
 
+		/// Implement this function to map files with your platform's facilities. Falls back to _readFile.
+		virtual const unsigned char *_mapFile(const String &path, int *length);
+
+		virtual void _unmapFile(const unsigned char *data, int length);
+
 		virtual void _beforeFree(void *ptr) { SP_UNUSED(ptr); }
 
 	protected:
 		SpineExtension();
 
 	private:
-		static SpineExtension *_instance;
+		// Route to the arena current on the calling thread, if any, see Arena.
+		static void *allocate(size_t size, bool zero, const char *file, int line);
+
+		static void *reallocate(void *ptr, size_t size, const char *file, int line);
+
+		static void deallocate(void *ptr, const char *file, int line);
 	};
 
 	class SP_API DefaultSpineExtension : public SpineExtension {
@@ -113,6 +135,10 @@ namespace spine {
 		virtual void _free(void *mem, const char *file, int line) override;
 
 		virtual char *_readFile(const String &path, int *length) override;
+
+		virtual const unsigned char *_mapFile(const String &path, int *length) override;
+
+		virtual void _unmapFile(const unsigned char *data, int length) override;
 	};
 
 // This function is to be implemented by engine specific runtimes to provide
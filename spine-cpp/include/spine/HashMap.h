@@ -32,6 +32,9 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#include <stdint.h>
 
 // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
@@ -42,7 +45,39 @@
 #endif
 
 namespace spine {
-	template<typename K, typename V>
+	/// The default hash used by HashMap, for integer and enum keys. Specialized for pointers and String. Other key types
+	/// pass their own class with a static hash function to HashMap.
+	template<typename K>
+	struct HashMapHash {
+		static size_t hash(const K &key) {
+			uint64_t h = (uint64_t) key * 0x9E3779B97F4A7C15ull;
+			return (size_t) (h ^ (h >> 32));
+		}
+	};
+
+	template<typename T>
+	struct HashMapHash<T *> {
+		static size_t hash(T *const &key) {
+			uint64_t h = (uint64_t) (uintptr_t) key * 0x9E3779B97F4A7C15ull;
+			return (size_t) (h ^ (h >> 32));
+		}
+	};
+
+	template<>
+	struct HashMapHash<String> {
+		/// FNV-1a.
+		static size_t hash(const String &key) {
+			size_t h = 2166136261u;
+			const char *chars = key.buffer();
+			for (size_t i = 0, n = key.length(); i < n; i++)
+				h = (h ^ (unsigned char) chars[i]) * 16777619u;
+			return h;
+		}
+	};
+
+	/// An open addressing hash map with linear probing. Entries are stored in one contiguous array whose size is a power
+	/// of two and at least twice the number of entries. Keys are compared with ==, hashed with H::hash.
+	template<typename K, typename V, typename H = HashMapHash<K> >
 	class SP_API HashMap : public SpineObject {
 	private:
 		class Entry;
@@ -60,47 +95,48 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Vector<Entry> &entries) : _entries(entries), _index(-1), _hasChecked(false) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				_index = nextIndex();
+				assert(_index < (int) _entries.size());
+				Entry &entry = _entries[_index];
+				Pair pair(entry._key, entry._value);
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				return nextIndex() < (int) _entries.size();
 			}
 
 		private:
+			Vector<Entry> &_entries;
+			int _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
+
+			int nextIndex() {
+				int i = _index + 1;
+				for (int n = (int) _entries.size(); i < n && !_entries[i]._used; i++) {
+				}
+				return i;
+			}
 		};
 
-		HashMap() :
-				_head(NULL),
-				_size(0) {
+		HashMap() : _size(0) {
 		}
 
 		~HashMap() {
-			clear();
 		}
 
+		/// Removes all entries, keeping the storage.
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
-			}
-			_head = NULL;
+			if (_size == 0) return;
+			for (size_t i = 0, n = _entries.size(); i < n; i++)
+				if (_entries[i]._used) _entries[i] = Entry();
 			_size = 0;
 		}
 
@@ -108,30 +144,22 @@ namespace spine {
 			return _size;
 		}
 
+		/// Makes room for the given number of entries without growing the storage again.
+		void reserve(size_t size) {
+			if (size * 2 > _entries.size()) rehash(size);
+		}
+
 		void put(const K &key, const V &value) {
 			Entry *entry = find(key);
 			if (entry) {
 				entry->_key = key;
 				entry->_value = value;
 			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
-				_size++;
+				insert(key, value);
 			}
 		}
 
-		bool addAll(Vector <K> &keys, const V &value) {
+		bool addAll(Vector<K> &keys, const V &value) {
 			size_t oldSize = _size;
 			for (size_t i = 0; i < keys.size(); i++) {
 				put(keys[i], value);
@@ -147,14 +175,16 @@ namespace spine {
 			Entry *entry = find(key);
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			// Shift back the entries that follow in the same run, so no tombstones are needed.
+			size_t mask = _entries.size() - 1, i = entry - _entries.buffer();
+			for (size_t j = (i + 1) & mask; _entries[j]._used; j = (j + 1) & mask) {
+				size_t home = H::hash(_entries[j]._key) & mask;
+				if (((j - home) & mask) >= ((j - i) & mask)) {
+					_entries[i] = _entries[j];
+					i = j;
+				}
+			}
+			_entries[i] = Entry();
 			_size--;
 
 			return true;
@@ -170,29 +200,58 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(const_cast<Vector<Entry> &>(_entries));
 		}
 
 	private:
 		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+			if (_size == 0) return NULL;
+			size_t mask = _entries.size() - 1;
+			for (size_t i = H::hash(key) & mask; _entries[i]._used; i = (i + 1) & mask) {
+				if (_entries[i]._key == key)
+					return &_entries[i];
 			}
 			return NULL;
 		}
 
-		class SP_API Entry : public SpineObject {
+		void insert(const K &key, const V &value) {
+			if ((_size + 1) * 2 > _entries.size()) rehash(_size + 1);
+			size_t mask = _entries.size() - 1, i = H::hash(key) & mask;
+			while (_entries[i]._used) i = (i + 1) & mask;
+			Entry &entry = _entries[i];
+			entry._key = key;
+			entry._value = value;
+			entry._used = true;
+			_size++;
+		}
+
+		void rehash(size_t size) {
+			size_t capacity = 8;
+			while (capacity < size * 2) capacity <<= 1;
+			Vector<Entry> entries;
+			if (_size > 0) {
+				entries.ensureCapacity(_size);
+				for (size_t i = 0, n = _entries.size(); i < n; i++)
+					if (_entries[i]._used) entries.add(_entries[i]);
+			}
+			_entries.clear();
+			_entries.ensureCapacity(capacity);
+			_entries.setSize(capacity, Entry());
+			_size = 0;
+			for (size_t i = 0, n = entries.size(); i < n; i++)
+				insert(entries[i]._key, entries[i]._value);
+		}
+
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
+			bool _used;
 
-			Entry() : next(NULL), prev(NULL) {}
+			Entry() : _key(), _value(), _used(false) {}
 		};
 
-		Entry *_head;
+		Vector<Entry> _entries;
 		size_t _size;
 	};
 }
@@ -43,7 +43,6 @@ namespace spine {
 
 	public:
 		explicit IkConstraintTimeline(size_t frameCount, size_t bezierCount, int ikConstraintIndex);
-		explicit IkConstraintTimeline(size_t frameCount, int ikConstraintIndex);
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
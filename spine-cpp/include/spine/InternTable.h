@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_InternTable_h
+#define Spine_InternTable_h
+
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+namespace spine {
+	/// Keeps a single copy of every distinct string interned in it. Interned strings share their characters when they
+	/// are copied, and two of them from the same table are equal only if they point to the same characters. Set one table
+	/// on the SkeletonBinary, SkeletonJson and SkeletonSnapshot instances that load related skeletons, so their names are
+	/// shared and compare by pointer.
+	///
+	/// The table must outlive every string interned in it. Interning is thread safe. The characters are always allocated
+	/// from the SpineExtension, never from an active Arena.
+	class SP_API InternTable : public SpineObject {
+	public:
+		InternTable();
+
+		~InternTable();
+
+		/// Returns the interned copy of chars, or an empty string if chars is NULL.
+		String intern(const char *chars);
+
+		String intern(const String &string);
+
+		/// The number of distinct strings in the table.
+		size_t size();
+
+	private:
+		struct State;
+		State *_state;
+
+		InternTable(const InternTable &);
+
+		InternTable &operator=(const InternTable &);
+	};
+}
+
+#endif /* Spine_InternTable_h */
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/HashMap.h>
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#include <assert.h>
+
+namespace spine {
+	/// A hash index over the names of the items in a vector, so finding an item by name takes constant time. The index
+	/// covers the items the vector held when it was last built, up to the first NULL item. Items after those are found by
+	/// comparing each item's name, as they are when no index was built. An item replaced in place must have the same
+	/// name, otherwise the index must be cleared and built again.
+	///
+	/// Lookups never modify the index, so they may be made from several threads at once, but not while it is built.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() : _count(0) {
+		}
+
+		/// Indexes the items by name. Items appended since the previous build are added to the index, otherwise it is
+		/// rebuilt.
+		template<typename T>
+		void build(Vector<T *> &items) {
+			add(items, &itemName<T>);
+		}
+
+		/// Indexes the items by the name of each item's data. See build().
+		template<typename T>
+		void buildWithData(Vector<T *> &items) {
+			add(items, &dataName<T>);
+		}
+
+		/// Finds an item by its name.
+		/// @return May be NULL.
+		template<typename T>
+		T *find(Vector<T *> &items, const String &name) const {
+			int index = findIndex(items, name, &itemName<T>);
+			return index == -1 ? NULL : items[index];
+		}
+
+		/// Finds an item by the name of its data.
+		/// @return May be NULL.
+		template<typename T>
+		T *findWithData(Vector<T *> &items, const String &name) const {
+			int index = findIndex(items, name, &dataName<T>);
+			return index == -1 ? NULL : items[index];
+		}
+
+		/// Discards the index, so lookups compare each item's name until it is built again.
+		void clear() {
+			_table.clear();
+			_count = 0;
+		}
+
+	private:
+		Vector<int> _table;// Item indices, -1 for empty slots.
+		size_t _count;// The number of items indexed.
+
+		template<typename T>
+		static const String &itemName(T *item) {
+			return item->getName();
+		}
+
+		template<typename T>
+		static const String &dataName(T *item) {
+			return item->getData().getName();
+		}
+
+		template<typename T>
+		int findIndex(Vector<T *> &items, const String &name, const String &(*getName)(T *)) const {
+			assert(name.length() > 0);
+			size_t size = items.size();
+			if (_table.size() > 0) {
+				size_t mask = _table.size() - 1;
+				for (size_t i = HashMapHash<String>::hash(name) & mask; _table[i] != -1; i = (i + 1) & mask) {
+					size_t index = (size_t) _table[i];
+					if (index >= size) continue;
+					T *item = items[index];
+					if (item && getName(item) == name) return (int) index;
+				}
+			}
+
+			for (size_t i = _count < size ? _count : size; i < size; i++) {
+				T *item = items[i];
+				if (item && getName(item) == name) return (int) i;
+			}
+			return -1;
+		}
+
+		template<typename T>
+		void add(Vector<T *> &items, const String &(*getName)(T *)) {
+			size_t size = items.size();
+			if (size < _count) clear();
+			if (size * 2 > _table.size()) {
+				size_t capacity = 16;
+				while (capacity < size * 2) capacity <<= 1;
+				_table.clear();
+				_table.setSize(capacity, -1);
+				_count = 0;
+			}
+			size_t mask = _table.size() - 1;
+			for (; _count < size; _count++) {
+				T *item = items[_count];
+				if (!item) break;// Loaders fill slots in later, so they are left to the unindexed items.
+				size_t i = HashMapHash<String>::hash(getName(item)) & mask;
+				while (_table[i] != -1) i = (i + 1) & mask;
+				_table[i] = (int) _count;
+			}
+		}
+	};
+}
+
+#endif /* Spine_NameIndex_h */
@@ -43,7 +43,6 @@ namespace spine {
 
 	public:
 		explicit PathConstraintMixTimeline(size_t frameCount, size_t bezierCount, int pathConstraintIndex);
-		explicit PathConstraintMixTimeline(size_t frameCount, int pathConstraintIndex);
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
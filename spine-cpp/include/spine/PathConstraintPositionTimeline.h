@@ -45,7 +45,6 @@ namespace spine {
 		static const int ENTRIES;
 
 		explicit PathConstraintPositionTimeline(size_t frameCount, size_t bezierCount, int pathConstraintIndex);
-		explicit PathConstraintPositionTimeline(size_t frameCount, int pathConstraintIndex);
 
 		virtual ~PathConstraintPositionTimeline();
 
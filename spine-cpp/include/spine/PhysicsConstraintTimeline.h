@@ -265,6 +265,8 @@ namespace spine {
 
         friend class SkeletonJson;
 
+        friend class SkeletonSnapshot;
+
     RTTI_DECL
 
     public:
@@ -32,42 +32,92 @@
 
 #include <spine/Extension.h>
 #include <spine/Vector.h>
-#include <spine/ContainerUtil.h>
 #include <spine/SpineObject.h>
+#include <assert.h>
+#include <type_traits>
 
 namespace spine {
+	/// Hands out default constructed objects from chunks of contiguous storage and takes them back through an intrusive
+	/// free list, so obtain and free are O(1). Objects are constructed once, when their chunk is allocated, and are not
+	/// reset by the pool. The pool owns every object it hands out: they are destroyed with the pool and must not be
+	/// deleted by the caller. Freeing an object twice is caught by an assert.
 	template<typename T>
 	class SP_API Pool : public SpineObject {
 	public:
-		Pool() {
+		Pool() : _free(NULL), _capacity(0) {
 		}
 
 		~Pool() {
-			ContainerUtil::cleanUpVectorOfPointers(_objects);
+			for (size_t i = 0; i < _chunks.size(); ++i) {
+				Chunk &chunk = _chunks[i];
+				for (size_t ii = 0; ii < chunk.count; ++ii)
+					chunk.slots[ii].object()->~T();
+				SpineExtension::free(chunk.slots, __FILE__, __LINE__);
+			}
 		}
 
 		T *obtain() {
-			if (_objects.size() > 0) {
-				T **object = &_objects[_objects.size() - 1];
-				T *ret = *object;
-				_objects.removeAt(_objects.size() - 1);
+			if (!_free) addChunk(_capacity < 16 ? 16 : _capacity);
+			Slot *slot = _free;
+			_free = slot->next;
+			slot->next = NULL;
+			slot->isFree = false;
+			return slot->object();
+		}
 
-				return ret;
-			} else {
-				T *ret = new(__FILE__, __LINE__) T();
+		void free(T *object) {
+			Slot *slot = reinterpret_cast<Slot *>(object);
+			assert(!slot->isFree);
+			slot->isFree = true;
+			slot->next = _free;
+			_free = slot;
+		}
 
-				return ret;
-			}
+		/// Makes sure at least count objects can be obtained in total without the pool allocating.
+		void reserve(size_t count) {
+			if (count > _capacity) addChunk(count - _capacity);
 		}
 
-		void free(T *object) {
-			if (!_objects.contains(object)) {
-				_objects.add(object);
-			}
+		/// The number of objects the pool has constructed, whether they are free or in use.
+		size_t getCapacity() {
+			return _capacity;
 		}
 
 	private:
-		Vector<T *> _objects;
+		struct Slot {
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+			Slot *next;
+			bool isFree;
+
+			T *object() {
+				return reinterpret_cast<T *>(&storage);
+			}
+		};
+
+		struct Chunk {
+			Slot *slots;
+			size_t count;
+		};
+
+		Vector<Chunk> _chunks;
+		Slot *_free;
+		size_t _capacity;
+
+		void addChunk(size_t count) {
+			Chunk chunk;
+			chunk.slots = SpineExtension::alloc<Slot>(count, __FILE__, __LINE__);
+			chunk.count = count;
+			// Link the slots in reverse so they are handed out in address order.
+			for (size_t i = count; i-- > 0;) {
+				Slot &slot = chunk.slots[i];
+				new (&slot.storage) T();
+				slot.isFree = true;
+				slot.next = _free;
+				_free = &slot;
+			}
+			_chunks.add(chunk);
+			_capacity += count;
+		}
 	};
 }
 
@@ -44,7 +44,6 @@ namespace spine {
 
 	public:
 		explicit RotateTimeline(size_t frameCount, size_t bezierCount, int boneIndex);
-		explicit RotateTimeline(size_t frameCount, int boneIndex);
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_RuntimeContext_h
+#define Spine_RuntimeContext_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class SpineExtension;
+
+	/// The settings the runtime reads while loading and updating skeletons: the SpineExtension that allocates memory and
+	/// reads files, and whether the y-axis points down. A context is made current on a thread with RuntimeContextScope, so
+	/// threads can load and update skeletons with different settings without changing the process wide defaults. When
+	/// no context is current, SpineExtension::getInstance and Bone::isYDown are used, as before.
+	///
+	/// Memory is freed through the SpineExtension current at the time, so objects created in a context with its own
+	/// extension must be modified and destroyed in a context with the same extension. SkeletonData remembers the context
+	/// it was loaded in and does this itself.
+	class SP_API RuntimeContext : public SpineObject {
+	public:
+		/// @param extension May be NULL to use SpineExtension::getInstance.
+		explicit RuntimeContext(SpineExtension *extension = NULL, bool yDown = false);
+
+		~RuntimeContext();
+
+		/// @return May be NULL.
+		SpineExtension *getExtension() { return _extension; }
+
+		/// @param extension May be NULL.
+		void setExtension(SpineExtension *extension) { _extension = extension; }
+
+		bool isYDown() { return _yDown; }
+
+		void setYDown(bool yDown) { _yDown = yDown; }
+
+		/// The context current on the calling thread, or NULL.
+		static RuntimeContext *getCurrent();
+
+	private:
+		friend class RuntimeContextScope;
+
+		friend class RuntimeContextOwner;
+
+		SpineExtension *_extension;
+		bool _yDown;
+
+		static void setCurrent(RuntimeContext *context);
+	};
+
+	/// Makes a context current on the calling thread for the lifetime of the scope and restores the previous one
+	/// afterward. A NULL context restores the defaults.
+	class SP_API RuntimeContextScope {
+	public:
+		explicit RuntimeContextScope(RuntimeContext *context);
+
+		~RuntimeContextScope();
+
+	private:
+		RuntimeContext *_previous;
+
+		RuntimeContextScope(const RuntimeContextScope &);
+
+		RuntimeContextScope &operator=(const RuntimeContextScope &);
+	};
+
+	/// Remembers the context current when the object it is a member of was created, so the object can be modified and
+	/// destroyed in that context from any thread. Declare it as the first member, so that it is destroyed last, and call
+	/// beginDestruction at the start of the owner's destructor. The context then stays current until the members are
+	/// gone. The context must outlive the owner.
+	class SP_API RuntimeContextOwner {
+	public:
+		RuntimeContextOwner();
+
+		~RuntimeContextOwner();
+
+		/// @return May be NULL.
+		RuntimeContext *get() { return _context; }
+
+		void beginDestruction();
+
+		/// The context of the owner most recently destroyed on the calling thread. An owner's operator delete runs after
+		/// its members are destroyed, so it uses this to free the owner's memory in the right context.
+		static RuntimeContext *getDestroyed();
+
+	private:
+		RuntimeContext *_context;
+		RuntimeContext *_previous;
+		bool _destroying;
+
+		RuntimeContextOwner(const RuntimeContextOwner &);
+
+		RuntimeContextOwner &operator=(const RuntimeContextOwner &);
+	};
+}
+
+#endif /* Spine_RuntimeContext_h */
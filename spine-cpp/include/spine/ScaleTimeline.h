@@ -42,7 +42,6 @@ namespace spine {
 
 	public:
 		explicit ScaleTimeline(size_t frameCount, size_t bezierCount, int boneIndex);
-		explicit ScaleTimeline(size_t frameCount, int boneIndex);
 
 		virtual ~ScaleTimeline();
 
@@ -42,7 +42,6 @@ namespace spine {
 
 	public:
 		explicit ShearTimeline(size_t frameCount, size_t bezierCount, int boneIndex);
-		explicit ShearTimeline(size_t frameCount, int boneIndex);
 
 		virtual ~ShearTimeline();
 
@@ -36,6 +36,7 @@
 #include <spine/SpineString.h>
 #include <spine/Color.h>
 #include <spine/Physics.h>
+#include <spine/NameIndex.h>
 
 namespace spine {
 	class SkeletonData;
@@ -60,6 +61,12 @@ namespace spine {
 
     class SkeletonClipping;
 
+	class SkeletonPose;
+
+	class DirtyTracker;
+
+	class RuntimeContext;
+
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
@@ -117,6 +124,8 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class DirtyTracker;
+
 	public:
 		explicit Skeleton(SkeletonData *skeletonData);
 
@@ -136,6 +145,32 @@ namespace spine {
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// When true, updateWorldTransform(Physics) computes the world transforms of runs of bones several at a time using
+		/// a SkeletonPose. Default is false.
+		void setUsePose(bool usePose);
+
+		bool getUsePose() { return _pose != NULL; }
+
+		/// When true, updateWorldTransform(Physics) uses a DirtyTracker to recompute only the bones and constraints whose
+		/// world transform may have changed since the previous update, and falls back to a full update, which uses the
+		/// SkeletonPose if enabled, when that cannot be determined. Default is false.
+		void setIncrementalUpdate(bool incrementalUpdate);
+
+		bool getIncrementalUpdate() { return _dirtyTracker != NULL; }
+
+		/// @return May be NULL.
+		DirtyTracker *getDirtyTracker() { return _dirtyTracker; }
+
+		/// The context whose coordinate convention this skeleton uses. If NULL, Bone::isYDown is used.
+		/// @param context May be NULL.
+		void setRuntimeContext(RuntimeContext *context) { _context = context; }
+
+		/// @return May be NULL.
+		RuntimeContext *getRuntimeContext() { return _context; }
+
+		/// Whether the y-axis points down for this skeleton, see setRuntimeContext.
+		bool isYDown();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -263,6 +298,13 @@ namespace spine {
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		NameIndex _boneIndex, _slotIndex;
+		NameIndex _ikConstraintIndex, _transformConstraintIndex, _pathConstraintIndex, _physicsConstraintIndex;
+		SkeletonPose *_pose;
+		DirtyTracker *_dirtyTracker;
+		RuntimeContext *_context;
+
+		void updateAllWorldTransforms(Physics physics);
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonBatch_h
+#define Spine_SkeletonBatch_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+#include <spine/Physics.h>
+
+namespace spine {
+	class Skeleton;
+
+	class SkeletonData;
+
+	class AnimationState;
+
+	class AnimationStateData;
+
+	class TaskExecutor;
+
+	class RuntimeContext;
+
+	/// Owns a set of skeletons, each with an animation state, and advances all of them with one call to update. With a
+	/// TaskExecutor, such as a ThreadPool, the instances are split into groups of the grain size which are updated
+	/// concurrently, so idle threads pick up the remaining groups as others finish.
+	///
+	/// Instances may share SkeletonData and AnimationStateData. Animations loaded lazily must be decoded before update, which
+	/// AnimationState::setAnimation and addAnimation do. AnimationState listeners are called from the thread updating the
+	/// instance. The RuntimeContext current when update is called is also current on the threads updating the instances.
+	class SP_API SkeletonBatch : public SpineObject {
+	public:
+		/// @param executor May be NULL, in which case instances are updated on the calling thread.
+		explicit SkeletonBatch(TaskExecutor *executor = NULL);
+
+		/// Deletes the skeletons and animation states of all instances.
+		~SkeletonBatch();
+
+		/// Adds an instance, taking ownership of the skeleton and the animation state.
+		/// @return The index of the instance.
+		size_t add(Skeleton *skeleton, AnimationState *state);
+
+		/// Adds an instance with a new skeleton and animation state for the data.
+		/// @return The index of the instance.
+		size_t add(SkeletonData *skeletonData, AnimationStateData *stateData);
+
+		/// Deletes the skeleton and animation state of an instance. The last instance takes its index.
+		void remove(size_t index);
+
+		/// Deletes all instances.
+		void clear();
+
+		size_t size() { return _instances.size(); }
+
+		Skeleton *getSkeleton(size_t index) { return _instances[index].skeleton; }
+
+		AnimationState *getAnimationState(size_t index) { return _instances[index].state; }
+
+		/// For each instance, calls AnimationState::update, Skeleton::update, AnimationState::apply and
+		/// Skeleton::updateWorldTransform, returning once all instances are updated.
+		void update(float delta, Physics physics = Physics_Update);
+
+		/// @param executor May be NULL.
+		void setTaskExecutor(TaskExecutor *executor) { _executor = executor; }
+
+		TaskExecutor *getTaskExecutor() { return _executor; }
+
+		/// The number of instances updated by one task. Default is 8.
+		void setGrainSize(size_t grainSize) { _grainSize = grainSize > 0 ? grainSize : 1; }
+
+		size_t getGrainSize() { return _grainSize; }
+
+	private:
+		struct Instance {
+			Skeleton *skeleton;
+			AnimationState *state;
+		};
+
+		Vector<Instance> _instances;
+		TaskExecutor *_executor;
+		size_t _grainSize;
+		float _delta;
+		Physics _physics;
+		RuntimeContext *_context;
+
+		void updateRange(size_t start, size_t end);
+
+		static void updateTask(void *context, int index);
+	};
+}
+
+#endif /* Spine_SkeletonBatch_h */
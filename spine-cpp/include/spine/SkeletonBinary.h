@@ -64,6 +64,12 @@ namespace spine {
 
 	class Sequence;
 
+	class TaskExecutor;
+
+	class InternTable;
+
+	class RuntimeContext;
+
 	class SP_API SkeletonBinary : public SpineObject {
 	public:
 		explicit SkeletonBinary(Atlas *atlasArray);
@@ -78,17 +84,68 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// When enabled, readSkeletonDataFile maps the file read-only via SpineExtension::mapFile and
+		/// decodes directly from the mapping instead of reading it into a heap buffer first.
+		void setFileMapping(bool fileMapping) { _fileMapping = fileMapping; }
+
+		bool getFileMapping() { return _fileMapping; }
+
+		/// When enabled, animations are only indexed at load time and their timelines are decoded the first time they are
+		/// requested through SkeletonData::findAnimation or AnimationState. Until then, the animations returned by
+		/// SkeletonData::getAnimations have no timelines. See SkeletonData::decodeAnimation and SkeletonData::evictAnimation.
+		void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+
+		bool getLazyAnimations() { return _lazyAnimations; }
+
+		/// When set, animations and 4.2 skins are decoded concurrently on the executor. Linked meshes are still resolved
+		/// serially afterward. The attachment loader and the SpineExtension must be safe to call from several threads. The
+		/// executor is not owned. Ignored for lazily loaded animations.
+		void setTaskExecutor(TaskExecutor *executor) { _executor = executor; }
+
+		TaskExecutor *getTaskExecutor() { return _executor; }
+
+		/// When enabled, everything allocated while loading, including by the attachment loader, is placed in an Arena owned
+		/// by the returned SkeletonData and freed in one go when it is deleted. The data must then be treated as immutable:
+		/// adding to or resizing its vectors and strings is not supported. Lazily decoded animations are still allocated
+		/// individually.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		bool getUseArena() { return _useArena; }
+
+		/// When set, the names of bones, slots, constraints, skins, attachments, events and animations are interned in
+		/// the table, so skeletons loaded with the same table share them. The table is not owned and must outlive the
+		/// loaded skeleton data.
+		void setInternTable(InternTable *internTable) { _internTable = internTable; }
+
+		InternTable *getInternTable() { return _internTable; }
+
+		/// When set, the context is current while loading, so its SpineExtension allocates the skeleton data and reads
+		/// the file. Otherwise the context current on the calling thread is used. The context is not owned.
+		/// @param context May be NULL.
+		void setRuntimeContext(RuntimeContext *context) { _context = context; }
+
+		RuntimeContext *getRuntimeContext() { return _context; }
+
 		String &getError() { return _error; }
 
 	private:
 		AttachmentLoader *_attachmentLoader;
-        Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
 		const bool _ownsLoader;
+		bool _fileMapping;
+		bool _lazyAnimations;
+		bool _useArena;
+		TaskExecutor *_executor;
+		InternTable *_internTable;
+		RuntimeContext *_context;
 
 		void setError(const char *value1, const char *value2);
 
+		SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData);
+
+		SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData, Vector<LinkedMesh *> &linkedMeshes, String &error);
+
         char *readString(DataInput *input);
         int readInt(DataInput *input);
         int readVarint(DataInput *input, bool optimizePositive);
@@ -31,9 +31,12 @@
 #define Spine_SkeletonClipping_h
 
 #include <spine/Vector.h>
+#include <spine/HashMap.h>
 #include <spine/Triangulator.h>
 
 namespace spine {
+	class Bone;
+
 	class Slot;
 
 	class ClippingAttachment;
@@ -42,6 +45,8 @@ namespace spine {
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -65,7 +70,21 @@ namespace spine {
 
 		Vector<float> &getClippedUVs();
 
+		/// Discards the convex decompositions cached for clipping attachments that are bound rigidly to a single bone.
+		/// Call this when attachments seen by this clipper are disposed, to release the memory they hold in the cache.
+		void clearCache();
+
 	private:
+		/// The convex decomposition of a clipping polygon in the space of the bone it is bound to. Index 1 holds the
+		/// decomposition of the polygon mirrored on the x axis, used when the bone's world transform has a negative determinant.
+		class SP_API ClippingCache : public SpineObject {
+		public:
+			Vector<float> vertices;
+			Vector<float> polygons[2];
+			Vector<size_t> polygonEnds[2];
+			bool decomposed[2];
+		};
+
 		Triangulator _triangulator;
 		Vector<float> _clippingPolygon;
 		Vector<float> _clipOutput;
@@ -73,14 +92,33 @@ namespace spine {
 		Vector<unsigned short> _clippedTriangles;
 		Vector<float> _clippedUVs;
 		Vector<float> _scratch;
+		Vector<float> _clippingEdges;
+		Vector<size_t> _clippingEdgeEnds;
+		Vector<float> _clippingBounds;
+		Vector<float> _triangleCorners;
+		Vector<unsigned char> _triangleClasses;
+		Vector<int> _vertexRemap;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		Vector<Vector<float> *> _worldPolygons;
+		Pool<Vector<float> > _worldPolygonPool;
+		HashMap<ClippingAttachment *, ClippingCache *> _caches;
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
 		bool clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 				  Vector<float> *output);
 
+		/** Computes the edges and bounds of each convex clipping polygon once per clipStart. */
+		void computeClippingEdges();
+
+		/** Sorts each triangle into inside, outside or straddling for every convex clipping polygon. */
+		void classifyTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength, size_t stride);
+
+		void decompose(ClippingCache &cache, int mirror);
+
+		static Bone *computeLocalVertices(Slot &slot, ClippingAttachment &clip, Vector<float> &output);
+
 		static void makeClockwise(Vector<float> &polygon);
 	};
 }
@@ -32,6 +32,9 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/Arena.h>
+#include <spine/NameIndex.h>
+#include <spine/RuntimeContext.h>
 
 namespace spine {
 	class BoneData;
@@ -52,6 +55,8 @@ namespace spine {
 
     class PhysicsConstraintData;
 
+	class AnimationDecoder;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -62,12 +67,26 @@ namespace spine {
 
         #include <spine/skeleton-loader-impl/FriendAccess.txt>
 	public:
+		/// The data remembers the RuntimeContext current when it is created, which the loaders make the context they were
+		/// given. Lazy decoding, eviction and destruction happen in that context, whichever thread calls them.
 		SkeletonData();
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
-		/// It is more efficient to cache the results of this method than to call it multiple times.
+		void *operator new(size_t sz);
+
+		void *operator new(size_t sz, const char *file, int line);
+
+		void *operator new(size_t sz, void *ptr);
+
+		void operator delete(void *p);
+
+		void operator delete(void *p, const char *file, int line);
+
+		void operator delete(void *p, void *mem);
+
+		/// Finds a bone by name. The find methods use the indices built by buildIndices and never modify the data, so
+		/// they may be called from several threads at once.
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
 
@@ -80,9 +99,35 @@ namespace spine {
 		/// @return May be NULL.
 		spine::EventData *findEvent(const String &eventDataName);
 
+		/// Animations deferred by SkeletonBinary::setLazyAnimations are decoded on first use.
 		/// @return May be NULL.
 		Animation *findAnimation(const String &animationName);
 
+		/// Decodes the timelines of an animation deferred by SkeletonBinary::setLazyAnimations. Does nothing if the
+		/// animation is already decoded or was not loaded lazily. Decoding and eviction may be called from several threads
+		/// and are serialized.
+		/// @return False if the animation could not be decoded.
+		bool decodeAnimation(Animation *animation);
+
+		/// Frees the timelines of a lazily loaded animation, which are decoded again on next use. The animation must not
+		/// be in use by an AnimationState.
+		void evictAnimation(Animation *animation);
+
+		/// Evicts all lazily loaded animations. See evictAnimation().
+		void evictAnimations();
+
+		/// The arena holding this data when it was loaded with SkeletonBinary::setUseArena, or NULL.
+		Arena *getArena();
+
+		/// The context this data was loaded in.
+		/// @return May be NULL.
+		RuntimeContext *getRuntimeContext();
+
+		/// Indexes the bones, slots, skins, events, animations and constraints by name for the find methods. The loaders
+		/// call this once loading finishes. Call it again after adding or renaming items, else the find methods compare
+		/// the names of the items not indexed one by one. Must not be called while other threads use the find methods.
+		void buildIndices();
+
 		/// @return May be NULL.
 		IkConstraintData *findIkConstraint(const String &constraintName);
 
@@ -169,6 +214,8 @@ namespace spine {
 		void setFps(float inValue);
 
 	private:
+		RuntimeContextOwner _context; // Destroyed last, so everything is freed in the context it was allocated in.
+		ArenaOwner _arena; // Destroyed after the members that may live in the arena.
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
 		Vector<SlotData *> _slots; // Setup pose draw order.
@@ -185,11 +232,20 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		char *_stringPool;
+		AnimationDecoder *_animationDecoder;
 
 		// Nonessential.
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		NameIndex _boneIndex, _slotIndex, _skinIndex, _eventIndex, _animationIndex;
+		NameIndex _ikConstraintIndex, _transformConstraintIndex, _pathConstraintIndex, _physicsConstraintIndex;
+		bool _loading; // Set by the loaders so the find methods index items as they are added, until buildIndices.
+
+		/// Whether the animation is one of this data's animations deferred by SkeletonBinary::setLazyAnimations.
+		bool isLazy(Animation *animation);
 	};
 }
 
@@ -61,6 +61,10 @@ namespace spine {
 
 	class Sequence;
 
+	class InternTable;
+
+	class RuntimeContext;
+
 	class SP_API SkeletonJson : public SpineObject {
 	public:
 		explicit SkeletonJson(Atlas *atlas);
@@ -75,14 +79,29 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// When set, the names of bones, slots, constraints, skins, attachments, events and animations are interned in
+		/// the table, so skeletons loaded with the same table share them. The table is not owned and must outlive the
+		/// loaded skeleton data.
+		void setInternTable(InternTable *internTable) { _internTable = internTable; }
+
+		InternTable *getInternTable() { return _internTable; }
+
+		/// When set, the context is current while loading, so its SpineExtension allocates the skeleton data and reads
+		/// the file. Otherwise the context current on the calling thread is used. The context is not owned.
+		/// @param context May be NULL.
+		void setRuntimeContext(RuntimeContext *context) { _context = context; }
+
+		RuntimeContext *getRuntimeContext() { return _context; }
+
 		String &getError() { return _error; }
 
 	private:
 		AttachmentLoader *_attachmentLoader;
-		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
 		const bool _ownsLoader;
 		String _error;
+		InternTable *_internTable;
+		RuntimeContext *_context;
         void setError(Json *root, const String &value1, const String &value2);
 	};
 }
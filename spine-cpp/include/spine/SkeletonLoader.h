@@ -11,6 +11,8 @@
 #include <spine/DataInput.h>
 #include <spine/Color.h>
 
+#include <mutex>
+
 namespace spine {
     class SkeletonData;
 
@@ -37,6 +39,10 @@ namespace spine {
     class CurveTimeline2;
 
     class Sequence;
+
+    class TaskExecutor;
+
+    class InternTable;
     class ISkeletonBinaryLoader {
     public:
         static const int BONE_ROTATE = 0;
@@ -79,19 +85,50 @@ namespace spine {
         static const int CURVE_BEZIER = 2;
 
         ISkeletonBinaryLoader(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef)
-                : _attachmentLoader(loader), _linkedMeshes(meshes), _error(errStrRef), _scale(scaleRef){}
+                : _attachmentLoader(loader), _linkedMeshes(meshes), _error(errStrRef), _scale(scaleRef), _lazyAnimations(false), _executor(NULL), _internTable(NULL){}
         virtual ~ISkeletonBinaryLoader() = default;
         virtual SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData) = 0;
+        virtual Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) = 0;
+        /// Advances past an encoded animation without decoding it.
+        virtual void skipAnimation(DataInput *input, SkeletonData *skeletonData) = 0;
         String &getError() { return _error; }
+        void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+        void setTaskExecutor(TaskExecutor *executor) { _executor = executor; }
+        void setInternTable(InternTable *internTable) { _internTable = internTable; }
     protected:
         AttachmentLoader *_attachmentLoader;
         Vector<LinkedMesh *>& _linkedMeshes;
         String& _error;
         float& _scale;
+        Vector<char> _scratch;
+        bool _lazyAnimations;
+        TaskExecutor *_executor;
+        InternTable *_internTable;
         void setError(const char *value1, const char *value2);
 
+        /// Reads the animations. With lazy animations only the names are read and the encoded animations are kept by
+        /// an AnimationDecoder until SkeletonData::decodeAnimation is called.
+        bool readAnimations(DataInput *input, SkeletonData *skeletonData);
+        /// Indexes the animations, then decodes them on the task executor, each with its own loader.
+        bool readAnimationsParallel(DataInput *input, SkeletonData *skeletonData, int animationsCount);
+        struct AnimationTasks;
+        static void readAnimationTask(void *context, int index);
+        void skipString(DataInput *input);
+        /// Skips a 4.x curve timeline whose frames are a time followed by valueSize bytes, with bezierValues curves per frame.
+        void skipCurveTimeline(DataInput *input, int frameCount, int valueSize, int bezierValues);
+
         char *readString(DataInput *input);
+        /// Reads a string into a buffer that is reused by the next call. Returns NULL for null strings.
+        const char *readScratchString(DataInput *input);
+        /// Reads the string table into a single allocation owned by the skeleton data.
+        void readStrings(DataInput *input, SkeletonData *skeletonData);
         char *readStringRef(DataInput *input, SkeletonData *skeletonData);
+        /// Reads a name into the scratch buffer and interns it if an intern table is set. Without one, the returned
+        /// string borrows the scratch buffer and must be copied before the next read.
+        String readName(DataInput *input);
+        /// Reads a reference to the string table and interns it if an intern table is set. Without one, the returned
+        /// string borrows the string table.
+        String readNameRef(DataInput *input, SkeletonData *skeletonData);
         float readFloat(DataInput *input);
         unsigned char readByte(DataInput *input);
         signed char readSByte(DataInput *input);
@@ -101,26 +138,58 @@ namespace spine {
         int readVarint(DataInput *input, bool optimizePositive);
         void readFloatArray(DataInput *input, int n, float scale, Vector<float>& array);
         void readShortArray(DataInput *input, Vector<unsigned short>& array);
+        /// Reads n big-endian floats multiplied by scale, byte swapping whole runs at once where SIMD is available.
+        void readFloats(DataInput *input, float *values, int n, float scale);
+        /// Reads n big-endian unsigned shorts, byte swapping whole runs at once where SIMD is available.
+        void readShorts(DataInput *input, unsigned short *values, int n);
     };
 
     class ISkeletonJsonLoader {
     public:
         ISkeletonJsonLoader(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef)
-                : _attachmentLoader(loader), _linkedMeshes(meshes), _error(errStrRef), _scale(scaleRef){}
+                : _attachmentLoader(loader), _linkedMeshes(meshes), _error(errStrRef), _scale(scaleRef), _internTable(NULL){}
         virtual ~ISkeletonJsonLoader() = default;
         virtual SkeletonData *readSkeleton(Json *json, SkeletonData *skeletonData) = 0;
         String &getError() { return _error; }
+        void setInternTable(InternTable *internTable) { _internTable = internTable; }
     protected:
         AttachmentLoader *_attachmentLoader;
         Vector<LinkedMesh *>& _linkedMeshes;
         String& _error;
         float& _scale;
+        InternTable *_internTable;
         void setError(Json *root, const String &value1, const String &value2);
+        /// Interns a name if an intern table is set. Without one, the returned string borrows chars.
+        String intern(const char *chars);
 
         static float toColor(const char *value, size_t index);
         static void toColor(Color &color, const char *value, bool hasAlpha);
     };
 
+    /// Keeps the encoded animations of a binary skeleton so they can be decoded on first use and evicted again. Decoding
+    /// and eviction are serialized, as they share the loader.
+    class AnimationDecoder : public SpineObject {
+        friend class ISkeletonBinaryLoader;
+    public:
+        AnimationDecoder(const String &version, float scale, const unsigned char *data, size_t length);
+        ~AnimationDecoder();
+        /// Decodes the timelines of the skeleton data's animation at the given index. Returns false on error.
+        bool decode(SkeletonData *skeletonData, size_t index);
+        /// Frees the timelines of the skeleton data's animation at the given index.
+        void evict(SkeletonData *skeletonData, size_t index);
+        String &getError() { return _error; }
+    private:
+        Vector<LinkedMesh *> _linkedMeshes;
+        String _error;
+        float _scale;
+        ISkeletonBinaryLoader *_loader;
+        unsigned char *_data;
+        size_t _length;
+        Vector<size_t> _offsets;
+        Vector<bool> _decoded;
+        std::mutex _mutex;
+    };
+
     class SkeletonLoaderFactory {
     public:
         static ISkeletonBinaryLoader* CreateBinaryLoader(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, const String& version, float& scaleRef, String& errStrRef);
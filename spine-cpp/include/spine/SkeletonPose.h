@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonPose_h
+#define Spine_SkeletonPose_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+#include <spine/Physics.h>
+
+namespace spine {
+	class Bone;
+
+	class Skeleton;
+
+	/// Structure of arrays storage for the transforms of the bones in a skeleton's update cache, used to compute world
+	/// transforms several bones at a time with SIMD.
+	///
+	/// Consecutive bones in the update cache, with no constraint between them, form a run. Within a run the bones are
+	/// ordered by depth, so the bones of one depth only depend on bones computed before them. For each depth the applied
+	/// transforms of the bones and the world transforms of their parents are gathered into contiguous arrays, the world
+	/// transforms of the bones that inherit Inherit_Normal are computed from them, and the results are written back to the
+	/// bones. Bones with any other inherit mode, and everything outside the runs, are updated as usual.
+	///
+	/// The bones remain the storage that constraints, timelines and attachments read, so a skeleton's pose is the same
+	/// with or without a SkeletonPose, up to rounding in the sine and cosine.
+	class SP_API SkeletonPose : public SpineObject {
+	public:
+		SkeletonPose();
+
+		/// Finds the runs in the skeleton's update cache. Must be called whenever the update cache changes. Skeleton does
+		/// this in updateCache, and update rebuilds the runs if the size of the update cache has changed since.
+		void build(Skeleton &skeleton);
+
+		/// Updates everything in the skeleton's update cache, in the same way as Updatable::update.
+		void update(Skeleton &skeleton, Physics physics);
+
+		/// The number of bones in runs.
+		size_t getBoneCount() { return _bones.size(); }
+
+	private:
+		enum Field {
+			Field_X, Field_Y, Field_Rotation, Field_ScaleX, Field_ScaleY, Field_ShearX, Field_ShearY,
+			Field_ParentA, Field_ParentB, Field_ParentC, Field_ParentD, Field_ParentWorldX, Field_ParentWorldY,
+			Field_A, Field_B, Field_C, Field_D, Field_WorldX, Field_WorldY,
+			Field_Count
+		};
+
+		struct Run {
+			size_t start, end;// Indices in the update cache.
+			size_t firstDepth, lastDepth;// Indices in _depths.
+		};
+
+		Vector<Run> _runs;
+		Vector<size_t> _depths;// The first index in _bones of each depth of each run.
+		Vector<Bone *> _bones;
+		Vector<float> _values;// Field_Count arrays of _stride floats.
+		size_t _stride;
+		size_t _updateCacheSize;
+
+		float *field(Field field) { return _values.buffer() + field * _stride; }
+
+		void updateDepth(size_t start, size_t end, Physics physics);
+
+		static void computeWorldTransforms(float **fields, size_t start, size_t end);
+	};
+}
+
+#endif /* Spine_SkeletonPose_h */
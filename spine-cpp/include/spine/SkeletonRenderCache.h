@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonRenderCache_h
+#define Spine_SkeletonRenderCache_h
+
+#include <spine/SkeletonRenderer.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class Skeleton;
+
+	/// Stores the SkeletonRenderer output for every frame of an animation at a fixed rate, so instances that only loop the
+	/// animation, such as characters in the background, can be drawn without posing, constraints, skinning or clipping.
+	///
+	/// Baking poses the skeleton at each frame from the setup pose, updates physics by the frame duration and renders it.
+	/// Playback picks the frame nearest to the time and returns its batched render commands. Vertex data and indices of a
+	/// command that are unchanged from the same command in the previous frame are stored once.
+	///
+	/// Positions can be quantized to 16 bits relative to each frame's bounds, which halves their size. Quantized positions
+	/// are decoded into a buffer owned by the cache on each call to render, so the returned commands are only valid until
+	/// the next call and a quantized cache must not be rendered from more than one thread at a time. Unquantized frames
+	/// are returned as stored. getMemorySize() and getQuantizationError() report the cost and the loss.
+	class SP_API SkeletonRenderCache : public SpineObject {
+	public:
+		/// Bakes the animation as the skeleton renders it with its current skin, color, position and scale. The skeleton is
+		/// left posed at the last frame. An animation loaded lazily is decoded first.
+		/// @param fps The frames per second of animation time.
+		/// @param quantize If true, positions are stored as 16 bit values.
+		SkeletonRenderCache(Skeleton &skeleton, Animation &animation, float fps, bool quantize = false);
+
+		~SkeletonRenderCache();
+
+		float getFps() { return _fps; }
+
+		/// The number of frames, from 0 to the animation duration.
+		size_t getFrameCount() { return _frameCommands.size() - 1; }
+
+		bool isQuantized() { return _quantized; }
+
+		/// The number of bytes used by the frames.
+		size_t getMemorySize();
+
+		/// The largest difference between a quantized position and the rendered position, in world units. 0 if positions
+		/// are not quantized.
+		float getQuantizationError() { return _quantizationError; }
+
+		/// Returns the render commands of the frame nearest to the animation time, or NULL if nothing is drawn.
+		/// @param loop If true, the time wraps around the animation duration, else it is clamped.
+		RenderCommand *render(float time, bool loop);
+
+		/// Returns the render commands of the frame, or NULL if nothing is drawn.
+		RenderCommand *renderFrame(size_t frame);
+
+	private:
+		float _fps, _duration;
+		bool _quantized;
+		float _quantizationError;
+		Vector<RenderCommand> _commands;
+		Vector<size_t> _frameCommands;// Index of each frame's first command, followed by the command count.
+		Vector<float> _floats;// Positions and UVs.
+		Vector<uint32_t> _colors;// Colors and dark colors.
+		Vector<uint16_t> _indices;
+		Vector<uint16_t> _quantizedPositions;
+		Vector<size_t> _quantizedOffsets;// Per command when quantized.
+		Vector<float> _bounds;// Per frame when quantized: x, y, width / 65535, height / 65535.
+		Vector<float> _positions;// Decoded positions of the last quantized frame rendered.
+	};
+}
+
+#endif /* Spine_SkeletonRenderCache_h */
@@ -32,10 +32,17 @@
 #include <spine/BlockAllocator.h>
 #include <spine/BlendMode.h>
 #include <spine/SkeletonClipping.h>
+#include <spine/VertexLayout.h>
 
 namespace spine {
     class Skeleton;
 
+    class Slot;
+
+    class RegionAttachment;
+
+    class MeshAttachment;
+
     struct SP_API RenderCommand {
         float *positions;
         float *uvs;
@@ -49,6 +56,99 @@ namespace spine {
         RenderCommand *next;
     };
 
+    /// Storage handed out by a RenderSink for the vertices and indices of one slot. If the sink has a vertex layout,
+    /// the vertices are written to interleaved instead of the separate arrays.
+    struct SP_API RenderVertices {
+        float *positions;
+        float *uvs;
+        uint32_t *colors;
+        uint32_t *darkColors;
+        void *interleaved;
+        uint16_t *indices;
+    };
+
+    /// Receives the output of SkeletonRenderer::render(Skeleton &, RenderSink &, bool), so vertices are written once,
+    /// straight into memory the sink provides, instead of into render commands that are then copied.
+    class SP_API RenderSink : public SpineObject {
+    public:
+        virtual ~RenderSink() {}
+
+        /// Returns storage for the vertices and indices of the next slot, which are appended to the current draw.
+        /// Indices written are relative to the first vertex of the draw. If false is returned the slot is not written,
+        /// but its vertices and indices are still counted in the draw.
+        virtual bool allocate(int32_t numVertices, int32_t numIndices, RenderVertices &vertices) = 0;
+
+        /// Ends the current draw, which is made of everything allocated since the previous draw.
+        virtual void draw(BlendMode blendMode, void *texture, int32_t numVertices, int32_t numIndices) = 0;
+
+        /// Returns the layout of interleaved vertices, or NULL to write separate arrays. It is read once per render.
+        virtual const VertexLayout *getVertexLayout() { return NULL; }
+    };
+
+    /// A draw written by a RenderBufferSink, referencing a range of its vertices and indices.
+    struct SP_API RenderDraw {
+        BlendMode blendMode;
+        void *texture;
+        int32_t firstVertex;
+        int32_t numVertices;
+        int32_t firstIndex;
+        int32_t numIndices;
+    };
+
+    /// A RenderSink that writes into fixed arrays provided by the caller, eg mapped GPU buffers. When the arrays are too
+    /// small, or none were set, nothing is written but the vertices and indices needed are still counted, so a render
+    /// with no buffers can be used to query the capacity to allocate.
+    class SP_API RenderBufferSink : public RenderSink {
+    public:
+        RenderBufferSink();
+
+        /// Sets the arrays to write into and clears the sink. Positions and uvs hold 2 floats per vertex.
+        void setBuffers(float *positions, float *uvs, uint32_t *colors, uint32_t *darkColors, int32_t vertexCapacity,
+                        uint16_t *indices, int32_t indexCapacity);
+
+        /// Sets an array of interleaved vertices described by the layout to write into, and clears the sink. The array
+        /// must be aligned to 4 bytes.
+        void setBuffers(void *vertices, const VertexLayout &layout, int32_t vertexCapacity, uint16_t *indices,
+                        int32_t indexCapacity);
+
+        /// Removes all draws, so the next render writes from the start of the arrays.
+        void clear();
+
+        virtual bool allocate(int32_t numVertices, int32_t numIndices, RenderVertices &vertices);
+
+        virtual void draw(BlendMode blendMode, void *texture, int32_t numVertices, int32_t numIndices);
+
+        virtual const VertexLayout *getVertexLayout();
+
+        Vector<RenderDraw> &getDraws();
+
+        /// The number of vertices rendered since the sink was cleared, including any that did not fit.
+        int32_t getNumVertices();
+
+        /// The number of indices rendered since the sink was cleared, including any that did not fit.
+        int32_t getNumIndices();
+
+        /// True if the arrays were too small for some of the vertices or indices, which are then missing from the output.
+        bool isOverflowed();
+
+    private:
+        float *_positions;
+        float *_uvs;
+        uint32_t *_colors;
+        uint32_t *_darkColors;
+        uint8_t *_vertices;
+        VertexLayout _layout;
+        uint16_t *_indices;
+        int32_t _vertexCapacity;
+        int32_t _indexCapacity;
+        int32_t _numVertices;
+        int32_t _numIndices;
+        int32_t _drawVertex;
+        int32_t _drawIndex;
+        bool _overflowed;
+        Vector<RenderDraw> _draws;
+    };
+
     class SP_API SkeletonRenderer: public SpineObject {
     public:
         explicit SkeletonRenderer();
@@ -56,13 +156,44 @@ namespace spine {
         ~SkeletonRenderer();
 
         RenderCommand *render(Skeleton &skeleton);
+
+        /// Renders the skeleton into the sink without creating render commands. If batch is true, consecutive slots that
+        /// could be drawn together are merged into one draw, as render(Skeleton &) does for its commands, else each slot
+        /// is a separate draw.
+        void render(Skeleton &skeleton, RenderSink &sink, bool batch = true);
+
+        /// Discards the convex decompositions cached for the clipping attachments rendered so far, see
+        /// SkeletonClipping::clearCache(). A renderer that outlives the skeleton data it renders should call this when
+        /// that data is disposed, else the cache keeps growing.
+        void clearCache();
     private:
+        struct SlotGeometry {
+            RegionAttachment *region;
+            MeshAttachment *mesh;
+            Vector<float> *positions;
+            Vector<float> *uvs;
+            Vector<unsigned short> *indices;
+            int32_t numVertices;
+            int32_t numIndices;
+            uint32_t color;
+            uint32_t darkColor;
+            BlendMode blendMode;
+            void *texture;
+        };
+
         BlockAllocator _allocator;
         Vector<float> _worldVertices;
         Vector<unsigned short> _quadIndices;
         SkeletonClipping _clipping;
         Vector<RenderCommand *> _renderCommands;
+
+        /// Returns false if the slot draws nothing. Positions are left NULL when they can be computed straight into
+        /// the output, else they are the clipped vertices, which are valid until the clipper is told the slot ended.
+        bool prepareSlot(Skeleton &skeleton, Slot &slot, SlotGeometry &geometry);
+
+        void writeSlot(Slot &slot, SlotGeometry &geometry, RenderVertices &vertices, int32_t firstVertex,
+                       const VertexLayout *layout);
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonSnapshot_h
+#define Spine_SkeletonSnapshot_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Atlas;
+
+	class AttachmentLoader;
+
+	class Attachment;
+
+	class Skin;
+
+	class Animation;
+
+	class Timeline;
+
+	class InternTable;
+
+	class RuntimeContext;
+
+	/// Writes and reads snapshots: SkeletonData that was already loaded by SkeletonBinary or SkeletonJson, stored in a
+	/// flat native layout. All references are indices, strings are pooled and frame and vertex data is stored as raw
+	/// floats, so reading a snapshot is mostly bulk copies and a single pass that resolves the indices. Snapshots can be
+	/// written from data of any supported version, 3.8 through 4.2.
+	///
+	/// Snapshots hold scaled data and use the byte order and float format of the machine that wrote them. They are meant
+	/// to be built for a target as part of the content pipeline and to be rebuilt when the runtime changes:
+	/// readSnapshotData rejects snapshots written by another snapshot format version or byte order.
+	class SP_API SkeletonSnapshot : public SpineObject {
+	public:
+		static const int FORMAT_VERSION = 2;
+
+		explicit SkeletonSnapshot(Atlas *atlasArray);
+
+		explicit SkeletonSnapshot(AttachmentLoader *attachmentLoader, bool ownsLoader = false);
+
+		~SkeletonSnapshot();
+
+		/// Appends a snapshot of the skeleton data to output. Lazily loaded animations are decoded first.
+		/// @return False if the data could not be written, see getError().
+		bool writeSnapshot(SkeletonData *skeletonData, Vector<unsigned char> &output);
+
+		/// Whether the data starts with a snapshot header.
+		static bool isSnapshot(const unsigned char *data, int length);
+
+		SkeletonData *readSnapshotData(const unsigned char *data, int length);
+
+		/// Maps the file via SpineExtension::mapFile and reads the snapshot directly from the mapping.
+		SkeletonData *readSnapshotDataFile(const String &path);
+
+		/// See SkeletonBinary::setUseArena.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		bool getUseArena() { return _useArena; }
+
+		/// See SkeletonBinary::setInternTable.
+		void setInternTable(InternTable *internTable) { _internTable = internTable; }
+
+		InternTable *getInternTable() { return _internTable; }
+
+		/// See SkeletonBinary::setRuntimeContext.
+		void setRuntimeContext(RuntimeContext *context) { _context = context; }
+
+		RuntimeContext *getRuntimeContext() { return _context; }
+
+		String &getError() { return _error; }
+
+	private:
+		struct Output;
+
+		struct Input;
+
+		AttachmentLoader *_attachmentLoader;
+		String _error;
+		const bool _ownsLoader;
+		bool _useArena;
+		InternTable *_internTable;
+		RuntimeContext *_context;
+
+		void setError(const char *value1, const char *value2);
+
+		/// Interns a name if an intern table is set. Without one, the returned string borrows chars.
+		String intern(const char *chars);
+
+		SkeletonData *readSnapshot(const unsigned char *data, int length, SkeletonData *skeletonData, String &error);
+
+		Skin *readSkin(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments, Vector<int> &links, String &error);
+
+		Attachment *readAttachment(Input &input, Skin *skin, SkeletonData *skeletonData, Vector<Attachment *> &attachments, Vector<int> &links, String &error);
+
+		Animation *readAnimation(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments, String &error);
+
+		Timeline *readTimeline(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments);
+
+		bool writeSkin(Output &output, Skin *skin, SkeletonData *skeletonData);
+
+		bool writeAttachment(Output &output, Attachment *attachment);
+
+		bool writeTimeline(Output &output, Timeline *timeline, SkeletonData *skeletonData);
+	};
+}
+
+#endif /* Spine_SkeletonSnapshot_h */
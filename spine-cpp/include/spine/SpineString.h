@@ -37,39 +37,39 @@
 #include <stdio.h>
 
 namespace spine {
+	class InternTable;
+
+	/// Strings shorter than 16 characters are stored inline, without a heap allocation. Strings returned by
+	/// InternTable::intern share their characters when copied, and two strings interned in the same table are compared
+	/// by pointer.
 	class SP_API String : public SpineObject {
 	public:
-		String() : _length(0), _buffer(NULL), _tempowner(true) {
+		String() : _length(0), _mode(Mode_Owned), _buffer(NULL) {
 		}
 
-		String(const char *chars, bool own = false, bool tofree = true) {
-			_tempowner = tofree;
-			if (!chars) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
+		String(const char *chars, bool own = false, bool tofree = true) : _length(0), _mode(Mode_Owned), _buffer(NULL) {
+			if (!chars) return;
+			if (own) {
 				_length = strlen(chars);
-				if (!own) {
-					_buffer = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
-					memcpy((void *) _buffer, chars, _length + 1);
-				} else {
-					_buffer = (char *) chars;
-				}
+				_buffer = (char *) chars;
+				_mode = tofree ? Mode_Owned : Mode_Borrowed;
+			} else {
+				set(chars, strlen(chars));
 			}
 		}
 
-		String(const String &other) {
-			_tempowner = true;
-			if (!other._buffer) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
-				_length = other._length;
-				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, other._buffer, other._length + 1);
+		String(const String &other) : _length(0), _mode(Mode_Owned), _buffer(NULL) {
+			if (other._mode == Mode_Interned) {
+				share(other);
+			} else if (other.buffer()) {
+				set(other.buffer(), other._length);
 			}
 		}
 
+		String(String &&other) : _length(0), _mode(Mode_Owned), _buffer(NULL) {
+			take(other);
+		}
+
 		size_t length() const {
 			return _length;
 		}
@@ -79,26 +79,24 @@ namespace spine {
 		}
 
 		const char *buffer() const {
-			return _buffer;
+			return _mode == Mode_Inline ? _inline : _buffer;
+		}
+
+		/// Whether the characters are owned by an InternTable.
+		bool isInterned() const {
+			return _mode == Mode_Interned;
 		}
 
 		void own(const String &other) {
 			if (this == &other) return;
-			if (_buffer && _tempowner) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-			_length = other._length;
-			_buffer = other._buffer;
-			other._length = 0;
-			other._buffer = NULL;
+			release();
+			take(other);
 		}
 
 		void own(const char *chars) {
-			if (_buffer == chars) return;
-			if (_buffer && _tempowner) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-
+			if (buffer() == chars) return;
+			release();
+			_mode = Mode_Owned;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -110,59 +108,48 @@ namespace spine {
 
 		void unown() {
 			_length = 0;
+			_mode = Mode_Owned;
 			_buffer = NULL;
 		}
 
 		String &operator=(const String &other) {
 			if (this == &other) return *this;
-			if (_buffer && _tempowner) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-			if (!other._buffer) {
-				_length = 0;
-				_buffer = NULL;
+			if (other._mode == Mode_Interned) {
+				release();
+				share(other);
+			} else if (!other.buffer()) {
+				release();
+				unown();
 			} else {
-				_length = other._length;
-				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, other._buffer, other._length + 1);
+				set(other.buffer(), other._length);
 			}
 			return *this;
 		}
 
+		String &operator=(String &&other) {
+			if (this == &other) return *this;
+			release();
+			take(other);
+			return *this;
+		}
+
 		String &operator=(const char *chars) {
-			if (_buffer == chars) return *this;
-			if (_buffer && _tempowner) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
+			if (buffer() == chars) return *this;
 			if (!chars) {
-				_length = 0;
-				_buffer = NULL;
+				release();
+				unown();
 			} else {
-				_length = strlen(chars);
-				_buffer = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, chars, _length + 1);
+				set(chars, strlen(chars));
 			}
 			return *this;
 		}
 
 		String &append(const char *chars) {
-			size_t len = strlen(chars);
-			size_t thisLen = _length;
-			_length = _length + len;
-			bool same = chars == _buffer;
-			_buffer = SpineExtension::realloc(_buffer, _length + 1, __FILE__, __LINE__);
-			memcpy((void *) (_buffer + thisLen), (void *) (same ? _buffer : chars), len + 1);
-			return *this;
+			return append(chars, strlen(chars));
 		}
 
 		String &append(const String &other) {
-			size_t len = other.length();
-			size_t thisLen = _length;
-			_length = _length + len;
-			bool same = other._buffer == _buffer;
-			_buffer = SpineExtension::realloc(_buffer, _length + 1, __FILE__, __LINE__);
-			memcpy((void *) (_buffer + thisLen), (void *) (same ? _buffer : other._buffer), len + 1);
-			return *this;
+			return append(other.buffer(), other.length());
 		}
 
 		String &append(int other) {
@@ -198,31 +185,26 @@ namespace spine {
             if (startIndex < 0 || startIndex >= (int)_length || length < 0 || startIndex + length > (int)_length) {
                 return String();
             }
-            char* subStr = SpineExtension::calloc<char>(length + 1, __FILE__, __LINE__);
-            memcpy(subStr, _buffer + startIndex, length);
-            subStr[length] = '\0';
-            return String(subStr, true, true);
+            String subStr;
+            subStr.set(buffer() + startIndex, length);
+            return subStr;
         }
 
         String substring(int startIndex) const {
             if (startIndex < 0 || startIndex >= (int)_length) {
                 return String();
             }
-            int length = (int)_length - startIndex;
-            char* subStr = SpineExtension::calloc<char>(length + 1, __FILE__, __LINE__);
-            memcpy(subStr, _buffer + startIndex, length);
-            subStr[length] = '\0';
-            return String(subStr, true, true);
+            return substring(startIndex, (int)_length - startIndex);
         }
 
 		friend bool operator==(const String &a, const String &b) {
-			if (a._buffer == b._buffer) return true;
-			if (a._length != b._length) return false;
-			if (a._buffer && b._buffer) {
-				return strcmp(a._buffer, b._buffer) == 0;
-			} else {
+			const char *aChars = a.buffer(), *bChars = b.buffer();
+			if (aChars == bChars) return true;
+			if (a._length != b._length || !aChars || !bChars) return false;
+			// An InternTable keeps one copy of each string, so different pointers from the same table differ.
+			if (a._mode == Mode_Interned && b._mode == Mode_Interned && internTableOf(aChars) == internTableOf(bChars))
 				return false;
-			}
+			return memcmp(aChars, bChars, a._length) == 0;
 		}
 
 		friend bool operator!=(const String &a, const String &b) {
@@ -230,15 +212,111 @@ namespace spine {
 		}
 
 		~String() {
-			if (_buffer && _tempowner) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
+			release();
 		}
 
 	private:
-		mutable size_t _length;
-		mutable char *_buffer;
-		mutable bool _tempowner;
+		friend class InternTable;
+
+		static const size_t INLINE_CAPACITY = 16;
+
+		enum Mode {
+			/// The characters are in _inline.
+			Mode_Inline,
+			/// _buffer is NULL or was allocated with the SpineExtension and is freed with the string.
+			Mode_Owned,
+			/// _buffer belongs to someone else. Copies, including moves, get their own characters.
+			Mode_Borrowed,
+			/// _buffer belongs to an InternTable, whose address is stored in front of the characters. Copies share it.
+			Mode_Interned
+		};
+
+		mutable unsigned int _length;
+		mutable unsigned char _mode;
+		union {
+			mutable char *_buffer;
+			mutable char _inline[INLINE_CAPACITY];
+		};
+
+		static const InternTable *internTableOf(const char *chars) {
+			return ((const InternTable *const *) chars)[-1];
+		}
+
+		void release() {
+			if (_mode == Mode_Owned && _buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+		}
+
+		void share(const String &other) {
+			_length = other._length;
+			_mode = Mode_Interned;
+			_buffer = other._buffer;
+		}
+
+		// Moves the characters of other, which must not be this string, and leaves other empty. Borrowed characters are
+		// copied, so they never outlive the string that borrowed them.
+		void take(const String &other) {
+			_length = other._length;
+			_mode = other._mode;
+			if (other._mode == Mode_Inline)
+				memcpy(_inline, other._inline, other._length + 1);
+			else if (other._mode == Mode_Borrowed)
+				set(other._buffer, other._length);
+			else
+				_buffer = other._buffer;
+			other._length = 0;
+			other._mode = Mode_Owned;
+			other._buffer = NULL;
+		}
+
+		// Replaces the contents with a copy of length characters, which may point into this string.
+		void set(const char *chars, size_t length) {
+			if (length < INLINE_CAPACITY) {
+				char copy[INLINE_CAPACITY];
+				memcpy(copy, chars, length);
+				copy[length] = '\0';
+				release();
+				memcpy(_inline, copy, length + 1);
+				_mode = Mode_Inline;
+			} else {
+				char *copy = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+				memcpy(copy, chars, length);
+				copy[length] = '\0';
+				release();
+				_buffer = copy;
+				_mode = Mode_Owned;
+			}
+			_length = (unsigned int) length;
+		}
+
+		String &append(const char *chars, size_t length) {
+			size_t newLength = _length + length;
+			if (newLength < INLINE_CAPACITY) {
+				char copy[INLINE_CAPACITY];
+				if (_length > 0) memcpy(copy, buffer(), _length);
+				if (length > 0) memcpy(copy + _length, chars, length);
+				copy[newLength] = '\0';
+				release();
+				memcpy(_inline, copy, newLength + 1);
+				_mode = Mode_Inline;
+			} else if (_mode == Mode_Owned && _buffer) {
+				// chars might point into this buffer, which moves when we reallocate.
+				bool inside = chars >= _buffer && chars <= _buffer + _length;
+				size_t offset = inside ? chars - _buffer : 0;
+				_buffer = SpineExtension::realloc(_buffer, newLength + 1, __FILE__, __LINE__);
+				if (length > 0) memcpy(_buffer + _length, inside ? _buffer + offset : chars, length);
+				_buffer[newLength] = '\0';
+			} else {
+				char *copy = SpineExtension::alloc<char>(newLength + 1, __FILE__, __LINE__);
+				if (_length > 0) memcpy(copy, buffer(), _length);
+				if (length > 0) memcpy(copy + _length, chars, length);
+				copy[newLength] = '\0';
+				release();
+				_buffer = copy;
+				_mode = Mode_Owned;
+			}
+			_length = (unsigned int) newLength;
+			return *this;
+		}
 	};
 }
 
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TaskExecutor_h
+#define Spine_TaskExecutor_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Runs batches of independent tasks. Implement this to run work on an existing job system, or use ThreadPool.
+	class SP_API TaskExecutor : public SpineObject {
+	public:
+		typedef void (*TaskFunction)(void *context, int index);
+
+		virtual ~TaskExecutor();
+
+		/// Calls function(context, index) for every index in [0, count), possibly concurrently, and returns once all
+		/// calls have completed. Whether a task may call run on the executor running it depends on the implementation.
+		virtual void run(TaskFunction function, void *context, int count) = 0;
+	};
+
+	/// A TaskExecutor backed by a fixed set of worker threads. The calling thread also runs tasks while it waits for a
+	/// batch to complete. Batches submitted from several threads are run one after another. A batch submitted from one of
+	/// the pool's own tasks runs on the thread running that task.
+	class SP_API ThreadPool : public TaskExecutor {
+	public:
+		/// @param threadCount The number of worker threads. If 0, one less than the number of hardware threads is used.
+		explicit ThreadPool(int threadCount = 0);
+
+		virtual ~ThreadPool();
+
+		virtual void run(TaskFunction function, void *context, int count);
+
+		int getThreadCount();
+
+	private:
+		struct State;
+
+		State *_state;
+	};
+}
+
+#endif /* Spine_TaskExecutor_h */
@@ -43,7 +43,6 @@ namespace spine {
 
 	public:
 		explicit TransformConstraintTimeline(size_t frameCount, size_t bezierCount, int transformConstraintIndex);
-		explicit TransformConstraintTimeline(size_t frameCount, int transformConstraintIndex);
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
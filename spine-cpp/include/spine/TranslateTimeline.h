@@ -46,7 +46,6 @@ namespace spine {
 
 	public:
 		explicit TranslateTimeline(size_t frameCount, size_t bezierCount, int boneIndex);
-		explicit TranslateTimeline(size_t frameCount, int boneIndex);
 
 		virtual ~TranslateTimeline();
 
@@ -34,8 +34,13 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <assert.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
 
 namespace spine {
+	/// Elements are relocated with realloc when the vector grows, so T must not depend on its own address. Trivially
+	/// copyable element types are copied and moved with memcpy and memmove.
 	template<typename T>
 	class SP_API Vector : public SpineObject {
 	public:
@@ -48,20 +53,26 @@ namespace spine {
 		Vector(const Vector &inVector) : _size(inVector._size), _capacity(inVector._capacity), _buffer(NULL) {
 			if (_capacity > 0) {
 				_buffer = allocate(_capacity);
-				for (size_t i = 0; i < _size; ++i) {
-					construct(_buffer + i, inVector._buffer[i]);
-				}
+				copyConstruct(_buffer, inVector._buffer, _size);
 			}
 		}
 
+		Vector(Vector &&inVector) : _size(inVector._size), _capacity(inVector._capacity), _buffer(inVector._buffer) {
+			inVector._size = 0;
+			inVector._capacity = 0;
+			inVector._buffer = NULL;
+		}
+
 		~Vector() {
 			clear();
 			deallocate(_buffer);
 		}
 
 		inline void clear() {
-			for (size_t i = 0; i < _size; ++i) {
-				destroy(_buffer + (_size - 1 - i));
+			if (!std::is_trivially_destructible<T>::value) {
+				for (size_t i = 0; i < _size; ++i) {
+					destroy(_buffer + (_size - 1 - i));
+				}
 			}
 
 			_size = 0;
@@ -92,7 +103,7 @@ namespace spine {
 				for (size_t i = oldSize; i < _size; i++) {
 					construct(_buffer + i, defaultValue);
 				}
-			} else {
+			} else if (!std::is_trivially_destructible<T>::value) {
 				for (size_t i = _size; i < oldSize; i++) {
 					destroy(_buffer + i);
 				}
@@ -107,25 +118,46 @@ namespace spine {
 
 		inline void add(const T &inValue) {
 			if (_size == _capacity) {
-				// inValue might reference an element in this buffer
-				// When we reallocate, the reference becomes invalid.
-				// We thus need to create a defensive copy before
-				// reallocating.
-				T valueCopy = inValue;
-				_capacity = (int) (_size * 1.75f);
-				if (_capacity < 8) _capacity = 8;
-				_buffer = spine::SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
-				construct(_buffer + _size++, valueCopy);
-			} else {
-				construct(_buffer + _size++, inValue);
+				// inValue might reference an element in this buffer, which moves when we reallocate.
+				if (&inValue >= _buffer && &inValue < _buffer + _size) {
+					size_t index = &inValue - _buffer;
+					grow();
+					construct(_buffer + _size++, _buffer[index]);
+					return;
+				}
+				grow();
 			}
+			construct(_buffer + _size++, inValue);
 		}
 
-		inline void addAll(const Vector<T> &inValue) {
-			ensureCapacity(this->size() + inValue.size());
-			for (size_t i = 0; i < inValue.size(); i++) {
-				add(inValue[i]);
+		inline void add(T &&inValue) {
+			if (_size == _capacity) {
+				if (&inValue >= _buffer && &inValue < _buffer + _size) {
+					size_t index = &inValue - _buffer;
+					grow();
+					new (_buffer + _size++) T(std::move(_buffer[index]));
+					return;
+				}
+				grow();
 			}
+			new (_buffer + _size++) T(std::move(inValue));
+		}
+
+		/// Constructs a new element in place at the end of the vector. The arguments must not reference elements of
+		/// this vector.
+		template<typename... Args>
+		inline T &emplace_back(Args &&...args) {
+			if (_size == _capacity) grow();
+			T *element = new (_buffer + _size) T(std::forward<Args>(args)...);
+			_size++;
+			return *element;
+		}
+
+		inline void addAll(const Vector<T> &inValue) {
+			size_t count = inValue.size();
+			ensureCapacity(_size + count);
+			copyConstruct(_buffer + _size, inValue._buffer, count);
+			_size += count;
 		}
 
 		inline void clearAndAddAll(const Vector<T> &inValue) {
@@ -138,12 +170,12 @@ namespace spine {
 
 			--_size;
 
-			if (inIndex != _size) {
-				for (size_t i = inIndex; i < _size; ++i) {
-					T tmp(_buffer[i]);
-					_buffer[i] = _buffer[i + 1];
-					_buffer[i + 1] = tmp;
-				}
+			if (std::is_trivially_copyable<T>::value) {
+				memmove((void *) (_buffer + inIndex), (void *) (_buffer + inIndex + 1), (_size - inIndex) * sizeof(T));
+				return;
+			}
+			for (size_t i = inIndex; i < _size; ++i) {
+				_buffer[i] = std::move(_buffer[i + 1]);
 			}
 
 			destroy(_buffer + _size);
@@ -206,6 +238,20 @@ namespace spine {
 			return *this;
 		}
 
+		Vector &operator=(Vector &&inVector) {
+			if (this != &inVector) {
+				clear();
+				deallocate(_buffer);
+				_size = inVector._size;
+				_capacity = inVector._capacity;
+				_buffer = inVector._buffer;
+				inVector._size = 0;
+				inVector._capacity = 0;
+				inVector._buffer = NULL;
+			}
+			return *this;
+		}
+
 		inline T *buffer() {
 			return _buffer;
 		}
@@ -231,10 +277,27 @@ namespace spine {
 			}
 		}
 
+		inline void grow() {
+			_capacity = (int) (_size * 1.75f);
+			if (_capacity < 8) _capacity = 8;
+			_buffer = spine::SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
+		}
+
 		inline void construct(T *buffer, const T &val) {
 			new(buffer) T(val);
 		}
 
+		inline void copyConstruct(T *buffer, const T *values, size_t count) {
+			if (count == 0) return;
+			if (std::is_trivially_copyable<T>::value) {
+				memcpy((void *) buffer, (const void *) values, count * sizeof(T));
+				return;
+			}
+			for (size_t i = 0; i < count; ++i) {
+				construct(buffer + i, values[i]);
+			}
+		}
+
 		inline void destroy(T *buffer) {
 			buffer->~T();
 		}
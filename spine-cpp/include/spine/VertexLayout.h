@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_VertexLayout_h
+#define Spine_VertexLayout_h
+
+#include <spine/dll.h>
+#include <stdint.h>
+
+namespace spine {
+	/// How a vertex's texture coordinates are stored.
+	enum UVFormat {
+		/// Two 32 bit floats.
+		UVFormat_Float = 0,
+		/// Two IEEE 754 16 bit floats.
+		UVFormat_Half,
+		/// Two unsigned 16 bit integers, where 0 to 65535 maps to 0 to 1.
+		UVFormat_UNorm16
+	};
+
+	/// How a vertex's colors are packed into 32 bits.
+	enum ColorFormat {
+		/// a << 24 | r << 16 | g << 8 | b, as in RenderCommand.
+		ColorFormat_ARGB = 0,
+		/// a << 24 | b << 16 | g << 8 | r, which is r, g, b, a bytes in little endian memory.
+		ColorFormat_ABGR
+	};
+
+	/// Describes interleaved vertices, as written by a RenderSink that returns it from getVertexLayout. Offsets and the
+	/// stride are in bytes. The position is 2 floats, so it and the stride must be multiples of 4. Colors are one 32 bit
+	/// value each. The dark color is optional.
+	struct SP_API VertexLayout {
+		int32_t stride;
+		int32_t positionOffset;
+		int32_t uvOffset;
+		UVFormat uvFormat;
+		int32_t colorOffset;
+		/// -1 if the vertices have no dark color.
+		int32_t darkColorOffset;
+		ColorFormat colorFormat;
+
+		VertexLayout() : stride(20), positionOffset(0), uvOffset(8), uvFormat(UVFormat_Float), colorOffset(16),
+						 darkColorOffset(-1), colorFormat(ColorFormat_ARGB) {
+		}
+
+		VertexLayout(int32_t stride, int32_t positionOffset, int32_t uvOffset, UVFormat uvFormat, int32_t colorOffset,
+					 int32_t darkColorOffset = -1, ColorFormat colorFormat = ColorFormat_ARGB) : stride(stride),
+																						   positionOffset(positionOffset),
+																						   uvOffset(uvOffset),
+																						   uvFormat(uvFormat),
+																						   colorOffset(colorOffset),
+																						   darkColorOffset(darkColorOffset),
+																						   colorFormat(colorFormat) {
+		}
+
+		/// Position, uvs and color, packed in that order.
+		static VertexLayout positionUVColor(UVFormat uvFormat = UVFormat_Float, ColorFormat colorFormat = ColorFormat_ARGB) {
+			int32_t uvSize = uvFormat == UVFormat_Float ? 8 : 4;
+			return VertexLayout(12 + uvSize, 0, 8, uvFormat, 8 + uvSize, -1, colorFormat);
+		}
+
+		/// Position, uvs, color and dark color, packed in that order.
+		static VertexLayout positionUVColorDark(UVFormat uvFormat = UVFormat_Float, ColorFormat colorFormat = ColorFormat_ARGB) {
+			int32_t uvSize = uvFormat == UVFormat_Float ? 8 : 4;
+			return VertexLayout(16 + uvSize, 0, 8, uvFormat, 8 + uvSize, 12 + uvSize, colorFormat);
+		}
+	};
+}
+
+#endif /* Spine_VertexLayout_h */
@@ -15,6 +15,8 @@ namespace spine {
     public:
         BinaryLoader38(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef) : ISkeletonBinaryLoader(loader, meshes, scaleRef, errStrRef){}
         virtual SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData) override;
+        virtual Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) override;
+        virtual void skipAnimation(DataInput *input, SkeletonData *skeletonData) override;
     private:
         Skin* readSkin(DataInput* input, bool defaultSkin, SkeletonData* skeletonData, bool nonessential);
 
@@ -22,13 +24,11 @@ namespace spine {
 
         void readVertices(DataInput* input, VertexAttachment* attachment, int vertexCount);
 
-        Animation* readAnimation(const String& name, DataInput* input, SkeletonData *skeletonData);
-
         void setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1,
                        float time2,
                        float value1, float value2, float scale);
 
-        void readCurve(DataInput* input, int frameIndex, CurveTimeline* timeline);
+        void readCurve(DataInput* input, int frameIndex, CurveTimeline* timeline, Vector<float> &curves);
     };
 
     class JsonLoader38 : public ISkeletonJsonLoader {
@@ -36,7 +36,7 @@ namespace spine {
         JsonLoader38(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef) : ISkeletonJsonLoader(loader, meshes, scaleRef, errStrRef){}
         virtual SkeletonData *readSkeleton(Json *json, SkeletonData *skeletonData) override;
     private:
-        static void readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex);
+        static void readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex, Vector<float> &curves);
 
         Animation *readAnimation(Json *root, SkeletonData *skeletonData);
 
@@ -14,6 +14,8 @@ namespace spine {
     public:
         BinaryLoader40(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef) : ISkeletonBinaryLoader(loader, meshes, scaleRef, errStrRef){}
         virtual SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData) override;
+        virtual Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) override;
+        virtual void skipAnimation(DataInput *input, SkeletonData *skeletonData) override;
     private:
         Skin *readSkin(DataInput *input, bool defaultSkin, SkeletonData *skeletonData, bool nonessential);
 
@@ -22,8 +24,6 @@ namespace spine {
 
         void readVertices(DataInput *input, VertexAttachment *attachment, int vertexCount);
 
-        Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData);
-
         void
         setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
                   float value1, float value2, float scale);
@@ -14,9 +14,25 @@ namespace spine {
     public:
         BinaryLoader42(AttachmentLoader* loader, Vector<LinkedMesh *>& meshes, float& scaleRef, String& errStrRef) : ISkeletonBinaryLoader(loader, meshes, scaleRef, errStrRef){}
         virtual SkeletonData *readSkeleton(DataInput *input, SkeletonData *skeletonData) override;
+        virtual Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) override;
+        virtual void skipAnimation(DataInput *input, SkeletonData *skeletonData) override;
     private:
+        bool readSkins(DataInput *input, SkeletonData *skeletonData, bool nonessential);
+
+        bool readSkinsParallel(DataInput *input, SkeletonData *skeletonData, bool nonessential);
+
+        struct SkinTasks;
+
+        static void readSkinTask(void *context, int index);
+
         Skin *readSkin(DataInput *input, bool defaultSkin, SkeletonData *skeletonData, bool nonessential);
 
+        void skipSkin(DataInput *input, bool defaultSkin, bool nonessential);
+
+        void skipAttachment(DataInput *input, bool nonessential);
+
+        int skipVertices(DataInput *input, bool weighted);
+
         Sequence *readSequence(DataInput *input);
 
         Attachment *readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
@@ -26,8 +42,6 @@ namespace spine {
 
         void readShortArray(DataInput *input, Vector<unsigned short> &array, int n);
 
-        Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData);
-
         void
         setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
                   float value1, float value2, float scale);
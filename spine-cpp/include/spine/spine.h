@@ -33,12 +33,14 @@
 #include <spine/Animation.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/Arena.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
@@ -50,6 +52,7 @@
 #include <spine/ContainerUtil.h>
 #include <spine/CurveTimeline.h>
 #include <spine/DeformTimeline.h>
+#include <spine/DirtyTracker.h>
 #include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
 #include <spine/EventData.h>
@@ -62,12 +65,14 @@
 #include <spine/IkConstraintTimeline.h>
 #include <spine/Inherit.h>
 #include <spine/InheritTimeline.h>
+#include <spine/InternTable.h>
 #include <spine/Json.h>
 #include <spine/LinkedMesh.h>
 #include <spine/MathUtil.h>
 #include <spine/MeshAttachment.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
+#include <spine/NameIndex.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraint.h>
 #include <spine/PathConstraintData.h>
@@ -85,21 +90,27 @@
 #include <spine/RegionAttachment.h>
 #include <spine/RotateMode.h>
 #include <spine/RotateTimeline.h>
+#include <spine/RuntimeContext.h>
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonBatch.h>
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonPose.h>
 #include <spine/SkeletonRenderer.h>
+#include <spine/SkeletonRenderCache.h>
+#include <spine/SkeletonSnapshot.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 #include <spine/SpacingMode.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/TaskExecutor.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
 #include <spine/TransformConstraint.h>
@@ -110,6 +121,7 @@
 #include <spine/Updatable.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
+#include <spine/VertexLayout.h>
 #include <spine/Vertices.h>
 
 #endif
@@ -41,10 +41,15 @@ using namespace spine;
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _decoderIndex(-1) {
 	assert(_name.length() > 0);
+	size_t idCount = 0;
+	for (size_t i = 0; i < timelines.size(); i++)
+		idCount += timelines[i]->getPropertyIds().size();
+	_timelineIds.reserve(idCount);
 	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
+		Vector<PropertyId> &propertyIds = timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
 			_timelineIds.put(propertyIds[ii], true);
 	}
@@ -83,6 +88,17 @@ Vector<Timeline *> &Animation::getTimelines() {
 	return _timelines;
 }
 
+void Animation::setTimelines(Vector<Timeline *> &timelines) {
+	ContainerUtil::cleanUpVectorOfPointers(_timelines);
+	_timelines.clearAndAddAll(timelines);
+	_timelineIds.clear();
+	for (size_t i = 0; i < timelines.size(); i++) {
+		Vector<PropertyId> &propertyIds = timelines[i]->getPropertyIds();
+		for (size_t ii = 0; ii < propertyIds.size(); ii++)
+			_timelineIds.put(propertyIds[ii], true);
+	}
+}
+
 float Animation::getDuration() {
 	return _duration;
 }
@@ -91,57 +107,47 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
+static thread_local int *currentCursor = NULL;
+
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
-	}
-	return (int) (n - 1);
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
-}
+	int n = (int) frames.size();
+	if (n <= step) return n - step;
+
+	int *cursor = currentCursor;
+	if (cursor) {
+		// Playback usually stays on the frame found last time or moves to the next one.
+		int i = *cursor;
+		if (i >= 0 && i < n && i % step == 0 && (i == 0 || frames[i] <= target)) {
+			if (i + step >= n || frames[i + step] > target) return i;
+			i += step;
+			if (i + step >= n || frames[i + step] > target) {
+				*cursor = i;
+				return i;
+			}
+		}
+	}
 
-int Animation::binarySearch(Vector<float> &values, float target, int step) {
-    int low = 0;
-    int size = (int)values.size();
-    int high = size / step - 2;
-    if (high == 0) {
-        return step;
-    }
-
-    int current = (int) (static_cast<uint32_t>(high) >> 1);
-    while (true) {
-        if (values[(current + 1) * step] <= target)
-            low = current + 1;
-        else
-            high = current;
-
-        if (low == high) return (low + 1) * step;
-
-        current = (int) (static_cast<uint32_t>(low + high) >> 1);
-    }
+	int low = 1, high = n / step;
+	while (low < high) {
+		int current = (int) (static_cast<uint32_t>(low + high) >> 1);
+		if (frames[current * step] > target)
+			high = current;
+		else
+			low = current + 1;
+	}
+	int i = (low - 1) * step;
+	if (cursor) *cursor = i;
+	return i;
 }
 
-int Animation::binarySearch(Vector<float> &values, float target) {
-    int low = 0;
-    int size = (int)values.size();
-    int high = size - 2;
-    if (high == 0) return 1;
-
-    int current = (int) (static_cast<uint32_t>(high) >> 1);
-    while (true) {
-        if (values[(current + 1)] <= target)
-            low = current + 1;
-        else
-            high = current;
-
-        if (low == high) return (low + 1);
+SearchCursorScope::SearchCursorScope(int *cursor) : _previous(currentCursor) {
+	currentCursor = cursor;
+}
 
-        current = (int) (static_cast<uint32_t>(low + high) >> 1);
-    }
+SearchCursorScope::~SearchCursorScope() {
+	currentCursor = _previous;
 }
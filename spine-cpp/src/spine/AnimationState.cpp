@@ -31,6 +31,7 @@
 #include <spine/Animation.h>
 #include <spine/AnimationStateData.h>
 #include <spine/AttachmentTimeline.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
 #include <spine/DrawOrderTimeline.h>
@@ -60,7 +61,7 @@ TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixi
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
 						   _mixDuration(0), _interruptAlpha(0), _totalAlpha(0), _mixBlend(MixBlend_Replace),
-						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
+						   _bakedAnimation(NULL), _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
 }
 
 TrackEntry::~TrackEntry() {}
@@ -87,6 +88,13 @@ bool TrackEntry::getShortestRotation() { return _shortestRotation; }
 
 void TrackEntry::setShortestRotation(bool inValue) { _shortestRotation = inValue; }
 
+BakedAnimation *TrackEntry::getBakedAnimation() { return _bakedAnimation; }
+
+void TrackEntry::setBakedAnimation(BakedAnimation *inValue) {
+	assert(inValue == NULL || &inValue->getAnimation() == _animation);
+	_bakedAnimation = inValue;
+}
+
 float TrackEntry::getDelay() { return _delay; }
 
 void TrackEntry::setDelay(float inValue) { _delay = inValue; }
@@ -207,6 +215,8 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
+	_bakedAnimation = NULL;
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
@@ -342,24 +352,7 @@ AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 }
 
 AnimationState::~AnimationState() {
-	for (size_t i = 0; i < _tracks.size(); i++) {
-		TrackEntry *entry = _tracks[i];
-		if (entry) {
-			TrackEntry *from = entry->_mixingFrom;
-			while (from) {
-				TrackEntry *curr = from;
-				from = curr->_mixingFrom;
-				delete curr;
-			}
-			TrackEntry *next = entry->_next;
-			while (next) {
-				TrackEntry *curr = next;
-				next = curr->_next;
-				delete curr;
-			}
-			delete entry;
-		}
-	}
+	// Track entries, including those still in use, are destroyed with _trackEntryPool.
 	delete _queue;
 }
 
@@ -466,10 +459,15 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		}
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
+		if (current._timelineCursors.size() != timelineCount) current._timelineCursors.setSize(timelineCount, 0);
 		if ((i == 0 && alpha == 1) || blend == MixBlend_Add) {
 			if (i == 0) attachments = true;
+			BakedAnimation *baked = current._bakedAnimation;
+			if (baked) baked->applyRows(skeleton, applyTime, alpha, blend, MixDirection_In);
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
+				if (baked && baked->isBaked(ii)) continue;
 				Timeline *timeline = timelines[ii];
+				SearchCursorScope cursor(&current._timelineCursors[ii]);
 				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
 											attachments);
@@ -487,6 +485,7 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
 				assert(timeline);
+				SearchCursorScope cursor(&current._timelineCursors[ii]);
 
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
 
@@ -567,6 +566,7 @@ TrackEntry *AnimationState::setAnimation(size_t trackIndex, const String &animat
 
 TrackEntry *AnimationState::setAnimation(size_t trackIndex, Animation *animation, bool loop) {
 	assert(animation != NULL);
+	_data->_skeletonData->decodeAnimation(animation);
 
 	bool interrupt = true;
 	TrackEntry *current = expandToIndex(trackIndex);
@@ -599,6 +599,7 @@ TrackEntry *AnimationState::addAnimation(size_t trackIndex, const String &animat
 
 TrackEntry *AnimationState::addAnimation(size_t trackIndex, Animation *animation, bool loop, float delay) {
 	assert(animation != NULL);
+	_data->_skeletonData->decodeAnimation(animation);
 
 	TrackEntry *last = expandToIndex(trackIndex);
 	if (last != NULL) {
@@ -701,6 +702,10 @@ void AnimationState::disposeTrackEntry(TrackEntry *entry) {
 	_trackEntryPool.free(entry);
 }
 
+void AnimationState::reserveTrackEntries(size_t count) {
+	_trackEntryPool.reserve(count);
+}
+
 Animation *AnimationState::getEmptyAnimation() {
 	static Vector<Timeline *> timelines;
 	static Animation ret(String("<empty>"), timelines, 0);
@@ -848,9 +853,12 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
+	if (from->_timelineCursors.size() != timelineCount) from->_timelineCursors.setSize(timelineCount, 0);
 	if (blend == MixBlend_Add) {
-		for (size_t i = 0; i < timelineCount; i++)
+		for (size_t i = 0; i < timelineCount; i++) {
+			SearchCursorScope cursor(&from->_timelineCursors[i]);
 			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		}
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -892,6 +900,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 			}
 			from->_totalAlpha += alpha;
+			SearchCursorScope cursor(&from->_timelineCursors[i]);
 			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
 									timelinesRotation, i << 1, firstFrame);
@@ -1001,6 +1010,7 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 
 	entry._reverse = false;
 	entry._shortestRotation = false;
+	entry._bakedAnimation = _data->getBakedAnimation(animation);
 
 	entry._eventThreshold = 0;
 	entry._alphaAttachmentThreshold = 0;
@@ -29,16 +29,20 @@
 
 #include <spine/AnimationStateData.h>
 #include <spine/Animation.h>
+#include <spine/BakedAnimation.h>
 #include <spine/SkeletonData.h>
 
+#include <spine/ContainerUtil.h>
+
 using namespace spine;
 
 AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonData(skeletonData), _defaultMix(0) {
 }
 
 void AnimationStateData::setMix(const String &fromName, const String &toName, float duration) {
-	Animation *from = _skeletonData->findAnimation(fromName);
-	Animation *to = _skeletonData->findAnimation(toName);
+	// Only the identities are needed, so lazily loaded animations are not decoded here.
+	Animation *from = ContainerUtil::findWithName(_skeletonData->getAnimations(), fromName);
+	Animation *to = ContainerUtil::findWithName(_skeletonData->getAnimations(), toName);
 
 	setMix(from, to, duration);
 }
@@ -61,6 +65,21 @@ float AnimationStateData::getMix(Animation *from, Animation *to) {
 	return _defaultMix;
 }
 
+void AnimationStateData::setBakedAnimation(BakedAnimation *baked) {
+	assert(baked != NULL);
+
+	_bakedAnimations.put(&baked->getAnimation(), baked);
+}
+
+void AnimationStateData::removeBakedAnimation(Animation *animation) {
+	_bakedAnimations.remove(animation);
+}
+
+BakedAnimation *AnimationStateData::getBakedAnimation(Animation *animation) {
+	if (_bakedAnimations.containsKey(animation)) return _bakedAnimations[animation];
+	return NULL;
+}
+
 SkeletonData *AnimationStateData::getSkeletonData() {
 	return _skeletonData;
 }
@@ -84,3 +103,7 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPairHash::hash(const AnimationPair &pair) {
+	return HashMapHash<String>::hash(pair._a1->_name) * 31 + HashMapHash<String>::hash(pair._a2->_name);
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/Arena.h>
+#include <spine/Extension.h>
+
+#include <string.h>
+
+using namespace spine;
+
+// Every allocation is preceded by its requested size, which keeps the payload 8 byte aligned.
+static const size_t HEADER_SIZE = 8;
+
+static size_t alignSize(size_t size) {
+	return (size + 7) & ~(size_t) 7;
+}
+
+struct Arena::Block {
+	Block *next;
+	size_t size;
+	size_t used;
+	size_t padding;
+
+	unsigned char *data() { return (unsigned char *) (this + 1); }
+
+	const unsigned char *data() const { return (const unsigned char *) (this + 1); }
+};
+
+static thread_local Arena *currentArena = NULL;
+static thread_local bool currentAllocating = false;
+
+Arena::Arena(size_t blockSize) : _blocks(NULL), _nextBlockSize(alignSize(blockSize)), _maxBlockSize(alignSize(blockSize) * 64) {
+}
+
+Arena::~Arena() {
+	Block *block = _blocks;
+	while (block) {
+		Block *next = block->next;
+		SpineExtension::getInstance()->_free(block, __FILE__, __LINE__);
+		block = next;
+	}
+}
+
+Arena::Block *Arena::addBlock(size_t minSize) {
+	size_t size = _nextBlockSize;
+	if (size < minSize) size = minSize;
+	if (_nextBlockSize < _maxBlockSize) _nextBlockSize <<= 1;
+	// Blocks come straight from the SpineExtension, bypassing the current arena.
+	Block *block = (Block *) SpineExtension::getInstance()->_alloc(sizeof(Block) + size, __FILE__, __LINE__);
+	if (!block) return NULL;
+	block->next = _blocks;
+	block->size = size;
+	block->used = 0;
+	_blocks = block;
+	return block;
+}
+
+void *Arena::allocate(size_t size) {
+	if (size == 0) return NULL;
+	size_t total = HEADER_SIZE + alignSize(size);
+	Block *block = _blocks;
+	if (!block || block->size - block->used < total) {
+		block = addBlock(total);
+		if (!block) return NULL;
+	}
+	unsigned char *header = block->data() + block->used;
+	block->used += total;
+	*(size_t *) header = size;
+	return header + HEADER_SIZE;
+}
+
+void *Arena::reallocate(void *ptr, size_t size) {
+	if (!ptr) return allocate(size);
+	if (size == 0) return NULL;
+	size_t oldSize = getSize(ptr);
+	if (size <= oldSize) return ptr;
+
+	Block *block = _blocks;
+	unsigned char *header = (unsigned char *) ptr - HEADER_SIZE;
+	size_t oldTotal = HEADER_SIZE + alignSize(oldSize), total = HEADER_SIZE + alignSize(size);
+	if (header + oldTotal == block->data() + block->used && (size_t) (header - block->data()) + total <= block->size) {
+		block->used += total - oldTotal;
+		*(size_t *) header = size;
+		return ptr;
+	}
+
+	void *result = allocate(size);
+	if (result) memcpy(result, ptr, oldSize);
+	return result;
+}
+
+void Arena::release(void *ptr) {
+	if (!ptr || !_blocks) return;
+	Block *block = _blocks;
+	unsigned char *header = (unsigned char *) ptr - HEADER_SIZE;
+	if (header + HEADER_SIZE + alignSize(getSize(ptr)) == block->data() + block->used)
+		block->used = (size_t) (header - block->data());
+}
+
+bool Arena::owns(const void *ptr) const {
+	const unsigned char *p = (const unsigned char *) ptr;
+	for (const Block *block = _blocks; block; block = block->next)
+		if (p >= block->data() && p < block->data() + block->size) return true;
+	return false;
+}
+
+size_t Arena::getSize(const void *ptr) const {
+	return *(const size_t *) ((const unsigned char *) ptr - HEADER_SIZE);
+}
+
+size_t Arena::getCapacity() const {
+	size_t capacity = 0;
+	for (const Block *block = _blocks; block; block = block->next)
+		capacity += block->size;
+	return capacity;
+}
+
+size_t Arena::getUsed() const {
+	size_t used = 0;
+	for (const Block *block = _blocks; block; block = block->next)
+		used += block->used;
+	return used;
+}
+
+Arena *Arena::getCurrent() {
+	return currentArena;
+}
+
+bool Arena::isAllocating() {
+	return currentAllocating;
+}
+
+void Arena::setCurrent(Arena *arena, bool allocating) {
+	currentArena = arena;
+	currentAllocating = arena && allocating;
+}
+
+ArenaScope::ArenaScope(Arena *arena, bool allocating) : _previous(Arena::getCurrent()),
+														_previousAllocating(Arena::isAllocating()) {
+	Arena::setCurrent(arena, allocating);
+}
+
+ArenaScope::~ArenaScope() {
+	Arena::setCurrent(_previous, _previousAllocating);
+}
+
+ArenaOwner::ArenaOwner() : _arena(NULL), _previous(NULL), _previousAllocating(false), _destroying(false) {
+}
+
+ArenaOwner::~ArenaOwner() {
+	if (_destroying) Arena::setCurrent(_previous, _previousAllocating);
+	delete _arena;
+}
+
+void ArenaOwner::set(Arena *arena) {
+	delete _arena;
+	_arena = arena;
+}
+
+void ArenaOwner::beginDestruction() {
+	if (!_arena || _destroying) return;
+	_previous = Arena::getCurrent();
+	_previousAllocating = Arena::isAllocating();
+	_destroying = true;
+	Arena::setCurrent(_arena, false);
+}
@@ -0,0 +1,355 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+static const int BoneProperties = Property_Rotate | Property_X | Property_Y | Property_ScaleX | Property_ScaleY |
+								  Property_ShearX | Property_ShearY;
+static const int ColorProperties = Property_Rgb | Property_Alpha | Property_Rgb2;
+
+static int getProperty(PropertyId id) {
+	return (int) (id >> 32);
+}
+
+static int getIndex(PropertyId id) {
+	return (int) (id & 0xffffffff);
+}
+
+static size_t getWidth(int property) {
+	return property == Property_Rgb || property == Property_Rgb2 ? 3 : 1;
+}
+
+static float mixValue(float value, float current, float setup, float alpha, MixBlend blend) {
+	switch (blend) {
+		case MixBlend_Setup:
+			return setup + (value - setup) * alpha;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			return current + (value - current) * alpha;
+		default:
+			return current + (value - setup) * alpha;
+	}
+}
+
+/// Mixes as ScaleTimeline does, keeping the sign of the setup or current pose when mixing out.
+static float mixScale(float value, float current, float setup, float alpha, MixBlend blend, MixDirection direction) {
+	if (alpha == 1) return blend == MixBlend_Add ? current + value - setup : value;
+	if (blend == MixBlend_Add) return current + (value - setup) * alpha;
+	float base = blend == MixBlend_Setup ? setup : current;
+	if (direction == MixDirection_Out) return base + (MathUtil::abs(value) * MathUtil::sign(base) - base) * alpha;
+	base = MathUtil::abs(base) * MathUtil::sign(value);
+	return base + (value - base) * alpha;
+}
+
+/// Mixes as the color timelines do, which set the color at full alpha for any blend.
+static float mixColor(float value, float current, float setup, float alpha, MixBlend blend) {
+	if (alpha != 1) {
+		float base = blend == MixBlend_Setup ? setup : current;
+		value = base + (value - base) * alpha;
+	}
+	return MathUtil::clamp(value, 0, 1);
+}
+
+BakedAnimation::BakedAnimation(SkeletonData &skeletonData, Animation &animation, float fps, bool colors)
+	: _animation(animation), _fps(fps), _duration(0), _rowCount(1), _rowSize(0),
+	  _translateError(0), _rotateError(0), _scaleError(0), _colorError(0) {
+	assert(fps > 0);
+	// A lazily loaded animation has no timelines or duration until it is decoded.
+	skeletonData.decodeAnimation(&animation);
+	_duration = animation.getDuration();
+
+	// A timeline is baked when all the properties it keys can be baked.
+	int bakeable = colors ? BoneProperties | ColorProperties : BoneProperties;
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	_baked.setSize(timelines.size(), 0);
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		bool baked = ids.size() > 0;
+		for (size_t ii = 0; ii < ids.size(); ii++)
+			if ((getProperty(ids[ii]) & ~bakeable) != 0) baked = false;
+		if (!baked) continue;
+		_baked[i] = 1;
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			if (_channels.contains(ids[ii])) continue;
+			_channels.add(ids[ii]);
+			_channelStarts.add(timelines[i]->getFrames()[0]);
+			_rowSize += getWidth(getProperty(ids[ii]));
+		}
+	}
+	if (_duration > 0) _rowCount = (size_t) MathUtil::ceil(_duration * fps) + 1;
+	_rows.setSize(_rowCount * _rowSize, 0);
+	if (_rowSize == 0) return;
+
+	Skeleton skeleton(&skeletonData);
+	// Bones that require a skin are baked as if the skin was set.
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		bones[i]->setActive(true);
+	for (size_t row = 0; row < _rowCount; row++) {
+		sample(skeleton, getRowTime(row));
+		capture(skeleton, _rows.buffer() + row * _rowSize);
+	}
+
+	Vector<float> values;
+	values.setSize(_rowSize, 0);
+	for (size_t row = 0; row + 1 < _rowCount; row++) {
+		sample(skeleton, (getRowTime(row) + getRowTime(row + 1)) * 0.5f);
+		capture(skeleton, values.buffer());
+		measure(values.buffer(), _rows.buffer() + row * _rowSize);
+	}
+}
+
+BakedAnimation::~BakedAnimation() {
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getFps() {
+	return _fps;
+}
+
+size_t BakedAnimation::getRowCount() {
+	return _rowCount;
+}
+
+size_t BakedAnimation::getRowSize() {
+	return _rowSize;
+}
+
+size_t BakedAnimation::getMemorySize() {
+	return sizeof(BakedAnimation) + _rows.getCapacity() * sizeof(float) +
+		   _channels.getCapacity() * sizeof(PropertyId) + _channelStarts.getCapacity() * sizeof(float) +
+		   _baked.getCapacity();
+}
+
+bool BakedAnimation::isBaked(size_t timelineIndex) {
+	return timelineIndex < _baked.size() && _baked[timelineIndex];
+}
+
+float BakedAnimation::getTranslateError() {
+	return _translateError;
+}
+
+float BakedAnimation::getRotateError() {
+	return _rotateError;
+}
+
+float BakedAnimation::getScaleError() {
+	return _scaleError;
+}
+
+float BakedAnimation::getColorError() {
+	return _colorError;
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents,
+						   float alpha, MixBlend blend, MixDirection direction) {
+	if (loop && _duration != 0) {
+		time = MathUtil::fmod(time, _duration);
+		if (lastTime > 0) {
+			lastTime = MathUtil::fmod(lastTime, _duration);
+		}
+	}
+
+	applyRows(skeleton, time, alpha, blend, direction);
+	Vector<Timeline *> &timelines = _animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; ++i) {
+		if (!isBaked(i)) timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+	}
+}
+
+float BakedAnimation::getRowTime(size_t row) {
+	float time = row / _fps;
+	return time < _duration ? time : _duration;
+}
+
+void BakedAnimation::applyRows(Skeleton &skeleton, float time, float alpha, MixBlend blend, MixDirection direction) {
+	size_t last = _rowCount - 1, row = last;
+	float t = 0;
+	if (time < _duration) {
+		row = 0;
+		if (time > 0) {
+			row = (size_t) (time * _fps);
+			if (row >= last) row = last - 1;
+			float start = getRowTime(row);
+			t = (time - start) / (getRowTime(row + 1) - start);
+		}
+	}
+	const float *a = _rows.buffer() + row * _rowSize, *b = row < last ? a + _rowSize : a;
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<Slot *> &slots = skeleton.getSlots();
+	for (size_t i = 0, k = 0, n = _channels.size(); i < n; k += getWidth(getProperty(_channels[i])), i++) {
+		int property = getProperty(_channels[i]);
+		// Before its first frame a timeline sets or mixes to the setup pose, or does nothing.
+		bool before = time < _channelStarts[i];
+		if (before && blend != MixBlend_Setup && blend != MixBlend_First) continue;
+
+		if (property & BoneProperties) {
+			Bone *bone = bones[getIndex(_channels[i])];
+			if (!bone->_active) continue;
+			BoneData &data = bone->_data;
+			float value = a[k] + (b[k] - a[k]) * t;
+			switch (property) {
+				case Property_Rotate:
+					bone->_rotation = mixValue(before ? data.getRotation() : value, bone->_rotation, data.getRotation(),
+											   alpha, blend);
+					break;
+				case Property_X:
+					bone->_x = mixValue(before ? data.getX() : value, bone->_x, data.getX(), alpha, blend);
+					break;
+				case Property_Y:
+					bone->_y = mixValue(before ? data.getY() : value, bone->_y, data.getY(), alpha, blend);
+					break;
+				case Property_ScaleX:
+					bone->_scaleX = before ? mixValue(data.getScaleX(), bone->_scaleX, data.getScaleX(), alpha, blend)
+										   : mixScale(value, bone->_scaleX, data.getScaleX(), alpha, blend, direction);
+					break;
+				case Property_ScaleY:
+					bone->_scaleY = before ? mixValue(data.getScaleY(), bone->_scaleY, data.getScaleY(), alpha, blend)
+										   : mixScale(value, bone->_scaleY, data.getScaleY(), alpha, blend, direction);
+					break;
+				case Property_ShearX:
+					bone->_shearX = mixValue(before ? data.getShearX() : value, bone->_shearX, data.getShearX(), alpha,
+											 blend);
+					break;
+				case Property_ShearY:
+					bone->_shearY = mixValue(before ? data.getShearY() : value, bone->_shearY, data.getShearY(), alpha,
+											 blend);
+					break;
+			}
+			continue;
+		}
+
+		Slot *slot = slots[getIndex(_channels[i])];
+		if (!slot->getBone().isActive()) continue;
+		bool dark = property == Property_Rgb2;
+		Color &color = dark ? slot->getDarkColor() : slot->getColor();
+		Color &setup = dark ? slot->getData().getDarkColor() : slot->getData().getColor();
+		if (property == Property_Alpha) {
+			color.a = mixColor(before ? setup.a : a[k] + (b[k] - a[k]) * t, color.a, setup.a, alpha, blend);
+			continue;
+		}
+		color.r = mixColor(before ? setup.r : a[k] + (b[k] - a[k]) * t, color.r, setup.r, alpha, blend);
+		color.g = mixColor(before ? setup.g : a[k + 1] + (b[k + 1] - a[k + 1]) * t, color.g, setup.g, alpha, blend);
+		color.b = mixColor(before ? setup.b : a[k + 2] + (b[k + 2] - a[k + 2]) * t, color.b, setup.b, alpha, blend);
+	}
+}
+
+void BakedAnimation::sample(Skeleton &skeleton, float time) {
+	Vector<Timeline *> &timelines = _animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; ++i) {
+		if (isBaked(i)) timelines[i]->apply(skeleton, time, time, NULL, 1, MixBlend_Setup, MixDirection_In);
+	}
+}
+
+void BakedAnimation::capture(Skeleton &skeleton, float *values) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<Slot *> &slots = skeleton.getSlots();
+	for (size_t i = 0, n = _channels.size(); i < n; i++) {
+		int property = getProperty(_channels[i]), index = getIndex(_channels[i]);
+		Bone *bone = property & BoneProperties ? bones[index] : NULL;
+		switch (property) {
+			case Property_Rotate:
+				*values++ = bone->_rotation;
+				break;
+			case Property_X:
+				*values++ = bone->_x;
+				break;
+			case Property_Y:
+				*values++ = bone->_y;
+				break;
+			case Property_ScaleX:
+				*values++ = bone->_scaleX;
+				break;
+			case Property_ScaleY:
+				*values++ = bone->_scaleY;
+				break;
+			case Property_ShearX:
+				*values++ = bone->_shearX;
+				break;
+			case Property_ShearY:
+				*values++ = bone->_shearY;
+				break;
+			case Property_Alpha:
+				*values++ = slots[index]->getColor().a;
+				break;
+			default: {
+				Color &color = property == Property_Rgb2 ? slots[index]->getDarkColor() : slots[index]->getColor();
+				*values++ = color.r;
+				*values++ = color.g;
+				*values++ = color.b;
+			}
+		}
+	}
+}
+
+void BakedAnimation::measure(const float *values, const float *row) {
+	const float *next = row + _rowSize;
+	for (size_t i = 0, k = 0, n = _channels.size(); i < n; i++) {
+		int property = getProperty(_channels[i]);
+		float *error;
+		switch (property) {
+			case Property_X:
+			case Property_Y:
+				error = &_translateError;
+				break;
+			case Property_Rotate:
+			case Property_ShearX:
+			case Property_ShearY:
+				error = &_rotateError;
+				break;
+			case Property_ScaleX:
+			case Property_ScaleY:
+				error = &_scaleError;
+				break;
+			default:
+				error = &_colorError;
+		}
+		for (size_t ii = getWidth(property); ii > 0; ii--, k++) {
+			float difference = MathUtil::abs(values[k] - (row[k] + next[k]) * 0.5f);
+			if (difference > *error) *error = difference;
+		}
+	}
+}
@@ -30,6 +30,7 @@
 #include <spine/Bone.h>
 
 #include <spine/BoneData.h>
+#include <spine/RuntimeContext.h>
 #include <spine/Skeleton.h>
 
 using namespace spine;
@@ -43,7 +44,8 @@ void Bone::setYDown(bool inValue) {
 }
 
 bool Bone::isYDown() {
-	return yDown;
+	RuntimeContext *context = RuntimeContext::getCurrent();
+	return context ? context->isYDown() : yDown;
 }
 
 Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
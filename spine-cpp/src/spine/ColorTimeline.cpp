@@ -51,13 +51,6 @@ RGBATimeline::RGBATimeline(size_t frameCount, size_t bezierCount, int slotIndex)
 	setPropertyIds(ids, 2);
 }
 
-RGBATimeline::RGBATimeline(size_t frameCount, int slotIndex)
-    : CurveTimeline(frameCount, RGBATimeline::ENTRIES), _slotIndex(slotIndex) {
-	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex,
-						((PropertyId) Property_Alpha << 32) | slotIndex};
-	setPropertyIds(ids, 2);
-}
-
 RGBATimeline::~RGBATimeline() {
 }
 
@@ -67,123 +60,65 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -5;
-        static const int PREV_R = -4;
-        static const int PREV_G = -3;
-        static const int PREV_B = -2;
-        static const int PREV_A = -1;
-
-        Slot *slotP = skeleton._slots[_slotIndex];
-        Slot &slot = *slotP;
-        if (!slot._bone.isActive()) return;
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    slot._color.set(slot._data._color);
-                    return;
-                case MixBlend_First: {
-                    Color &color = slot._color, setup = slot._data._color;
-                    color.add((setup.r - color.r) * alpha, (setup.g - color.g) * alpha, (setup.b - color.b) * alpha,
-                              (setup.a - color.a) * alpha);
-                }
-                default: ;
-            }
-            return;
-        }
-
-        float r, g, b, a;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            size_t i = _frames.size();
-            r = _frames[i + PREV_R];
-            g = _frames[i + PREV_G];
-            b = _frames[i + PREV_B];
-            a = _frames[i + PREV_A];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            size_t frame = (size_t)Animation::binarySearch(_frames, time, ENTRIES);
-            r = _frames[frame + PREV_R];
-            g = _frames[frame + PREV_G];
-            b = _frames[frame + PREV_B];
-            a = _frames[frame + PREV_A];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1, 1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            r += (_frames[frame + R] - r) * percent;
-            g += (_frames[frame + G] - g) * percent;
-            b += (_frames[frame + B] - b) * percent;
-            a += (_frames[frame + A] - a) * percent;
-        }
-
-        if (alpha == 1) {
-            slot.getColor().set(r, g, b, a);
-        } else {
-            Color &color = slot.getColor();
-            if (blend == MixBlend_Setup) color.set(slot.getData().getColor());
-            color.add((r - color.r) * alpha, (g - color.g) * alpha, (b - color.b) * alpha, (a - color.a) * alpha);
-        }
-    } else {
-        Slot *slot = skeleton._slots[_slotIndex];
-        if (!slot->_bone._active) return;
-
-        if (time < _frames[0]) {
-            Color &color = slot->_color, &setup = slot->_data._color;
-            switch (blend) {
-                case MixBlend_Setup:
-                    color.set(setup);
-                    return;
-                case MixBlend_First:
-                    color.add((setup.r - color.r) * alpha, (setup.g - color.g) * alpha, (setup.b - color.b) * alpha,
-                              (setup.a - color.a) * alpha);
-                default: {
-                }
-            }
-            return;
-        }
-
-        float r = 0, g = 0, b = 0, a = 0;
-        int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
-        int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
-        switch (curveType) {
-            case RGBATimeline::LINEAR: {
-                float before = _frames[i];
-                r = _frames[i + RGBATimeline::R];
-                g = _frames[i + RGBATimeline::G];
-                b = _frames[i + RGBATimeline::B];
-                a = _frames[i + RGBATimeline::A];
-                float t = (time - before) / (_frames[i + RGBATimeline::ENTRIES] - before);
-                r += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::R] - r) * t;
-                g += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::G] - g) * t;
-                b += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::B] - b) * t;
-                a += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::A] - a) * t;
-                break;
-            }
-            case RGBATimeline::STEPPED: {
-                r = _frames[i + RGBATimeline::R];
-                g = _frames[i + RGBATimeline::G];
-                b = _frames[i + RGBATimeline::B];
-                a = _frames[i + RGBATimeline::A];
-                break;
-            }
-            default: {
-                r = getBezierValue(time, i, RGBATimeline::R, curveType - RGBATimeline::BEZIER);
-                g = getBezierValue(time, i, RGBATimeline::G,
-                                   curveType + BEZIER_SIZE - RGBATimeline::BEZIER);
-                b = getBezierValue(time, i, RGBATimeline::B,
-                                   curveType + BEZIER_SIZE * 2 - RGBATimeline::BEZIER);
-                a = getBezierValue(time, i, RGBATimeline::A,
-                                   curveType + BEZIER_SIZE * 3 - RGBATimeline::BEZIER);
-            }
-        }
-        Color &color = slot->_color;
-        if (alpha == 1)
-            color.set(r, g, b, a);
-        else {
-            if (blend == MixBlend_Setup) color.set(slot->_data._color);
-            color.add((r - color.r) * alpha, (g - color.g) * alpha, (b - color.b) * alpha, (a - color.a) * alpha);
-        }
-    }
+	Slot *slot = skeleton._slots[_slotIndex];
+	if (!slot->_bone._active) return;
+
+	if (time < _frames[0]) {
+		Color &color = slot->_color, &setup = slot->_data._color;
+		switch (blend) {
+			case MixBlend_Setup:
+				color.set(setup);
+				return;
+			case MixBlend_First:
+				color.add((setup.r - color.r) * alpha, (setup.g - color.g) * alpha, (setup.b - color.b) * alpha,
+						  (setup.a - color.a) * alpha);
+			default: {
+			}
+		}
+		return;
+	}
+
+	float r = 0, g = 0, b = 0, a = 0;
+	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
+	int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
+	switch (curveType) {
+		case RGBATimeline::LINEAR: {
+			float before = _frames[i];
+			r = _frames[i + RGBATimeline::R];
+			g = _frames[i + RGBATimeline::G];
+			b = _frames[i + RGBATimeline::B];
+			a = _frames[i + RGBATimeline::A];
+			float t = (time - before) / (_frames[i + RGBATimeline::ENTRIES] - before);
+			r += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::R] - r) * t;
+			g += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::G] - g) * t;
+			b += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::B] - b) * t;
+			a += (_frames[i + RGBATimeline::ENTRIES + RGBATimeline::A] - a) * t;
+			break;
+		}
+		case RGBATimeline::STEPPED: {
+			r = _frames[i + RGBATimeline::R];
+			g = _frames[i + RGBATimeline::G];
+			b = _frames[i + RGBATimeline::B];
+			a = _frames[i + RGBATimeline::A];
+			break;
+		}
+		default: {
+			r = getBezierValue(time, i, RGBATimeline::R, curveType - RGBATimeline::BEZIER);
+			g = getBezierValue(time, i, RGBATimeline::G,
+							   curveType + BEZIER_SIZE - RGBATimeline::BEZIER);
+			b = getBezierValue(time, i, RGBATimeline::B,
+							   curveType + BEZIER_SIZE * 2 - RGBATimeline::BEZIER);
+			a = getBezierValue(time, i, RGBATimeline::A,
+							   curveType + BEZIER_SIZE * 3 - RGBATimeline::BEZIER);
+		}
+	}
+	Color &color = slot->_color;
+	if (alpha == 1)
+		color.set(r, g, b, a);
+	else {
+		if (blend == MixBlend_Setup) color.set(slot->_data._color);
+		color.add((r - color.r) * alpha, (g - color.g) * alpha, (b - color.b) * alpha, (a - color.a) * alpha);
+	}
 }
 
 void RGBATimeline::setFrame(int frame, float time, float r, float g, float b, float a) {
@@ -336,14 +271,6 @@ RGBA2Timeline::RGBA2Timeline(size_t frameCount, size_t bezierCount, int slotInde
 }
 
 //For compatibility
-RGBA2Timeline::RGBA2Timeline(size_t frameCount, int slotIndex)
-    : CurveTimeline(frameCount, RGBA2Timeline::ENTRIES), _slotIndex(slotIndex) {
-	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex,
-						((PropertyId) Property_Alpha << 32) | slotIndex,
-						((PropertyId) Property_Rgb2 << 32) | slotIndex};
-	setPropertyIds(ids, 3);
-}
-
 RGBA2Timeline::~RGBA2Timeline() {
 }
 
@@ -353,183 +280,92 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-	if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -8;
-        static const int PREV_R = -7;
-        static const int PREV_G = -6;
-        static const int PREV_B = -5;
-        static const int PREV_A = -4;
-        static const int PREV_R2 = -3;
-        static const int PREV_G2 = -2;
-        static const int PREV_B2 = -1;
-
-        Slot *slotP = skeleton._slots[_slotIndex];
-        Slot &slot = *slotP;
-        if (!slot._bone.isActive()) return;
-
-        if (time < _frames[0]) {
-            // Time is before first frame.
-            switch (blend) {
-                case MixBlend_Setup:
-                    slot.getColor().set(slot.getData().getColor());
-                    slot.getDarkColor().set(slot.getData().getDarkColor());
-                    return;
-                case MixBlend_First: {
-                    Color &color = slot.getColor();
-                    color.r += (color.r - slot._data.getColor().r) * alpha;
-                    color.g += (color.g - slot._data.getColor().g) * alpha;
-                    color.b += (color.b - slot._data.getColor().b) * alpha;
-                    color.a += (color.a - slot._data.getColor().a) * alpha;
-
-                    Color &darkColor = slot.getDarkColor();
-                    darkColor.r += (darkColor.r - slot._data.getDarkColor().r) * alpha;
-                    darkColor.g += (darkColor.g - slot._data.getDarkColor().g) * alpha;
-                    darkColor.b += (darkColor.b - slot._data.getDarkColor().b) * alpha;
-                    return;
-                }
-                default:
-                    return;
-            }
-        }
-
-        float r, g, b, a, r2, g2, b2;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            size_t i = _frames.size();
-            r = _frames[i + PREV_R];
-            g = _frames[i + PREV_G];
-            b = _frames[i + PREV_B];
-            a = _frames[i + PREV_A];
-            r2 = _frames[i + PREV_R2];
-            g2 = _frames[i + PREV_G2];
-            b2 = _frames[i + PREV_B2];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            size_t frame = (size_t)Animation::binarySearch(_frames, time, ENTRIES);
-            r = _frames[frame + PREV_R];
-            g = _frames[frame + PREV_G];
-            b = _frames[frame + PREV_B];
-            a = _frames[frame + PREV_A];
-            r2 = _frames[frame + PREV_R2];
-            g2 = _frames[frame + PREV_G2];
-            b2 = _frames[frame + PREV_B2];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            r += (_frames[frame + R] - r) * percent;
-            g += (_frames[frame + G] - g) * percent;
-            b += (_frames[frame + B] - b) * percent;
-            a += (_frames[frame + A] - a) * percent;
-            r2 += (_frames[frame + R2] - r2) * percent;
-            g2 += (_frames[frame + G2] - g2) * percent;
-            b2 += (_frames[frame + B2] - b2) * percent;
-        }
-
-        if (alpha == 1) {
-            Color &color = slot.getColor();
-            color.set(r, g, b, a);
-
-            Color &darkColor = slot.getDarkColor();
-            darkColor.set(r2, g2, b2, 1);
-        } else {
-            Color &light = slot._color;
-            Color &dark = slot._darkColor;
-            if (blend == MixBlend_Setup) {
-                light.set(slot._data._color);
-                dark.set(slot._data._darkColor);
-            }
-            light.add((r - light.r) * alpha, (g - light.g) * alpha, (b - light.b) * alpha, (a - light.a) * alpha);
-            dark.add((r2 - dark.r) * alpha, (g2 - dark.g) * alpha, (b2 - dark.b) * alpha, 0);
-        }
-    } else {
-        Slot *slot = skeleton._slots[_slotIndex];
-        if (!slot->_bone._active) return;
-
-        if (time < _frames[0]) {
-            Color &light = slot->_color, &dark = slot->_darkColor, &setupLight = slot->_data._color, &setupDark = slot->_data._darkColor;
-            switch (blend) {
-                case MixBlend_Setup:
-                    light.set(setupLight);
-                    dark.set(setupDark.r, setupDark.g, setupDark.b);
-                    return;
-                case MixBlend_First:
-                    light.add((setupLight.r - light.r) * alpha, (setupLight.g - light.g) * alpha,
-                              (setupLight.b - light.b) * alpha,
-                              (setupLight.a - light.a) * alpha);
-                    dark.r += (setupDark.r - dark.r) * alpha;
-                    dark.g += (setupDark.g - dark.g) * alpha;
-                    dark.b += (setupDark.b - dark.b) * alpha;
-                default: {
-                }
-            }
-            return;
-        }
-
-        float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
-        int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
-        int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
-        switch (curveType) {
-            case RGBA2Timeline::LINEAR: {
-                float before = _frames[i];
-                r = _frames[i + RGBA2Timeline::R];
-                g = _frames[i + RGBA2Timeline::G];
-                b = _frames[i + RGBA2Timeline::B];
-                a = _frames[i + RGBA2Timeline::A];
-                r2 = _frames[i + RGBA2Timeline::R2];
-                g2 = _frames[i + RGBA2Timeline::G2];
-                b2 = _frames[i + RGBA2Timeline::B2];
-                float t = (time - before) / (_frames[i + RGBA2Timeline::ENTRIES] - before);
-                r += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::R] - r) * t;
-                g += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::G] - g) * t;
-                b += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::B] - b) * t;
-                a += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::A] - a) * t;
-                r2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::R2] - r2) * t;
-                g2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::G2] - g2) * t;
-                b2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::B2] - b2) * t;
-                break;
-            }
-            case RGBA2Timeline::STEPPED: {
-                r = _frames[i + RGBA2Timeline::R];
-                g = _frames[i + RGBA2Timeline::G];
-                b = _frames[i + RGBA2Timeline::B];
-                a = _frames[i + RGBA2Timeline::A];
-                r2 = _frames[i + RGBA2Timeline::R2];
-                g2 = _frames[i + RGBA2Timeline::G2];
-                b2 = _frames[i + RGBA2Timeline::B2];
-                break;
-            }
-            default: {
-                r = getBezierValue(time, i, RGBA2Timeline::R, curveType - RGBA2Timeline::BEZIER);
-                g = getBezierValue(time, i, RGBA2Timeline::G,
-                                   curveType + BEZIER_SIZE - RGBA2Timeline::BEZIER);
-                b = getBezierValue(time, i, RGBA2Timeline::B,
-                                   curveType + BEZIER_SIZE * 2 - RGBA2Timeline::BEZIER);
-                a = getBezierValue(time, i, RGBA2Timeline::A,
-                                   curveType + BEZIER_SIZE * 3 - RGBA2Timeline::BEZIER);
-                r2 = getBezierValue(time, i, RGBA2Timeline::R2,
-                                    curveType + BEZIER_SIZE * 4 - RGBA2Timeline::BEZIER);
-                g2 = getBezierValue(time, i, RGBA2Timeline::G2,
-                                    curveType + BEZIER_SIZE * 5 - RGBA2Timeline::BEZIER);
-                b2 = getBezierValue(time, i, RGBA2Timeline::B2,
-                                    curveType + BEZIER_SIZE * 6 - RGBA2Timeline::BEZIER);
-            }
-        }
-        Color &light = slot->_color, &dark = slot->_darkColor;
-        if (alpha == 1) {
-            light.set(r, g, b, a);
-            dark.set(r2, g2, b2);
-        } else {
-            if (blend == MixBlend_Setup) {
-                light.set(slot->_data._color);
-                dark.set(slot->_data._darkColor);
-            }
-            light.add((r - light.r) * alpha, (g - light.g) * alpha, (b - light.b) * alpha, (a - light.a) * alpha);
-            dark.r += (r2 - dark.r) * alpha;
-            dark.g += (g2 - dark.g) * alpha;
-            dark.b += (b2 - dark.b) * alpha;
-        }
-    }
+	Slot *slot = skeleton._slots[_slotIndex];
+	if (!slot->_bone._active) return;
+
+	if (time < _frames[0]) {
+		Color &light = slot->_color, &dark = slot->_darkColor, &setupLight = slot->_data._color, &setupDark = slot->_data._darkColor;
+		switch (blend) {
+			case MixBlend_Setup:
+				light.set(setupLight);
+				dark.set(setupDark.r, setupDark.g, setupDark.b);
+				return;
+			case MixBlend_First:
+				light.add((setupLight.r - light.r) * alpha, (setupLight.g - light.g) * alpha,
+						  (setupLight.b - light.b) * alpha,
+						  (setupLight.a - light.a) * alpha);
+				dark.r += (setupDark.r - dark.r) * alpha;
+				dark.g += (setupDark.g - dark.g) * alpha;
+				dark.b += (setupDark.b - dark.b) * alpha;
+			default: {
+			}
+		}
+		return;
+	}
+
+	float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
+	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
+	int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
+	switch (curveType) {
+		case RGBA2Timeline::LINEAR: {
+			float before = _frames[i];
+			r = _frames[i + RGBA2Timeline::R];
+			g = _frames[i + RGBA2Timeline::G];
+			b = _frames[i + RGBA2Timeline::B];
+			a = _frames[i + RGBA2Timeline::A];
+			r2 = _frames[i + RGBA2Timeline::R2];
+			g2 = _frames[i + RGBA2Timeline::G2];
+			b2 = _frames[i + RGBA2Timeline::B2];
+			float t = (time - before) / (_frames[i + RGBA2Timeline::ENTRIES] - before);
+			r += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::R] - r) * t;
+			g += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::G] - g) * t;
+			b += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::B] - b) * t;
+			a += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::A] - a) * t;
+			r2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::R2] - r2) * t;
+			g2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::G2] - g2) * t;
+			b2 += (_frames[i + RGBA2Timeline::ENTRIES + RGBA2Timeline::B2] - b2) * t;
+			break;
+		}
+		case RGBA2Timeline::STEPPED: {
+			r = _frames[i + RGBA2Timeline::R];
+			g = _frames[i + RGBA2Timeline::G];
+			b = _frames[i + RGBA2Timeline::B];
+			a = _frames[i + RGBA2Timeline::A];
+			r2 = _frames[i + RGBA2Timeline::R2];
+			g2 = _frames[i + RGBA2Timeline::G2];
+			b2 = _frames[i + RGBA2Timeline::B2];
+			break;
+		}
+		default: {
+			r = getBezierValue(time, i, RGBA2Timeline::R, curveType - RGBA2Timeline::BEZIER);
+			g = getBezierValue(time, i, RGBA2Timeline::G,
+							   curveType + BEZIER_SIZE - RGBA2Timeline::BEZIER);
+			b = getBezierValue(time, i, RGBA2Timeline::B,
+							   curveType + BEZIER_SIZE * 2 - RGBA2Timeline::BEZIER);
+			a = getBezierValue(time, i, RGBA2Timeline::A,
+							   curveType + BEZIER_SIZE * 3 - RGBA2Timeline::BEZIER);
+			r2 = getBezierValue(time, i, RGBA2Timeline::R2,
+								curveType + BEZIER_SIZE * 4 - RGBA2Timeline::BEZIER);
+			g2 = getBezierValue(time, i, RGBA2Timeline::G2,
+								curveType + BEZIER_SIZE * 5 - RGBA2Timeline::BEZIER);
+			b2 = getBezierValue(time, i, RGBA2Timeline::B2,
+								curveType + BEZIER_SIZE * 6 - RGBA2Timeline::BEZIER);
+		}
+	}
+	Color &light = slot->_color, &dark = slot->_darkColor;
+	if (alpha == 1) {
+		light.set(r, g, b, a);
+		dark.set(r2, g2, b2);
+	} else {
+		if (blend == MixBlend_Setup) {
+			light.set(slot->_data._color);
+			dark.set(slot->_data._darkColor);
+		}
+		light.add((r - light.r) * alpha, (g - light.g) * alpha, (b - light.b) * alpha, (a - light.a) * alpha);
+		dark.r += (r2 - dark.r) * alpha;
+		dark.g += (g2 - dark.g) * alpha;
+		dark.b += (b2 - dark.b) * alpha;
+	}
 }
 
 void RGBA2Timeline::setFrame(int frame, float time, float r, float g, float b, float a, float r2, float g2, float b2) {
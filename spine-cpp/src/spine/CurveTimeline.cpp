@@ -29,6 +29,7 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
 using namespace spine;
@@ -37,17 +38,10 @@ RTTI_IMPL(CurveTimeline, Timeline)
 
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
 																									frameEntries) {
-    //const int CurveTimeline::BEZIER_SIZE = 10 * 2 - 1;
-    //_curves.setSize((frameCount - 1) * BEZIER_SIZE, 0);
-    _curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
+	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
 }
 
-CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries) : Timeline(frameCount, frameEntries) {
-    BEZIER_SIZE = 10 * 2 - 1;
-    _curves.setSize((frameCount - 1) * BEZIER_SIZE, 0);
-}
-
 CurveTimeline::~CurveTimeline() {
 }
 
@@ -80,63 +74,6 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 	}
 }
 
-void CurveTimeline::setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2) {
-    float tmpx = (-cx1 * 2 + cx2) * 0.03f, tmpy = (-cy1 * 2 + cy2) * 0.03f;
-    float dddfx = ((cx1 - cx2) * 3 + 1) * 0.006f, dddfy = ((cy1 - cy2) * 3 + 1) * 0.006f;
-    float ddfx = tmpx * 2 + dddfx, ddfy = tmpy * 2 + dddfy;
-    float dfx = cx1 * 0.3f + tmpx + dddfx * 0.16666667f, dfy = cy1 * 0.3f + tmpy + dddfy * 0.16666667f;
-
-    size_t i = frameIndex * BEZIER_SIZE;
-    _curves[i++] = BEZIER;
-
-    float x = dfx, y = dfy;
-    for (size_t n = i + BEZIER_SIZE - 1; i < n; i += 2) {
-        _curves[i] = x;
-        _curves[i + 1] = y;
-        dfx += ddfx;
-        dfy += ddfy;
-        ddfx += dddfx;
-        ddfy += dddfy;
-        x += dfx;
-        y += dfy;
-    }
-}
-
-float CurveTimeline::getCurvePercent(size_t frameIndex, float percent) {
-    percent = MathUtil::clamp(percent, 0, 1);
-    size_t i = frameIndex * BEZIER_SIZE;
-    float type = _curves[i];
-
-    if (type == LINEAR) {
-        return percent;
-    }
-
-    if (type == STEPPED) {
-        return 0;
-    }
-
-    i++;
-    float x = 0;
-    for (size_t start = i, n = i + BEZIER_SIZE - 1; i < n; i += 2) {
-        x = _curves[i];
-        if (x >= percent) {
-            float prevX, prevY;
-            if (i == start) {
-                prevX = 0;
-                prevY = 0;
-            } else {
-                prevX = _curves[i - 2];
-                prevY = _curves[i - 1];
-            }
-            return prevY + (_curves[i + 1] - prevY) * (percent - prevX) / (x - prevX);
-        }
-    }
-
-    float y = _curves[i - 1];
-
-    return y + (1 - y) * (percent - x) / (1 - x); // Last point is 1,1.
-}
-
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
 	if (_curves[i] > time) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
@@ -154,6 +91,29 @@ float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueO
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
+void CurveTimeline::setNormalizedCurves(Vector<float> &curves, size_t valueCount) {
+	size_t frameCount = getFrameCount(), frameEntries = getFrameEntries();
+	size_t beziers = valueCount > 0 ? valueCount : 1;
+	_curves.setSize(frameCount + curves.size() / 5 * beziers * BEZIER_SIZE, 0);
+	for (size_t i = 0, bezier = 0, n = curves.size(); i < n; i += 5) {
+		size_t frame = (size_t) curves[i];
+		if (frame + 1 >= frameCount) continue;
+		float cx1 = curves[i + 1], cy1 = curves[i + 2], cx2 = curves[i + 3], cy2 = curves[i + 4];
+		size_t offset = frame * frameEntries;
+		float time1 = _frames[offset], time2 = _frames[offset + frameEntries], duration = time2 - time1;
+		if (valueCount == 0) {
+			setBezier(bezier++, frame, 0, time1, 0, time1 + cx1 * duration, cy1, time1 + cx2 * duration, cy2, time2, 1);
+			continue;
+		}
+		for (size_t value = 0; value < valueCount; value++) {
+			float value1 = _frames[offset + 1 + value], value2 = _frames[offset + frameEntries + 1 + value];
+			float change = value2 - value1;
+			setBezier(bezier++, frame, value, time1, value1, time1 + cx1 * duration, value1 + cy1 * change,
+					  time1 + cx2 * duration, value1 + cy2 * change, time2, value2);
+		}
+	}
+}
+
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
@@ -165,9 +125,6 @@ CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTim
 																					  bezierCount) {
 }
 
-CurveTimeline1::CurveTimeline1(size_t frameCount) : CurveTimeline(frameCount, CurveTimeline1::ENTRIES) {
-}
-
 CurveTimeline1::~CurveTimeline1() {
 }
 
@@ -178,13 +135,7 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 }
 
 float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -308,9 +259,6 @@ CurveTimeline2::CurveTimeline2(size_t frameCount, size_t bezierCount) : CurveTim
 																					  bezierCount) {
 }
 
-CurveTimeline2::CurveTimeline2(size_t frameCount) : CurveTimeline(frameCount, CurveTimeline2::ENTRIES) {
-}
-
 CurveTimeline2::~CurveTimeline2() {
 }
 
@@ -56,18 +56,6 @@ DeformTimeline::DeformTimeline(size_t frameCount, size_t bezierCount, int slotIn
 	}
 }
 
-DeformTimeline::DeformTimeline(size_t frameCount, int slotIndex, VertexAttachment* attachment)
-    : CurveTimeline(frameCount, 1), _slotIndex(slotIndex), _attachment(attachment) {
-    PropertyId ids[] = { ((PropertyId)Property_Deform << 32) | ((slotIndex << 16 | attachment->_id) & 0xffffffff) };
-    setPropertyIds(ids, 1);
-
-    _vertices.ensureCapacity(frameCount);
-    for (size_t i = 0; i < frameCount; ++i) {
-        Vector<float> vec;
-        _vertices.add(vec);
-    }
-}
-
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 						   MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
@@ -78,387 +66,195 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
     Slot &slot = *slotP;
     if (!slot._bone.isActive()) return;
 
-    if(BEZIER_SIZE != 18) {
-        Attachment *slotAttachment = slot.getAttachment();
-        if (slotAttachment == NULL || !slotAttachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
-            return;
-        }
-
-        VertexAttachment *attachment = static_cast<VertexAttachment *>(slotAttachment);
-        if (attachment->_timelineAttachment != _attachment) {
-            return;
-        }
-
-        Vector<float> &deformArray = slot._deform;
-        if (deformArray.size() == 0) {
-            blend = MixBlend_Setup;
-        }
-
-        Vector< Vector<float> > &frameVertices = _vertices;
-        size_t vertexCount = frameVertices[0].size();
-
-        Vector<float> &frames = _frames;
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    deformArray.clear();
-                    return;
-                case MixBlend_First: {
-                    if (alpha == 1) {
-                        deformArray.clear();
-                        return;
-                    }
-                    deformArray.setSize(vertexCount, 0);
-                    Vector<float> &deformInner = deformArray;
-                    if (attachment->getBones().size() == 0) {
-                        // Unweighted vertex positions.
-                        Vector<float> &setupVertices = attachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deformInner[i] += (setupVertices[i] - deformInner[i]) * alpha;
-                    } else {
-                        // Weighted deform offsets.
-                        alpha = 1 - alpha;
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deformInner[i] *= alpha;
-                    }
-                }
-                case MixBlend_Replace:
-                case MixBlend_Add:
-                    return;
-            }
-        }
-
-        deformArray.setSize(vertexCount, 0);
-        Vector<float> &deform = deformArray;
-
-        if (time >= frames[frames.size() - 1]) { // Time is after last frame.
-            Vector<float> &lastVertices = frameVertices[frames.size() - 1];
-            if (alpha == 1) {
-                if (blend == MixBlend_Add) {
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment*>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, no alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += lastVertices[i] - setupVertices[i];
-                    } else {
-                        // Weighted deform offsets, no alpha.
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += lastVertices[i];
-                    }
-                } else {
-                    // Vertex positions or deform offsets, no alpha.
-                    memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
-                }
-            } else {
-                switch (blend) {
-                    case MixBlend_Setup: {
-                        VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                        if (vertexAttachment->getBones().size() == 0) {
-                            // Unweighted vertex positions, with alpha.
-                            Vector<float> &setupVertices = vertexAttachment->getVertices();
-                            for (size_t i = 0; i < vertexCount; i++) {
-                                float setup = setupVertices[i];
-                                deform[i] = setup + (lastVertices[i] - setup) * alpha;
-                            }
-                        } else {
-                            // Weighted deform offsets, with alpha.
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] = lastVertices[i] * alpha;
-                        }
-                        break;
-                    }
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        // Vertex positions or deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += (lastVertices[i] - deform[i]) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                        if (vertexAttachment->getBones().size() == 0) {
-                            // Unweighted vertex positions, no alpha.
-                            Vector<float> &setupVertices = vertexAttachment->getVertices();
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
-                        } else {
-                            // Weighted deform offsets, alpha.
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] += lastVertices[i] * alpha;
-                        }
-                }
-            }
-            return;
-        }
-
-        // Interpolate between the previous frame and the current frame.
-        int frame = Animation::binarySearch(frames, time);
-        Vector<float> &prevVertices = frameVertices[frame - 1];
-        Vector<float> &nextVertices = frameVertices[frame];
-        float frameTime = frames[frame];
-        float percent = getCurvePercent(1 - (time - frameTime) / (frames[frame - 1] - frameTime), frame - 1);
-
-        if (alpha == 1) {
-            if (blend == MixBlend_Add) {
-                VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                if (vertexAttachment->getBones().size() == 0) {
-                    // Unweighted vertex positions, no alpha.
-                    Vector<float> &setupVertices = vertexAttachment->getVertices();
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
-                    }
-                } else {
-                    // Weighted deform offsets, no alpha.
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += prev + (nextVertices[i] - prev) * percent;
-                    }
-                }
-            } else {
-                // Vertex positions or deform offsets, no alpha.
-                for (size_t i = 0; i < vertexCount; i++) {
-                    float prev = prevVertices[i];
-                    deform[i] = prev + (nextVertices[i] - prev) * percent;
-                }
-            }
-        } else {
-            switch (blend) {
-                case MixBlend_Setup: {
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, with alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i], setup = setupVertices[i];
-                            deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
-                        }
-                    } else {
-                        // Weighted deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
-                        }
-                    }
-                    break;
-                }
-                case MixBlend_First:
-                case MixBlend_Replace:
-                    // Vertex positions or deform offsets, with alpha.
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
-                    }
-                    break;
-                case MixBlend_Add:
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, with alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
-                        }
-                    } else {
-                        // Weighted deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
-                        }
-                    }
-            }
-        }
-    } else {
-        Attachment *slotAttachment = slot.getAttachment();
-        if (slotAttachment == NULL || !slotAttachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
-            return;
-        }
-
-        VertexAttachment *attachment = static_cast<VertexAttachment *>(slotAttachment);
-        if (attachment->_timelineAttachment != _attachment) {
-            return;
-        }
-
-        Vector<float> &deformArray = slot._deform;
-        if (deformArray.size() == 0) {
-            blend = MixBlend_Setup;
-        }
-
-        Vector<Vector<float>> &vertices = _vertices;
-        size_t vertexCount = vertices[0].size();
+	Attachment *slotAttachment = slot.getAttachment();
+	if (slotAttachment == NULL || !slotAttachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
+		return;
+	}
 
-        Vector<float> &frames = _frames;
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    deformArray.clear();
-                    return;
-                case MixBlend_First: {
-                    if (alpha == 1) {
-                        deformArray.clear();
-                        return;
-                    }
-                    deformArray.setSize(vertexCount, 0);
-                    Vector<float> &deform = deformArray;
-                    if (attachment->getBones().size() == 0) {
-                        // Unweighted vertex positions.
-                        Vector<float> &setupVertices = attachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += (setupVertices[i] - deform[i]) * alpha;
-                    } else {
-                        // Weighted deform offsets.
-                        alpha = 1 - alpha;
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] *= alpha;
-                    }
-                }
-                case MixBlend_Replace:
-                case MixBlend_Add: {
-                }
-            }
-            return;
-        }
+	VertexAttachment *attachment = static_cast<VertexAttachment *>(slotAttachment);
+	if (attachment->_timelineAttachment != _attachment) {
+		return;
+	}
 
-        deformArray.setSize(vertexCount, 0);
-        Vector<float> &deform = deformArray;
+	Vector<float> &deformArray = slot._deform;
+	if (deformArray.size() == 0) {
+		blend = MixBlend_Setup;
+	}
 
-        if (time >= frames[frames.size() - 1]) {// Time is after last frame.
-            Vector<float> &lastVertices = vertices[frames.size() - 1];
-            if (alpha == 1) {
-                if (blend == MixBlend_Add) {
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, no alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += lastVertices[i] - setupVertices[i];
-                    } else {
-                        // Weighted deform offsets, no alpha.
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += lastVertices[i];
-                    }
-                } else {
-                    // Vertex positions or deform offsets, no alpha.
-                    memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
-                }
-            } else {
-                switch (blend) {
-                    case MixBlend_Setup: {
-                        VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                        if (vertexAttachment->getBones().size() == 0) {
-                            // Unweighted vertex positions, with alpha.
-                            Vector<float> &setupVertices = vertexAttachment->getVertices();
-                            for (size_t i = 0; i < vertexCount; i++) {
-                                float setup = setupVertices[i];
-                                deform[i] = setup + (lastVertices[i] - setup) * alpha;
-                            }
-                        } else {
-                            // Weighted deform offsets, with alpha.
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] = lastVertices[i] * alpha;
-                        }
-                        break;
-                    }
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        // Vertex positions or deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++)
-                            deform[i] += (lastVertices[i] - deform[i]) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                        if (vertexAttachment->getBones().size() == 0) {
-                            // Unweighted vertex positions, no alpha.
-                            Vector<float> &setupVertices = vertexAttachment->getVertices();
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
-                        } else {
-                            // Weighted deform offsets, alpha.
-                            for (size_t i = 0; i < vertexCount; i++)
-                                deform[i] += lastVertices[i] * alpha;
-                        }
-                }
-            }
-            return;
-        }
+	Vector<Vector<float>> &vertices = _vertices;
+	size_t vertexCount = vertices[0].size();
+
+	Vector<float> &frames = _frames;
+	if (time < _frames[0]) {
+		switch (blend) {
+			case MixBlend_Setup:
+				deformArray.clear();
+				return;
+			case MixBlend_First: {
+				if (alpha == 1) {
+					deformArray.clear();
+					return;
+				}
+				deformArray.setSize(vertexCount, 0);
+				Vector<float> &deform = deformArray;
+				if (attachment->getBones().size() == 0) {
+					// Unweighted vertex positions.
+					Vector<float> &setupVertices = attachment->getVertices();
+					for (size_t i = 0; i < vertexCount; i++)
+						deform[i] += (setupVertices[i] - deform[i]) * alpha;
+				} else {
+					// Weighted deform offsets.
+					alpha = 1 - alpha;
+					for (size_t i = 0; i < vertexCount; i++)
+						deform[i] *= alpha;
+				}
+			}
+			case MixBlend_Replace:
+			case MixBlend_Add: {
+			}
+		}
+		return;
+	}
 
-        // Interpolate between the previous frame and the current frame.
-        int frame = Animation::search(frames, time);
-        float percent = getCurvePercent(time, frame);
-        Vector<float> &prevVertices = vertices[frame];
-        Vector<float> &nextVertices = vertices[frame + 1];
+	deformArray.setSize(vertexCount, 0);
+	Vector<float> &deform = deformArray;
+
+	if (time >= frames[frames.size() - 1]) {// Time is after last frame.
+		Vector<float> &lastVertices = vertices[frames.size() - 1];
+		if (alpha == 1) {
+			if (blend == MixBlend_Add) {
+				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+				if (vertexAttachment->getBones().size() == 0) {
+					// Unweighted vertex positions, no alpha.
+					Vector<float> &setupVertices = vertexAttachment->getVertices();
+					for (size_t i = 0; i < vertexCount; i++)
+						deform[i] += lastVertices[i] - setupVertices[i];
+				} else {
+					// Weighted deform offsets, no alpha.
+					for (size_t i = 0; i < vertexCount; i++)
+						deform[i] += lastVertices[i];
+				}
+			} else {
+				// Vertex positions or deform offsets, no alpha.
+				memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
+			}
+		} else {
+			switch (blend) {
+				case MixBlend_Setup: {
+					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+					if (vertexAttachment->getBones().size() == 0) {
+						// Unweighted vertex positions, with alpha.
+						Vector<float> &setupVertices = vertexAttachment->getVertices();
+						for (size_t i = 0; i < vertexCount; i++) {
+							float setup = setupVertices[i];
+							deform[i] = setup + (lastVertices[i] - setup) * alpha;
+						}
+					} else {
+						// Weighted deform offsets, with alpha.
+						for (size_t i = 0; i < vertexCount; i++)
+							deform[i] = lastVertices[i] * alpha;
+					}
+					break;
+				}
+				case MixBlend_First:
+				case MixBlend_Replace:
+					// Vertex positions or deform offsets, with alpha.
+					for (size_t i = 0; i < vertexCount; i++)
+						deform[i] += (lastVertices[i] - deform[i]) * alpha;
+					break;
+				case MixBlend_Add:
+					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+					if (vertexAttachment->getBones().size() == 0) {
+						// Unweighted vertex positions, no alpha.
+						Vector<float> &setupVertices = vertexAttachment->getVertices();
+						for (size_t i = 0; i < vertexCount; i++)
+							deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
+					} else {
+						// Weighted deform offsets, alpha.
+						for (size_t i = 0; i < vertexCount; i++)
+							deform[i] += lastVertices[i] * alpha;
+					}
+			}
+		}
+		return;
+	}
 
-        if (alpha == 1) {
-            if (blend == MixBlend_Add) {
-                VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                if (vertexAttachment->getBones().size() == 0) {
-                    // Unweighted vertex positions, no alpha.
-                    Vector<float> &setupVertices = vertexAttachment->getVertices();
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
-                    }
-                } else {
-                    // Weighted deform offsets, no alpha.
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += prev + (nextVertices[i] - prev) * percent;
-                    }
-                }
-            } else {
-                // Vertex positions or deform offsets, no alpha.
-                for (size_t i = 0; i < vertexCount; i++) {
-                    float prev = prevVertices[i];
-                    deform[i] = prev + (nextVertices[i] - prev) * percent;
-                }
-            }
-        } else {
-            switch (blend) {
-                case MixBlend_Setup: {
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, with alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i], setup = setupVertices[i];
-                            deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
-                        }
-                    } else {
-                        // Weighted deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
-                        }
-                    }
-                    break;
-                }
-                case MixBlend_First:
-                case MixBlend_Replace:
-                    // Vertex positions or deform offsets, with alpha.
-                    for (size_t i = 0; i < vertexCount; i++) {
-                        float prev = prevVertices[i];
-                        deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
-                    }
-                    break;
-                case MixBlend_Add:
-                    VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-                    if (vertexAttachment->getBones().size() == 0) {
-                        // Unweighted vertex positions, with alpha.
-                        Vector<float> &setupVertices = vertexAttachment->getVertices();
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
-                        }
-                    } else {
-                        // Weighted deform offsets, with alpha.
-                        for (size_t i = 0; i < vertexCount; i++) {
-                            float prev = prevVertices[i];
-                            deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
-                        }
-                    }
-            }
-        }
-    }
+	// Interpolate between the previous frame and the current frame.
+	int frame = Animation::search(frames, time);
+	float percent = getCurvePercent(time, frame);
+	Vector<float> &prevVertices = vertices[frame];
+	Vector<float> &nextVertices = vertices[frame + 1];
+
+	if (alpha == 1) {
+		if (blend == MixBlend_Add) {
+			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+			if (vertexAttachment->getBones().size() == 0) {
+				// Unweighted vertex positions, no alpha.
+				Vector<float> &setupVertices = vertexAttachment->getVertices();
+				for (size_t i = 0; i < vertexCount; i++) {
+					float prev = prevVertices[i];
+					deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
+				}
+			} else {
+				// Weighted deform offsets, no alpha.
+				for (size_t i = 0; i < vertexCount; i++) {
+					float prev = prevVertices[i];
+					deform[i] += prev + (nextVertices[i] - prev) * percent;
+				}
+			}
+		} else {
+			// Vertex positions or deform offsets, no alpha.
+			for (size_t i = 0; i < vertexCount; i++) {
+				float prev = prevVertices[i];
+				deform[i] = prev + (nextVertices[i] - prev) * percent;
+			}
+		}
+	} else {
+		switch (blend) {
+			case MixBlend_Setup: {
+				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+				if (vertexAttachment->getBones().size() == 0) {
+					// Unweighted vertex positions, with alpha.
+					Vector<float> &setupVertices = vertexAttachment->getVertices();
+					for (size_t i = 0; i < vertexCount; i++) {
+						float prev = prevVertices[i], setup = setupVertices[i];
+						deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
+					}
+				} else {
+					// Weighted deform offsets, with alpha.
+					for (size_t i = 0; i < vertexCount; i++) {
+						float prev = prevVertices[i];
+						deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
+					}
+				}
+				break;
+			}
+			case MixBlend_First:
+			case MixBlend_Replace:
+				// Vertex positions or deform offsets, with alpha.
+				for (size_t i = 0; i < vertexCount; i++) {
+					float prev = prevVertices[i];
+					deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
+				}
+				break;
+			case MixBlend_Add:
+				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
+				if (vertexAttachment->getBones().size() == 0) {
+					// Unweighted vertex positions, with alpha.
+					Vector<float> &setupVertices = vertexAttachment->getVertices();
+					for (size_t i = 0; i < vertexCount; i++) {
+						float prev = prevVertices[i];
+						deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
+					}
+				} else {
+					// Weighted deform offsets, with alpha.
+					for (size_t i = 0; i < vertexCount; i++) {
+						float prev = prevVertices[i];
+						deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
+					}
+				}
+		}
+	}
 }
 
 void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float time1, float value1, float cx1, float cy1,
@@ -485,67 +281,32 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 }
 
 float DeformTimeline::getCurvePercent(float time, int frame) {
-    if(BEZIER_SIZE != 18) {
-        time = MathUtil::clamp(time, 0, 1);
-        size_t i = frame * BEZIER_SIZE;
-        float type = _curves[i];
-
-        if (type == LINEAR) {
-            return time;
-        }
-
-        if (type == STEPPED) {
-            return 0;
-        }
-
-        i++;
-        float x = 0;
-        for (size_t start = i, n = i + BEZIER_SIZE - 1; i < n; i += 2) {
-            x = _curves[i];
-            if (x >= time) {
-                float prevX, prevY;
-                if (i == start) {
-                    prevX = 0;
-                    prevY = 0;
-                } else {
-                    prevX = _curves[i - 2];
-                    prevY = _curves[i - 1];
-                }
-                return prevY + (_curves[i + 1] - prevY) * (time - prevX) / (x - prevX);
-            }
-        }
-
-        float y = _curves[i - 1];
-
-        return y + (1 - y) * (time - x) / (1 - x); // Last point is 1,1.
-    } else {
-        int i = (int) _curves[frame];
-        switch (i) {
-            case DeformTimeline::LINEAR: {
-                float x = _frames[frame];
-                return (time - x) / (_frames[frame + getFrameEntries()] - x);
-            }
-            case DeformTimeline::STEPPED: {
-                return 0;
-            }
-            default: {
-            }
-        }
-        i -= DeformTimeline::BEZIER;
-        if (_curves[i] > time) {
-            float x = _frames[frame];
-            return _curves[i + 1] * (time - x) / (_curves[i] - x);
-        }
-        int n = i + BEZIER_SIZE;
-        for (i += 2; i < n; i += 2) {
-            if (_curves[i] >= time) {
-                float x = _curves[i - 2], y = _curves[i - 1];
-                return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-            }
-        }
-        float x = _curves[n - 2], y = _curves[n - 1];
-        return y + (1 - y) * (time - x) / (_frames[frame + getFrameEntries()] - x);
-    }
+	int i = (int) _curves[frame];
+	switch (i) {
+		case DeformTimeline::LINEAR: {
+			float x = _frames[frame];
+			return (time - x) / (_frames[frame + getFrameEntries()] - x);
+		}
+		case DeformTimeline::STEPPED: {
+			return 0;
+		}
+		default: {
+		}
+	}
+	i -= DeformTimeline::BEZIER;
+	if (_curves[i] > time) {
+		float x = _frames[frame];
+		return _curves[i + 1] * (time - x) / (_curves[i] - x);
+	}
+	int n = i + BEZIER_SIZE;
+	for (i += 2; i < n; i += 2) {
+		if (_curves[i] >= time) {
+			float x = _curves[i - 2], y = _curves[i - 1];
+			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
+		}
+	}
+	float x = _curves[n - 2], y = _curves[n - 1];
+	return y + (1 - y) * (time - x) / (_frames[frame + getFrameEntries()] - x);
 }
 
 void DeformTimeline::setFrame(int frame, float time, Vector<float> &vertices) {
@@ -0,0 +1,263 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/DirtyTracker.h>
+
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/IkConstraint.h>
+#include <spine/PathConstraint.h>
+#include <spine/PhysicsConstraint.h>
+#include <spine/Skeleton.h>
+#include <spine/TransformConstraint.h>
+
+#include <string.h>
+
+using namespace spine;
+
+DirtyTracker::DirtyTracker() : _x(0), _y(0), _scaleX(0), _scaleY(0), _physics(Physics_None), _updatedCount(0),
+							   _valid(false) {
+}
+
+static bool isChanged(Vector<unsigned char> &changed, Bone *bone) {
+	return bone && changed[bone->getData().getIndex()];
+}
+
+static bool isAnyChanged(Vector<unsigned char> &changed, Vector<Bone *> &bones) {
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		if (changed[bones[i]->getData().getIndex()]) return true;
+	return false;
+}
+
+static void setChanged(Vector<unsigned char> &changed, Vector<unsigned char> &recompute, Bone *bone) {
+	size_t index = bone->getData().getIndex();
+	changed[index] = 1;
+	recompute[index] = 1;
+}
+
+void DirtyTracker::update(Skeleton &skeleton, Physics physics) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	size_t boneCount = bones.size(), cacheCount = updateCache.size();
+	if (!_valid || physics != _physics || skeleton.getX() != _x || skeleton.getY() != _y ||
+		skeleton.getScaleX() != _scaleX || skeleton.getScaleY() != _scaleY || _bones.size() != boneCount * BoneValues ||
+		_kinds.size() != cacheCount) {
+		updateAll(skeleton, physics);
+		return;
+	}
+
+	float values[BoneValues > ConstraintValues ? BoneValues : ConstraintValues];
+	for (size_t i = 0; i < boneCount; i++) {
+		getBoneValues(bones[i], values);
+		unsigned char changed = memcmp(values, _bones.buffer() + i * BoneValues, BoneValues * sizeof(float)) != 0;
+		_changed[i] = changed;
+		_recompute[i] = changed;
+	}
+
+	// Propagate changes in update order: down the hierarchy, and through the constraints to the bones they write.
+	for (size_t i = 0; i < cacheCount; i++) {
+		Updatable *updatable = updateCache[i];
+		bool apply;
+		switch (_kinds[i]) {
+			case Kind_Bone: {
+				int bone = _cacheBones[i], parent = _parents[bone];
+				if (parent != -1 && _changed[parent]) {
+					_changed[bone] = 1;
+					_recompute[bone] = 1;
+				}
+				continue;
+			}
+			case Kind_IkConstraint: {
+				IkConstraint *constraint = (IkConstraint *) updatable;
+				apply = isChanged(_changed, constraint->getTarget()) || isAnyChanged(_changed, constraint->getBones());
+				float *previous = _constraints.buffer() + i * ConstraintValues;
+				getConstraintValues(updatable, Kind_IkConstraint, values);
+				if (memcmp(values, previous, ConstraintValues * sizeof(float)) != 0) {
+					memcpy(previous, values, ConstraintValues * sizeof(float));
+					apply = true;
+				}
+				if (apply) {
+					Vector<Bone *> &constrained = constraint->getBones();
+					for (size_t ii = 0, n = constrained.size(); ii < n; ii++) setChanged(_changed, _recompute, constrained[ii]);
+				}
+				break;
+			}
+			case Kind_TransformConstraint: {
+				TransformConstraint *constraint = (TransformConstraint *) updatable;
+				apply = isChanged(_changed, constraint->getTarget()) || isAnyChanged(_changed, constraint->getBones());
+				float *previous = _constraints.buffer() + i * ConstraintValues;
+				getConstraintValues(updatable, Kind_TransformConstraint, values);
+				if (memcmp(values, previous, ConstraintValues * sizeof(float)) != 0) {
+					memcpy(previous, values, ConstraintValues * sizeof(float));
+					apply = true;
+				}
+				if (apply) {
+					Vector<Bone *> &constrained = constraint->getBones();
+					for (size_t ii = 0, n = constrained.size(); ii < n; ii++) setChanged(_changed, _recompute, constrained[ii]);
+				}
+				break;
+			}
+			case Kind_PathConstraint: {
+				apply = true;
+				Vector<Bone *> &constrained = ((PathConstraint *) updatable)->getBones();
+				for (size_t ii = 0, n = constrained.size(); ii < n; ii++) setChanged(_changed, _recompute, constrained[ii]);
+				break;
+			}
+			case Kind_PhysicsConstraint:
+				apply = physics != Physics_None;
+				if (apply) setChanged(_changed, _recompute, ((PhysicsConstraint *) updatable)->getBone());
+				break;
+			default:
+				// Which bones an unknown updatable reads or writes is not known.
+				updateAll(skeleton, physics);
+				return;
+		}
+		_apply[i] = apply;
+	}
+
+	_updatedCount = 0;
+	for (size_t i = 0; i < boneCount; i++) {
+		if (!_recompute[i]) continue;
+		Bone *bone = bones[i];
+		bone->_ax = bone->_x;
+		bone->_ay = bone->_y;
+		bone->_arotation = bone->_rotation;
+		bone->_ascaleX = bone->_scaleX;
+		bone->_ascaleY = bone->_scaleY;
+		bone->_ashearX = bone->_shearX;
+		bone->_ashearY = bone->_shearY;
+	}
+	for (size_t i = 0; i < cacheCount; i++) {
+		bool update = _kinds[i] == Kind_Bone ? _recompute[_cacheBones[i]] != 0 : _apply[i] != 0;
+		if (!update) continue;
+		updateCache[i]->update(physics);
+		_updatedCount++;
+	}
+
+	// Only recomputed bones can differ from the values compared above, and the constraint values were stored then.
+	for (size_t i = 0; i < boneCount; i++)
+		if (_recompute[i]) getBoneValues(bones[i], _bones.buffer() + i * BoneValues);
+}
+
+void DirtyTracker::updateAll(Skeleton &skeleton, Physics physics) {
+	skeleton.updateAllWorldTransforms(physics);
+	_updatedCount = skeleton.getUpdateCacheList().size();
+
+	// The update cache and hierarchy only change through Skeleton::updateCache, which invalidates, so they are read here.
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	size_t boneCount = skeleton.getBones().size(), cacheCount = updateCache.size();
+	_bones.setSize(boneCount * BoneValues, 0);
+	_constraints.setSize(cacheCount * ConstraintValues, 0);
+	_changed.setSize(boneCount, 0);
+	_recompute.setSize(boneCount, 0);
+	_apply.setSize(cacheCount, 0);
+	_kinds.setSize(cacheCount, 0);
+	_cacheBones.setSize(cacheCount, -1);
+	_parents.setSize(boneCount, -1);
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0; i < boneCount; i++) {
+		Bone *parent = bones[i]->getParent();
+		_parents[i] = parent ? parent->getData().getIndex() : -1;
+	}
+	for (size_t i = 0; i < cacheCount; i++) {
+		const RTTI &rtti = updateCache[i]->getRTTI();
+		_cacheBones[i] = -1;
+		if (rtti.isExactly(Bone::rtti)) {
+			_kinds[i] = Kind_Bone;
+			_cacheBones[i] = ((Bone *) updateCache[i])->getData().getIndex();
+		} else if (rtti.isExactly(IkConstraint::rtti)) _kinds[i] = Kind_IkConstraint;
+		else if (rtti.isExactly(TransformConstraint::rtti)) _kinds[i] = Kind_TransformConstraint;
+		else if (rtti.isExactly(PathConstraint::rtti)) _kinds[i] = Kind_PathConstraint;
+		else if (rtti.isExactly(PhysicsConstraint::rtti)) _kinds[i] = Kind_PhysicsConstraint;
+		else _kinds[i] = Kind_Unknown;
+	}
+	capture(skeleton, physics);
+}
+
+void DirtyTracker::capture(Skeleton &skeleton, Physics physics) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		getBoneValues(bones[i], _bones.buffer() + i * BoneValues);
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	for (size_t i = 0, n = updateCache.size(); i < n; i++)
+		getConstraintValues(updateCache[i], _kinds[i], _constraints.buffer() + i * ConstraintValues);
+	_x = skeleton.getX();
+	_y = skeleton.getY();
+	_scaleX = skeleton.getScaleX();
+	_scaleY = skeleton.getScaleY();
+	_physics = physics;
+	_valid = true;
+}
+
+void DirtyTracker::getBoneValues(Bone *bone, float *values) {
+	values[0] = bone->_x;
+	values[1] = bone->_y;
+	values[2] = bone->_rotation;
+	values[3] = bone->_scaleX;
+	values[4] = bone->_scaleY;
+	values[5] = bone->_shearX;
+	values[6] = bone->_shearY;
+	values[7] = bone->_ax;
+	values[8] = bone->_ay;
+	values[9] = bone->_arotation;
+	values[10] = bone->_ascaleX;
+	values[11] = bone->_ascaleY;
+	values[12] = bone->_ashearX;
+	values[13] = bone->_ashearY;
+	values[14] = bone->_a;
+	values[15] = bone->_b;
+	values[16] = bone->_c;
+	values[17] = bone->_d;
+	values[18] = bone->_worldX;
+	values[19] = bone->_worldY;
+	values[20] = (float) bone->_inherit;
+}
+
+void DirtyTracker::getConstraintValues(Updatable *updatable, unsigned char kind, float *values) {
+	memset(values, 0, ConstraintValues * sizeof(float));
+	if (kind == Kind_IkConstraint) {
+		IkConstraint *constraint = (IkConstraint *) updatable;
+		values[0] = constraint->getMix();
+		values[1] = constraint->getSoftness();
+		values[2] = (float) constraint->getBendDirection();
+		values[3] = constraint->getCompress() ? 1.0f : 0.0f;
+		values[4] = constraint->getStretch() ? 1.0f : 0.0f;
+		values[5] = (float) constraint->getTarget()->getData().getIndex();
+	} else if (kind == Kind_TransformConstraint) {
+		TransformConstraint *constraint = (TransformConstraint *) updatable;
+		values[0] = constraint->getMixRotate();
+		values[1] = constraint->getMixX();
+		values[2] = constraint->getMixY();
+		values[3] = constraint->getMixScaleX();
+		values[4] = constraint->getMixScaleY();
+		values[5] = constraint->getMixShearY();
+		values[6] = (float) constraint->getTarget()->getData().getIndex();
+	}
+}
@@ -27,34 +27,110 @@
  * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
+#include <spine/Arena.h>
 #include <spine/Extension.h>
+#include <spine/RuntimeContext.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
+#include <string.h>
+
+#include <atomic>
+#include <mutex>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace spine;
 
-SpineExtension *SpineExtension::_instance = NULL;
+static std::atomic<SpineExtension *> instance(NULL);
 
 void SpineExtension::setInstance(SpineExtension *inValue) {
 	assert(inValue);
 
-	_instance = inValue;
+	instance.store(inValue, std::memory_order_release);
 }
 
 SpineExtension *SpineExtension::getInstance() {
-	if (!_instance) _instance = spine::getDefaultExtension();
-	assert(_instance);
+	RuntimeContext *context = RuntimeContext::getCurrent();
+	if (context && context->getExtension()) return context->getExtension();
+
+	SpineExtension *extension = instance.load(std::memory_order_acquire);
+	if (!extension) {
+		// Several threads may make their first allocation at once, only one of them creates the default extension.
+		static std::mutex mutex;
+		std::lock_guard<std::mutex> lock(mutex);
+		extension = instance.load(std::memory_order_relaxed);
+		if (!extension) {
+			extension = spine::getDefaultExtension();
+			instance.store(extension, std::memory_order_release);
+		}
+	}
+	assert(extension);
 
-	return _instance;
+	return extension;
 }
 
 SpineExtension::~SpineExtension() {
 }
 
+void *SpineExtension::allocate(size_t size, bool zero, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && Arena::isAllocating()) {
+		void *ptr = arena->allocate(size);
+		if (zero && ptr) memset(ptr, 0, size);
+		return ptr;
+	}
+	return zero ? getInstance()->_calloc(size, file, line) : getInstance()->_alloc(size, file, line);
+}
+
+void *SpineExtension::reallocate(void *ptr, size_t size, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena) {
+		if (!ptr) {
+			if (Arena::isAllocating()) return arena->allocate(size);
+		} else if (arena->owns(ptr)) {
+			if (Arena::isAllocating()) return arena->reallocate(ptr, size);
+			// Arena memory is never freed individually, so growing it outside an allocating scope moves it to the heap.
+			size_t oldSize = arena->getSize(ptr);
+			void *result = getInstance()->_alloc(size, file, line);
+			if (result) memcpy(result, ptr, oldSize < size ? oldSize : size);
+			return result;
+		}
+	}
+	return getInstance()->_realloc(ptr, size, file, line);
+}
+
+void SpineExtension::deallocate(void *ptr, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && ptr && arena->owns(ptr)) {
+		arena->release(ptr);
+		return;
+	}
+	getInstance()->_free(ptr, file, line);
+}
+
 SpineExtension::SpineExtension() {
 }
 
+const unsigned char *SpineExtension::_mapFile(const String &path, int *length) {
+	return (const unsigned char *) _readFile(path, length);
+}
+
+void SpineExtension::_unmapFile(const unsigned char *data, int length) {
+	SP_UNUSED(length);
+	_free((void *) data, __FILE__, __LINE__);
+}
+
 DefaultSpineExtension::~DefaultSpineExtension() {
 }
 
@@ -123,5 +199,52 @@ char *DefaultSpineExtension::_readFile(const String &path, int *length) {
 #endif
 }
 
+const unsigned char *DefaultSpineExtension::_mapFile(const String &path, int *length) {
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.buffer(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return 0;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		return 0;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping) return 0;
+	void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data) return 0;
+	*length = (int) size.QuadPart;
+	return (const unsigned char *) data;
+#elif !defined(__EMSCRIPTEN__)
+	int fd = open(path.buffer(), O_RDONLY);
+	if (fd < 0) return 0;
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		return 0;
+	}
+	void *data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) return 0;
+	*length = (int) info.st_size;
+	return (const unsigned char *) data;
+#else
+	return SpineExtension::_mapFile(path, length);
+#endif
+}
+
+void DefaultSpineExtension::_unmapFile(const unsigned char *data, int length) {
+	if (!data) return;
+#if defined(_WIN32)
+	SP_UNUSED(length);
+	UnmapViewOfFile(data);
+#elif !defined(__EMSCRIPTEN__)
+	munmap((void *) data, (size_t) length);
+#else
+	SpineExtension::_unmapFile(data, length);
+#endif
+}
+
 DefaultSpineExtension::DefaultSpineExtension() : SpineExtension() {
 }
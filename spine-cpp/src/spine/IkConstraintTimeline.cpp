@@ -49,12 +49,6 @@ IkConstraintTimeline::IkConstraintTimeline(size_t frameCount, size_t bezierCount
 	setPropertyIds(ids, 1);
 }
 
-IkConstraintTimeline::IkConstraintTimeline(size_t frameCount, int ikConstraintIndex)
-	: CurveTimeline(frameCount, IkConstraintTimeline::ENTRIES), _constraintIndex(ikConstraintIndex) {
-	PropertyId ids[] = {((PropertyId) Property_IkConstraint << 32) | ikConstraintIndex};
-	setPropertyIds(ids, 1);
-}
-
 void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 								 MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
@@ -85,123 +79,54 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
         }
     }
 
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -6;
-        static const int PREV_MIX = -5;
-        static const int PREV_SOFTNESS = -4;
-        static const int PREV_BEND_DIRECTION = -3;
-        static const int PREV_COMPRESS = -2;
-        static const int PREV_STRETCH = -1;
-
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            if (blend == MixBlend_Setup) {
-                constraint._mix =
-                        constraint._data._mix + (_frames[_frames.size() + PREV_MIX] - constraint._data._mix) * alpha;
-                constraint._softness = constraint._data._softness
-                                       + (_frames[_frames.size() + PREV_SOFTNESS] - constraint._data._softness) * alpha;
-                if (direction == MixDirection_Out) {
-                    constraint._bendDirection = constraint._data._bendDirection;
-                    constraint._compress = constraint._data._compress;
-                    constraint._stretch = constraint._data._stretch;
-                } else {
-                    constraint._bendDirection = (int) _frames[_frames.size() + PREV_BEND_DIRECTION];
-                    constraint._compress = _frames[_frames.size() + PREV_COMPRESS] != 0;
-                    constraint._stretch = _frames[_frames.size() + PREV_STRETCH] != 0;
-                }
-            } else {
-                constraint._mix += (_frames[_frames.size() + PREV_MIX] - constraint._mix) * alpha;
-                constraint._softness += (_frames[_frames.size() + PREV_SOFTNESS] - constraint._softness) * alpha;
-                if (direction == MixDirection_In) {
-                    constraint._bendDirection = (int) _frames[_frames.size() + PREV_BEND_DIRECTION];
-                    constraint._compress = _frames[_frames.size() + PREV_COMPRESS] != 0;
-                    constraint._stretch = _frames[_frames.size() + PREV_STRETCH] != 0;
-                }
-            }
-            return;
-        }
-
-        // Interpolate between the previous frame and the current frame.
-        int frame = Animation::binarySearch(_frames, time, ENTRIES);
-        float mix = _frames[frame + PREV_MIX];
-        float softness = _frames[frame + PREV_SOFTNESS];
-        float frameTime = _frames[frame];
-        float percent = getCurvePercent(frame / ENTRIES - 1,
-                                        1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-        if (blend == MixBlend_Setup) {
-            constraint._mix =
-                    constraint._data._mix + (mix + (_frames[frame + MIX] - mix) * percent - constraint._data._mix) * alpha;
-            constraint._softness = constraint._data._softness
-                                   + (softness + (_frames[frame + SOFTNESS] - softness) * percent - constraint._data._softness) * alpha;
-            if (direction == MixDirection_Out) {
-                constraint._bendDirection = constraint._data._bendDirection;
-                constraint._compress = constraint._data._compress;
-                constraint._stretch = constraint._data._stretch;
-            } else {
-                constraint._bendDirection = (int) _frames[_frames.size() + PREV_BEND_DIRECTION];
-                constraint._compress = _frames[frame + PREV_COMPRESS] != 0;
-                constraint._stretch = _frames[frame + PREV_STRETCH] != 0;
-            }
-        } else {
-            constraint._mix += (mix + (_frames[frame + MIX] - mix) * percent - constraint._mix) * alpha;
-            constraint._softness += (softness + (_frames[frame + SOFTNESS] - softness) * percent - constraint._softness) * alpha;
-            if (direction == MixDirection_In) {
-                constraint._bendDirection = (int) _frames[frame + PREV_BEND_DIRECTION];
-                constraint._compress = _frames[frame + PREV_COMPRESS] != 0;
-                constraint._stretch = _frames[frame + PREV_STRETCH] != 0;
-            }
-        }
-    } else {
-        float mix = 0, softness = 0;
-        int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES);
-        int curveType = (int) _curves[i / IkConstraintTimeline::ENTRIES];
-        switch (curveType) {
-            case IkConstraintTimeline::LINEAR: {
-                float before = _frames[i];
-                mix = _frames[i + IkConstraintTimeline::MIX];
-                softness = _frames[i + IkConstraintTimeline::SOFTNESS];
-                float t = (time - before) / (_frames[i + IkConstraintTimeline::ENTRIES] - before);
-                mix += (_frames[i + IkConstraintTimeline::ENTRIES + IkConstraintTimeline::MIX] - mix) * t;
-                softness += (_frames[i + IkConstraintTimeline::ENTRIES + IkConstraintTimeline::SOFTNESS] - softness) * t;
-                break;
-            }
-            case IkConstraintTimeline::STEPPED: {
-                mix = _frames[i + IkConstraintTimeline::MIX];
-                softness = _frames[i + IkConstraintTimeline::SOFTNESS];
-                break;
-            }
-            default: {
-                mix = getBezierValue(time, i, IkConstraintTimeline::MIX, curveType - IkConstraintTimeline::BEZIER);
-                softness = getBezierValue(time, i, IkConstraintTimeline::SOFTNESS,
-                                          curveType + BEZIER_SIZE -
-                                          IkConstraintTimeline::BEZIER);
-            }
-        }
-
-        if (blend == MixBlend_Setup) {
-            constraint._mix = constraint._data._mix + (mix - constraint._data._mix) * alpha;
-            constraint._softness = constraint._data._softness + (softness - constraint._data._softness) * alpha;
-
-            if (direction == MixDirection_Out) {
-                constraint._bendDirection = constraint._data._bendDirection;
-                constraint._compress = constraint._data._compress;
-                constraint._stretch = constraint._data._stretch;
-            } else {
-                constraint._bendDirection = _frames[i + IkConstraintTimeline::BEND_DIRECTION];
-                constraint._compress = _frames[i + IkConstraintTimeline::COMPRESS] != 0;
-                constraint._stretch = _frames[i + IkConstraintTimeline::STRETCH] != 0;
-            }
-        } else {
-            constraint._mix += (mix - constraint._mix) * alpha;
-            constraint._softness += (softness - constraint._softness) * alpha;
-            if (direction == MixDirection_In) {
-                constraint._bendDirection = _frames[i + IkConstraintTimeline::BEND_DIRECTION];
-                constraint._compress = _frames[i + IkConstraintTimeline::COMPRESS] != 0;
-                constraint._stretch = _frames[i + IkConstraintTimeline::STRETCH] != 0;
-            }
-        }
-    }
+	float mix = 0, softness = 0;
+	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES);
+	int curveType = (int) _curves[i / IkConstraintTimeline::ENTRIES];
+	switch (curveType) {
+		case IkConstraintTimeline::LINEAR: {
+			float before = _frames[i];
+			mix = _frames[i + IkConstraintTimeline::MIX];
+			softness = _frames[i + IkConstraintTimeline::SOFTNESS];
+			float t = (time - before) / (_frames[i + IkConstraintTimeline::ENTRIES] - before);
+			mix += (_frames[i + IkConstraintTimeline::ENTRIES + IkConstraintTimeline::MIX] - mix) * t;
+			softness += (_frames[i + IkConstraintTimeline::ENTRIES + IkConstraintTimeline::SOFTNESS] - softness) * t;
+			break;
+		}
+		case IkConstraintTimeline::STEPPED: {
+			mix = _frames[i + IkConstraintTimeline::MIX];
+			softness = _frames[i + IkConstraintTimeline::SOFTNESS];
+			break;
+		}
+		default: {
+			mix = getBezierValue(time, i, IkConstraintTimeline::MIX, curveType - IkConstraintTimeline::BEZIER);
+			softness = getBezierValue(time, i, IkConstraintTimeline::SOFTNESS,
+									  curveType + BEZIER_SIZE -
+									  IkConstraintTimeline::BEZIER);
+		}
+	}
+
+	if (blend == MixBlend_Setup) {
+		constraint._mix = constraint._data._mix + (mix - constraint._data._mix) * alpha;
+		constraint._softness = constraint._data._softness + (softness - constraint._data._softness) * alpha;
+
+		if (direction == MixDirection_Out) {
+			constraint._bendDirection = constraint._data._bendDirection;
+			constraint._compress = constraint._data._compress;
+			constraint._stretch = constraint._data._stretch;
+		} else {
+			constraint._bendDirection = _frames[i + IkConstraintTimeline::BEND_DIRECTION];
+			constraint._compress = _frames[i + IkConstraintTimeline::COMPRESS] != 0;
+			constraint._stretch = _frames[i + IkConstraintTimeline::STRETCH] != 0;
+		}
+	} else {
+		constraint._mix += (mix - constraint._mix) * alpha;
+		constraint._softness += (softness - constraint._softness) * alpha;
+		if (direction == MixDirection_In) {
+			constraint._bendDirection = _frames[i + IkConstraintTimeline::BEND_DIRECTION];
+			constraint._compress = _frames[i + IkConstraintTimeline::COMPRESS] != 0;
+			constraint._stretch = _frames[i + IkConstraintTimeline::STRETCH] != 0;
+		}
+	}
 }
 
 void IkConstraintTimeline::setFrame(int frame, float time, float mix, float softness, int bendDirection, bool compress,
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/InternTable.h>
+#include <spine/Arena.h>
+#include <spine/HashMap.h>
+#include <spine/Vector.h>
+
+#include <mutex>
+
+using namespace spine;
+
+// Each string is preceded by the address of its table, which keeps the characters pointer aligned.
+static const size_t HEADER_SIZE = sizeof(void *);
+
+static const size_t BLOCK_SIZE = 4096;
+
+struct InternTable::State : public SpineObject {
+	std::mutex mutex;
+	// Maps each interned string to its characters.
+	HashMap<String, char *> strings;
+	Vector<char *> blocks;
+	char *cursor;
+	size_t remaining;
+
+	State() : cursor(NULL), remaining(0) {
+	}
+
+	~State() {
+		for (size_t i = 0; i < blocks.size(); i++)
+			SpineExtension::free(blocks[i], __FILE__, __LINE__);
+	}
+
+	char *allocate(size_t size) {
+		size = (size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1);
+		if (size > remaining) {
+			// Strings larger than a block get a block of their own, so the current block keeps its free space.
+			if (size > BLOCK_SIZE / 4) {
+				char *block = SpineExtension::alloc<char>(size, __FILE__, __LINE__);
+				blocks.add(block);
+				return block;
+			}
+			cursor = SpineExtension::alloc<char>(BLOCK_SIZE, __FILE__, __LINE__);
+			remaining = BLOCK_SIZE;
+			blocks.add(cursor);
+		}
+		char *memory = cursor;
+		cursor += size;
+		remaining -= size;
+		return memory;
+	}
+};
+
+InternTable::InternTable() : _state(new (__FILE__, __LINE__) State()) {
+}
+
+InternTable::~InternTable() {
+	delete _state;
+}
+
+String InternTable::intern(const char *chars) {
+	String string;
+	if (!chars) return string;
+	String key(chars, true, false);
+
+	string._length = (unsigned int) key.length();
+	string._mode = String::Mode_Interned;
+
+	std::lock_guard<std::mutex> lock(_state->mutex);
+	if (_state->strings.containsKey(key)) {
+		string._buffer = _state->strings[key];
+		return string;
+	}
+
+	ArenaScope heap(NULL);
+	char *memory = _state->allocate(HEADER_SIZE + key.length() + 1);
+	*(InternTable **) memory = this;
+	string._buffer = memory + HEADER_SIZE;
+	memcpy(string._buffer, chars, key.length() + 1);
+	_state->strings.put(string, string._buffer);
+	return string;
+}
+
+String InternTable::intern(const String &string) {
+	if (string.isInterned() && String::internTableOf(string.buffer()) == this) return string;
+	return intern(string.buffer());
+}
+
+size_t InternTable::size() {
+	std::lock_guard<std::mutex> lock(_state->mutex);
+	return _state->strings.size();
+}
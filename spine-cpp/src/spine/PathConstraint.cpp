@@ -49,8 +49,7 @@ const int PathConstraint::AFTER = -3;
 
 PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : Updatable(),
 																			   _data(data),
-																			   _target(skeleton.findSlot(
-																					   data.getTarget()->getName())),
+																			   _target(skeleton.getSlots()[data.getTarget()->getIndex()]),
 																			   _position(data.getPosition()),
 																			   _spacing(data.getSpacing()),
 																			   _mixRotate(data.getMixRotate()),
@@ -60,7 +59,7 @@ PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : U
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); i++) {
 		BoneData *boneData = _data.getBones()[i];
-		_bones.add(skeleton.findBone(boneData->getName()));
+		_bones.add(skeleton.getBones()[boneData->getIndex()]);
 	}
 
 	_segments.setSize(10, 0);
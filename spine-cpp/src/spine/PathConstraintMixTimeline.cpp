@@ -50,13 +50,6 @@ PathConstraintMixTimeline::PathConstraintMixTimeline(size_t frameCount, size_t b
 	setPropertyIds(ids, 1);
 }
 
-PathConstraintMixTimeline::PathConstraintMixTimeline(size_t frameCount, int pathConstraintIndex)
-	: CurveTimeline(frameCount, PathConstraintMixTimeline::ENTRIES),
-	  _constraintIndex(pathConstraintIndex) {
-	PropertyId ids[] = {((PropertyId) Property_PathConstraintMix << 32) | pathConstraintIndex};
-	setPropertyIds(ids, 1);
-}
-
 void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 									  MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
@@ -85,57 +78,33 @@ void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float
     }
 
     float rotate, x, y;
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -4;
-        static const int PREV_ROTATE = -3;
-        static const int PREV_TRANSLATE = -2;
-        static const int TRANSLATE = 2;
-
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            rotate = _frames[_frames.size() + PREV_ROTATE];
-            x = y = _frames[_frames.size() + PREV_TRANSLATE];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            rotate = _frames[frame + PREV_ROTATE];
-            x = y = _frames[frame + PREV_TRANSLATE];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
+	int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES);
+	int curveType = (int) _curves[i >> 2];
+	switch (curveType) {
+		case LINEAR: {
+			float before = _frames[i];
+			rotate = _frames[i + ROTATE];
+			x = _frames[i + X];
+			y = _frames[i + Y];
+			float t = (time - before) / (_frames[i + ENTRIES] - before);
+			rotate += (_frames[i + ENTRIES + ROTATE] - rotate) * t;
+			x += (_frames[i + ENTRIES + X] - x) * t;
+			y += (_frames[i + ENTRIES + Y] - y) * t;
+			break;
+		}
+		case STEPPED: {
+			rotate = _frames[i + ROTATE];
+			x = _frames[i + X];
+			y = _frames[i + Y];
+			break;
+		}
+		default: {
+			rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
+			x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
+			y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
+		}
+	}
 
-            rotate += (_frames[frame + ROTATE] - rotate) * percent;
-            x += (_frames[frame + TRANSLATE] - x) * percent;
-            y += (_frames[frame + TRANSLATE] - y) * percent;
-        }
-    } else {
-        int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES);
-        int curveType = (int) _curves[i >> 2];
-        switch (curveType) {
-            case LINEAR: {
-                float before = _frames[i];
-                rotate = _frames[i + ROTATE];
-                x = _frames[i + X];
-                y = _frames[i + Y];
-                float t = (time - before) / (_frames[i + ENTRIES] - before);
-                rotate += (_frames[i + ENTRIES + ROTATE] - rotate) * t;
-                x += (_frames[i + ENTRIES + X] - x) * t;
-                y += (_frames[i + ENTRIES + Y] - y) * t;
-                break;
-            }
-            case STEPPED: {
-                rotate = _frames[i + ROTATE];
-                x = _frames[i + X];
-                y = _frames[i + Y];
-                break;
-            }
-            default: {
-                rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
-                x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
-                y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
-            }
-        }
-    }
     if (blend == MixBlend_Setup) {
         PathConstraintData data = constraint._data;
         constraint._mixRotate = data._mixRotate + (rotate - data._mixRotate) * alpha;
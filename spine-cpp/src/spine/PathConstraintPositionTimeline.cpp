@@ -52,12 +52,6 @@ PathConstraintPositionTimeline::PathConstraintPositionTimeline(size_t frameCount
 	setPropertyIds(ids, 1);
 }
 
-PathConstraintPositionTimeline::PathConstraintPositionTimeline(size_t frameCount, int pathConstraintIndex)
-: CurveTimeline1(frameCount), _constraintIndex(pathConstraintIndex) {
-	PropertyId ids[] = {((PropertyId) Property_PathConstraintPosition << 32) | pathConstraintIndex};
-	setPropertyIds(ids, 1);
-}
-
 PathConstraintPositionTimeline::~PathConstraintPositionTimeline() {
 }
 
@@ -67,48 +61,6 @@ void PathConstraintPositionTimeline::apply(Skeleton &skeleton, float lastTime, f
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-    if(BEZIER_SIZE != 18) {
-        static const int ENTRIES = 2;
-        static const int PREV_TIME = -2;
-        static const int PREV_VALUE = -1;
-
-        PathConstraint *constraintP = skeleton._pathConstraints[_constraintIndex];
-        PathConstraint &constraint = *constraintP;
-        if (!constraint.isActive()) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    constraint._position = constraint._data._position;
-                    return;
-                case MixBlend_First:
-                    constraint._position += (constraint._data._position - constraint._position) * alpha;
-                    return;
-                default:
-                    return;
-            }
-        }
-
-        float position;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            position = _frames[_frames.size() + PREV_VALUE];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            position = _frames[frame + PREV_VALUE];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            position += (_frames[frame + VALUE] - position) * percent;
-        }
-        if (blend == MixBlend_Setup)
-            constraint._position = constraint._data._position + (position - constraint._data._position) * alpha;
-        else
-            constraint._position += (position - constraint._position) * alpha;
-    } else {
-        PathConstraint *constraint = skeleton._pathConstraints[_constraintIndex];
-        if (constraint->_active) constraint->_position = getAbsoluteValue(time, alpha, blend, constraint->_position, constraint->_data._position);
-    }
+	PathConstraint *constraint = skeleton._pathConstraints[_constraintIndex];
+	if (constraint->_active) constraint->_position = getAbsoluteValue(time, alpha, blend, constraint->_position, constraint->_data._position);
 }
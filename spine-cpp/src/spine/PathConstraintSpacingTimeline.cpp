@@ -52,61 +52,13 @@ PathConstraintSpacingTimeline::PathConstraintSpacingTimeline(size_t frameCount,
 	setPropertyIds(ids, 1);
 }
 
-PathConstraintSpacingTimeline::PathConstraintSpacingTimeline(size_t frameCount, int pathConstraintIndex)
-: CurveTimeline1(frameCount), _pathConstraintIndex(pathConstraintIndex) {
-	PropertyId ids[] = {((PropertyId) Property_PathConstraintSpacing << 32) | pathConstraintIndex};
-	setPropertyIds(ids, 1);
-}
-
 void PathConstraintSpacingTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
 										  float alpha, MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -2;
-        static const int PREV_VALUE = -1;
-
-        PathConstraint *constraintP = skeleton._pathConstraints[_pathConstraintIndex];
-        PathConstraint &constraint = *constraintP;
-        if (!constraint.isActive()) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    constraint._spacing = constraint._data._spacing;
-                    return;
-                case MixBlend_First:
-                    constraint._spacing += (constraint._data._spacing - constraint._spacing) * alpha;
-                    return;
-                default:
-                    return;
-            }
-        }
-
-        float spacing;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            spacing = _frames[_frames.size() + PREV_VALUE];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            spacing = _frames[frame + PREV_VALUE];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            spacing += (_frames[frame + VALUE] - spacing) * percent;
-        }
-
-        if (blend == MixBlend_Setup)
-            constraint._spacing = constraint._data._spacing + (spacing - constraint._data._spacing) * alpha;
-        else
-            constraint._spacing += (spacing - constraint._spacing) * alpha;
-    } else {
-        PathConstraint *constraint = skeleton._pathConstraints[_pathConstraintIndex];
-        if (constraint->_active)
-            constraint->_spacing = getAbsoluteValue(time, alpha, blend, constraint->_spacing, constraint->_data._spacing);
-    }
+	PathConstraint *constraint = skeleton._pathConstraints[_pathConstraintIndex];
+	if (constraint->_active)
+		constraint->_spacing = getAbsoluteValue(time, alpha, blend, constraint->_spacing, constraint->_data._spacing);
 }
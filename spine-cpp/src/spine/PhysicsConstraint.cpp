@@ -401,7 +401,7 @@ void PhysicsConstraint::update(Physics physics) {
 					}
 					a = _remaining;
 					if (a >= t) {
-						float m = _massInverse * t, e = _strength, w = _wind, g = _gravity * (Bone::yDown ? -1 : 1), h = l / f;
+						float m = _massInverse * t, e = _strength, w = _wind, g = _gravity * (_skeleton.isYDown() ? -1 : 1), h = l / f;
 						float d = MathUtil::pow(_damping, 60 * t);
 						while (true) {
 							a -= t;
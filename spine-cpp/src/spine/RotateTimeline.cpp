@@ -48,83 +48,12 @@ RotateTimeline::RotateTimeline(size_t frameCount, size_t bezierCount, int boneIn
 	setPropertyIds(ids, 1);
 }
 
-RotateTimeline::RotateTimeline(size_t frameCount, int boneIndex)
-    : CurveTimeline1(frameCount), _boneIndex(boneIndex) {
-	PropertyId ids[] = {((PropertyId) Property_Rotate << 32) | boneIndex};
-	setPropertyIds(ids, 1);
-}
-
 void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 						   MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -2;
-        static const int PREV_ROTATION = -1;
-        static const int ROTATION = 1;
-
-        Bone *bone = skeleton.getBones()[_boneIndex];
-        if (!bone->_active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup: {
-                    bone->_rotation = bone->_data._rotation;
-                    break;
-                }
-                case MixBlend_First: {
-                    float r = bone->_data._rotation - bone->_rotation;
-                    bone->_rotation += (r - (16384 - (int) (16384.499999999996 - r / 360)) * 360) * alpha;
-                    break;
-                }
-                default: {
-                    // TODO?
-                    break;
-                }
-            }
-            return;
-        }
-
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            float r = _frames[_frames.size() + PREV_ROTATION];
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone->_rotation = bone->_data._rotation + r * alpha;
-                    break;
-                case MixBlend_First:
-                case MixBlend_Replace:
-                    r += bone->_data._rotation - bone->_rotation;
-                    r -= (16384 - (int)(16384.499999999996 - r / 360)) * 360;
-                    // Fall through.
-                case MixBlend_Add:
-                    bone->_rotation += r * alpha;
-            }
-            return;
-        }
-
-        // Interpolate between the previous frame and the current frame.
-        int frame = Animation::binarySearch(_frames, time, ENTRIES);
-        float prevRotation = _frames[frame + PREV_ROTATION];
-        float frameTime = _frames[frame];
-        float percent = getCurvePercent((frame >> 1) - 1,
-                                        1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-        float r = _frames[frame + ROTATION] - prevRotation;
-        r = prevRotation + (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * percent;
-        switch (blend) {
-            case MixBlend_Setup:
-                bone->_rotation = bone->_data._rotation + (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
-                break;
-            case MixBlend_First:
-            case MixBlend_Replace:
-                r += bone->_data._rotation - bone->_rotation;
-                // Fall through.
-            case MixBlend_Add:
-                bone->_rotation += (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
-        }
-    } else {
-        Bone *bone = skeleton._bones[_boneIndex];
-        if (bone->isActive()) bone->_rotation = getRelativeValue(time, alpha, blend, bone->_rotation, bone->getData()._rotation);
-    }
+	Bone *bone = skeleton._bones[_boneIndex];
+	if (bone->isActive()) bone->_rotation = getRelativeValue(time, alpha, blend, bone->_rotation, bone->getData()._rotation);
 }
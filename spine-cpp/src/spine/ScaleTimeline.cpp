@@ -49,13 +49,6 @@ ScaleTimeline::ScaleTimeline(size_t frameCount, size_t bezierCount, int boneInde
 	setPropertyIds(ids, 2);
 }
 
-ScaleTimeline::ScaleTimeline(size_t frameCount, int boneIndex)
-    : CurveTimeline2(frameCount), _boneIndex(boneIndex) {
-	PropertyId ids[] = {((PropertyId) Property_ScaleX << 32) | boneIndex,
-						((PropertyId) Property_ScaleY << 32) | boneIndex};
-	setPropertyIds(ids, 2);
-}
-
 ScaleTimeline::~ScaleTimeline() {}
 
 void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -63,203 +56,101 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 
-	if(BEZIER_SIZE != 18) {
-        static const int ENTRIES = 3;
-        static const int PREV_TIME = -3;
-        static const int PREV_X = -2;
-        static const int PREV_Y = -1;
-        static const int X = 1;
-        static const int Y = 2;
-
-        Bone *boneP = skeleton._bones[_boneIndex];
-        Bone &bone = *boneP;
-
-        if (!bone._active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone._scaleX = bone._data._scaleX;
-                    bone._scaleY = bone._data._scaleY;
-                    return;
-                case MixBlend_First:
-                    bone._scaleX += (bone._data._scaleX - bone._scaleX) * alpha;
-                    bone._scaleY += (bone._data._scaleY - bone._scaleY) * alpha;
-                default: {}
-            }
-            return;
-        }
-
-        float x, y;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            x = _frames[_frames.size() + PREV_X] * bone._data._scaleX;
-            y = _frames[_frames.size() + PREV_Y] * bone._data._scaleY;
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            x = _frames[frame + PREV_X];
-            y = _frames[frame + PREV_Y];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            x = (x + (_frames[frame + X] - x) * percent) * bone._data._scaleX;
-            y = (y + (_frames[frame + Y] - y) * percent) * bone._data._scaleY;
-        }
-
-        if (alpha == 1) {
-            if (blend == MixBlend_Add) {
-                bone._scaleX += x - bone._data._scaleX;
-                bone._scaleY += y - bone._data._scaleY;
-            } else {
-                bone._scaleX = x;
-                bone._scaleY = y;
-            }
-        } else {
-            // Mixing out uses sign of setup or current pose, else use sign of key.
-            float bx, by;
-            if (direction == MixDirection_Out) {
-                switch (blend) {
-                    case MixBlend_Setup:
-                        bx = bone._data._scaleX;
-                        by = bone._data._scaleY;
-                        bone._scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-                        bone._scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
-                        break;
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        bx = bone._scaleX;
-                        by = bone._scaleY;
-                        bone._scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-                        bone._scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        bx = bone._scaleX;
-                        by = bone._scaleY;
-                        bone._scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bone._data._scaleX) * alpha;
-                        bone._scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - bone._data._scaleY) * alpha;
-                }
-            } else {
-                switch (blend) {
-                    case MixBlend_Setup:
-                        bx = MathUtil::abs(bone._data._scaleX) * MathUtil::sign(x);
-                        by = MathUtil::abs(bone._data._scaleY) * MathUtil::sign(y);
-                        bone._scaleX = bx + (x - bx) * alpha;
-                        bone._scaleY = by + (y - by) * alpha;
-                        break;
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        bx = MathUtil::abs(bone._scaleX) * MathUtil::sign(x);
-                        by = MathUtil::abs(bone._scaleY) * MathUtil::sign(y);
-                        bone._scaleX = bx + (x - bx) * alpha;
-                        bone._scaleY = by + (y - by) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        bx = MathUtil::sign(x);
-                        by = MathUtil::sign(y);
-                        bone._scaleX = MathUtil::abs(bone._scaleX) * bx + (x - MathUtil::abs(bone._data._scaleX) * bx) * alpha;
-                        bone._scaleY = MathUtil::abs(bone._scaleY) * by + (y - MathUtil::abs(bone._data._scaleY) * by) * alpha;
-                }
-            }
-        }
-    } else {
-        Bone *bone = skeleton._bones[_boneIndex];
-        if (!bone->_active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone->_scaleX = bone->_data._scaleX;
-                    bone->_scaleY = bone->_data._scaleY;
-                    return;
-                case MixBlend_First:
-                    bone->_scaleX += (bone->_data._scaleX - bone->_scaleX) * alpha;
-                    bone->_scaleY += (bone->_data._scaleY - bone->_scaleY) * alpha;
-                default: {
-                }
-            }
-            return;
-        }
-
-        float x, y;
-        int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-        int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-        switch (curveType) {
-            case CurveTimeline::LINEAR: {
-                float before = _frames[i];
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-                x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-                y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-                break;
-            }
-            case CurveTimeline::STEPPED: {
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                break;
-            }
-            default: {
-                x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-                y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-                                   curveType + BEZIER_SIZE - CurveTimeline2::BEZIER);
-            }
-        }
-        x *= bone->_data._scaleX;
-        y *= bone->_data._scaleY;
-
-        if (alpha == 1) {
-            if (blend == MixBlend_Add) {
-                bone->_scaleX += x - bone->_data._scaleX;
-                bone->_scaleY += y - bone->_data._scaleY;
-            } else {
-                bone->_scaleX = x;
-                bone->_scaleY = y;
-            }
-        } else {
-            float bx, by;
-            if (direction == MixDirection_Out) {
-                switch (blend) {
-                    case MixBlend_Setup:
-                        bx = bone->_data._scaleX;
-                        by = bone->_data._scaleY;
-                        bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-                        bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
-                        break;
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        bx = bone->_scaleX;
-                        by = bone->_scaleY;
-                        bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-                        bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-                        bone->_scaleY += (y - bone->_data._scaleY) * alpha;
-                }
-            } else {
-                switch (blend) {
-                    case MixBlend_Setup:
-                        bx = MathUtil::abs(bone->_data._scaleX) * MathUtil::sign(x);
-                        by = MathUtil::abs(bone->_data._scaleY) * MathUtil::sign(y);
-                        bone->_scaleX = bx + (x - bx) * alpha;
-                        bone->_scaleY = by + (y - by) * alpha;
-                        break;
-                    case MixBlend_First:
-                    case MixBlend_Replace:
-                        bx = MathUtil::abs(bone->_scaleX) * MathUtil::sign(x);
-                        by = MathUtil::abs(bone->_scaleY) * MathUtil::sign(y);
-                        bone->_scaleX = bx + (x - bx) * alpha;
-                        bone->_scaleY = by + (y - by) * alpha;
-                        break;
-                    case MixBlend_Add:
-                        bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-                        bone->_scaleY += (y - bone->_data._scaleY) * alpha;
-                }
-            }
-        }
-    }
+	Bone *bone = skeleton._bones[_boneIndex];
+	if (!bone->_active) return;
+
+	if (time < _frames[0]) {
+		switch (blend) {
+			case MixBlend_Setup:
+				bone->_scaleX = bone->_data._scaleX;
+				bone->_scaleY = bone->_data._scaleY;
+				return;
+			case MixBlend_First:
+				bone->_scaleX += (bone->_data._scaleX - bone->_scaleX) * alpha;
+				bone->_scaleY += (bone->_data._scaleY - bone->_scaleY) * alpha;
+			default: {
+			}
+		}
+		return;
+	}
+
+	float x, y;
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
+			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
+			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
+							   curveType + BEZIER_SIZE - CurveTimeline2::BEZIER);
+		}
+	}
+	x *= bone->_data._scaleX;
+	y *= bone->_data._scaleY;
+
+	if (alpha == 1) {
+		if (blend == MixBlend_Add) {
+			bone->_scaleX += x - bone->_data._scaleX;
+			bone->_scaleY += y - bone->_data._scaleY;
+		} else {
+			bone->_scaleX = x;
+			bone->_scaleY = y;
+		}
+	} else {
+		float bx, by;
+		if (direction == MixDirection_Out) {
+			switch (blend) {
+				case MixBlend_Setup:
+					bx = bone->_data._scaleX;
+					by = bone->_data._scaleY;
+					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					break;
+				case MixBlend_First:
+				case MixBlend_Replace:
+					bx = bone->_scaleX;
+					by = bone->_scaleY;
+					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					break;
+				case MixBlend_Add:
+					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+			}
+		} else {
+			switch (blend) {
+				case MixBlend_Setup:
+					bx = MathUtil::abs(bone->_data._scaleX) * MathUtil::sign(x);
+					by = MathUtil::abs(bone->_data._scaleY) * MathUtil::sign(y);
+					bone->_scaleX = bx + (x - bx) * alpha;
+					bone->_scaleY = by + (y - by) * alpha;
+					break;
+				case MixBlend_First:
+				case MixBlend_Replace:
+					bx = MathUtil::abs(bone->_scaleX) * MathUtil::sign(x);
+					by = MathUtil::abs(bone->_scaleY) * MathUtil::sign(y);
+					bone->_scaleX = bx + (x - bx) * alpha;
+					bone->_scaleY = by + (y - by) * alpha;
+					break;
+				case MixBlend_Add:
+					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+			}
+		}
+	}
 }
 
 RTTI_IMPL(ScaleXTimeline, CurveTimeline1)
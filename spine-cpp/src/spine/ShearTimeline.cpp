@@ -49,13 +49,6 @@ ShearTimeline::ShearTimeline(size_t frameCount, size_t bezierCount, int boneInde
 	setPropertyIds(ids, 2);
 }
 
-ShearTimeline::ShearTimeline(size_t frameCount, int boneIndex)
-    : CurveTimeline2(frameCount), _boneIndex(boneIndex) {
-	PropertyId ids[] = {((PropertyId) Property_ShearX << 32) | boneIndex,
-						((PropertyId) Property_ShearY << 32) | boneIndex};
-	setPropertyIds(ids, 2);
-}
-
 ShearTimeline::~ShearTimeline() {
 }
 
@@ -65,123 +58,63 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-	if(BEZIER_SIZE != 18) {
-        static const int ENTRIES = 3;
-        static const int PREV_TIME = -3;
-        static const int PREV_X = -2;
-        static const int PREV_Y = -1;
-        static const int X = 1;
-        static const int Y = 2;
-
-        Bone *boneP = skeleton._bones[_boneIndex];
-        Bone &bone = *boneP;
-        if (!bone._active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone._shearX = bone._data._shearX;
-                    bone._shearY = bone._data._shearY;
-                    return;
-                case MixBlend_First:
-                    bone._shearX += (bone._data._shearX - bone._shearX) * alpha;
-                    bone._shearY += (bone._data._shearY - bone._shearY) * alpha;
-                default: {}
-            }
-            return;
-        }
-
-        float x, y;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            x = _frames[_frames.size() + PREV_X];
-            y = _frames[_frames.size() + PREV_Y];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            x = _frames[frame + PREV_X];
-            y = _frames[frame + PREV_Y];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            x = x + (_frames[frame + X] - x) * percent;
-            y = y + (_frames[frame + Y] - y) * percent;
-        }
-
-        switch (blend) {
-            case MixBlend_Setup:
-                bone._shearX = bone._data._shearX + x * alpha;
-                bone._shearY = bone._data._shearY + y * alpha;
-                break;
-            case MixBlend_First:
-            case MixBlend_Replace:
-                bone._shearX += (bone._data._shearX + x - bone._shearX) * alpha;
-                bone._shearY += (bone._data._shearY + y - bone._shearY) * alpha;
-                break;
-            case MixBlend_Add:
-                bone._shearX += x * alpha;
-                bone._shearY += y * alpha;
-        }
-    } else {
-        Bone *bone = skeleton._bones[_boneIndex];
-        if (!bone->_active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone->_shearX = bone->_data._shearX;
-                    bone->_shearY = bone->_data._shearY;
-                    return;
-                case MixBlend_First:
-                    bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
-                    bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
-                default: {
-                }
-            }
-            return;
-        }
-
-        float x, y;
-        int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-        int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-        switch (curveType) {
-            case CurveTimeline2::LINEAR: {
-                float before = _frames[i];
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-                x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-                y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-                break;
-            }
-            case CurveTimeline2::STEPPED: {
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                break;
-            }
-            default: {
-                x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-                y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-                                   curveType + BEZIER_SIZE - CurveTimeline2::BEZIER);
-            }
-        }
-
-        switch (blend) {
-            case MixBlend_Setup:
-                bone->_shearX = bone->_data._shearX + x * alpha;
-                bone->_shearY = bone->_data._shearY + y * alpha;
-                break;
-            case MixBlend_First:
-            case MixBlend_Replace:
-                bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
-                bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
-                break;
-            case MixBlend_Add:
-                bone->_shearX += x * alpha;
-                bone->_shearY += y * alpha;
-        }
-    }
+	Bone *bone = skeleton._bones[_boneIndex];
+	if (!bone->_active) return;
+
+	if (time < _frames[0]) {
+		switch (blend) {
+			case MixBlend_Setup:
+				bone->_shearX = bone->_data._shearX;
+				bone->_shearY = bone->_data._shearY;
+				return;
+			case MixBlend_First:
+				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
+				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+			default: {
+			}
+		}
+		return;
+	}
+
+	float x, y;
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline2::LINEAR: {
+			float before = _frames[i];
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
+			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
+			break;
+		}
+		case CurveTimeline2::STEPPED: {
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
+			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
+							   curveType + BEZIER_SIZE - CurveTimeline2::BEZIER);
+		}
+	}
+
+	switch (blend) {
+		case MixBlend_Setup:
+			bone->_shearX = bone->_data._shearX + x * alpha;
+			bone->_shearY = bone->_data._shearY + y * alpha;
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
+			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			break;
+		case MixBlend_Add:
+			bone->_shearX += x * alpha;
+			bone->_shearY += y * alpha;
+	}
 }
 
 RTTI_IMPL(ShearXTimeline, CurveTimeline1)
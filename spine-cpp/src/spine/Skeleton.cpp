@@ -50,6 +50,9 @@
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/SkeletonClipping.h>
+#include <spine/SkeletonPose.h>
+#include <spine/DirtyTracker.h>
+#include <spine/RuntimeContext.h>
 
 #include <spine/ContainerUtil.h>
 
@@ -59,7 +62,7 @@ using namespace spine;
 
 Skeleton::Skeleton(SkeletonData *skeletonData)
 	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
+	  _scaleY(1), _x(0), _y(0), _time(0), _pose(NULL), _dirtyTracker(NULL), _context(NULL) {
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
@@ -128,6 +131,13 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 		_physicsConstraints.add(constraint);
 	}
 
+	_boneIndex.buildWithData(_bones);
+	_slotIndex.buildWithData(_slots);
+	_ikConstraintIndex.buildWithData(_ikConstraints);
+	_transformConstraintIndex.buildWithData(_transformConstraints);
+	_pathConstraintIndex.buildWithData(_pathConstraints);
+	_physicsConstraintIndex.buildWithData(_physicsConstraints);
+
 	updateCache();
 }
 
@@ -138,6 +148,8 @@ Skeleton::~Skeleton() {
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
+	delete _pose;
+	delete _dirtyTracker;
 }
 
 void Skeleton::updateCache() {
@@ -211,6 +223,9 @@ continue_outer:
 	for (i = 0; i < n; ++i) {
 		sortBone(_bones[i]);
 	}
+
+	if (_pose) _pose->build(*this);
+	if (_dirtyTracker) _dirtyTracker->invalidate();
 }
 
 void Skeleton::printUpdateCache() {
@@ -235,6 +250,14 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform(Physics physics) {
+	if (_dirtyTracker) {
+		_dirtyTracker->update(*this, physics);
+		return;
+	}
+	updateAllWorldTransforms(physics);
+}
+
+void Skeleton::updateAllWorldTransforms(Physics physics) {
 	for (size_t i = 0, n = _bones.size(); i < n; i++) {
 		Bone *bone = _bones[i];
 		bone->_ax = bone->_x;
@@ -246,13 +269,41 @@ void Skeleton::updateWorldTransform(Physics physics) {
 		bone->_ashearY = bone->_shearY;
 	}
 
+	if (_pose) {
+		_pose->update(*this, physics);
+		return;
+	}
+
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
 		Updatable *updatable = _updateCache[i];
 		updatable->update(physics);
 	}
 }
 
+void Skeleton::setUsePose(bool usePose) {
+	if (usePose == (_pose != NULL)) return;
+	if (usePose) {
+		_pose = new (__FILE__, __LINE__) SkeletonPose();
+		_pose->build(*this);
+	} else {
+		delete _pose;
+		_pose = NULL;
+	}
+}
+
+void Skeleton::setIncrementalUpdate(bool incrementalUpdate) {
+	if (incrementalUpdate == (_dirtyTracker != NULL)) return;
+	if (incrementalUpdate)
+		_dirtyTracker = new (__FILE__, __LINE__) DirtyTracker();
+	else {
+		delete _dirtyTracker;
+		_dirtyTracker = NULL;
+	}
+}
+
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
+	if (_dirtyTracker) _dirtyTracker->invalidate();
+
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
 	Bone *rootBone = getRootBone();
@@ -319,11 +370,11 @@ void Skeleton::setSlotsToSetupPose() {
 }
 
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	return _boneIndex.findWithData(_bones, boneName);
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	return _slotIndex.findWithData(_slots, slotName);
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -405,56 +456,21 @@ void Skeleton::setAttachment(const String &slotName,
 }
 
 IkConstraint *Skeleton::findIkConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i) {
-		IkConstraint *ikConstraint = _ikConstraints[i];
-		if (ikConstraint->_data.getName() == constraintName) {
-			return ikConstraint;
-		}
-	}
-	return NULL;
+	return _ikConstraintIndex.findWithData(_ikConstraints, constraintName);
 }
 
 TransformConstraint *
 Skeleton::findTransformConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i) {
-		TransformConstraint *transformConstraint = _transformConstraints[i];
-		if (transformConstraint->_data.getName() == constraintName) {
-			return transformConstraint;
-		}
-	}
-
-	return NULL;
+	return _transformConstraintIndex.findWithData(_transformConstraints, constraintName);
 }
 
 PathConstraint *Skeleton::findPathConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i) {
-		PathConstraint *constraint = _pathConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	return _pathConstraintIndex.findWithData(_pathConstraints, constraintName);
 }
 
 PhysicsConstraint *
 Skeleton::findPhysicsConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _physicsConstraints.size(); i < n; ++i) {
-		PhysicsConstraint *constraint = _physicsConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	return _physicsConstraintIndex.findWithData(_physicsConstraints, constraintName);
 }
 
 void Skeleton::getBounds(float &outX, float &outY, float &outWidth,
@@ -584,7 +600,9 @@ float Skeleton::getScaleX() { return _scaleX; }
 
 void Skeleton::setScaleX(float inValue) { _scaleX = inValue; }
 
-float Skeleton::getScaleY() { return _scaleY * (Bone::isYDown() ? -1 : 1); }
+float Skeleton::getScaleY() { return _scaleY * (isYDown() ? -1 : 1); }
+
+bool Skeleton::isYDown() { return _context ? _context->isYDown() : Bone::isYDown(); }
 
 void Skeleton::setScaleY(float inValue) { _scaleY = inValue; }
 
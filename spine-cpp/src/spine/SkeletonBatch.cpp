@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonBatch.h>
+
+#include <spine/AnimationState.h>
+#include <spine/RuntimeContext.h>
+#include <spine/Skeleton.h>
+#include <spine/TaskExecutor.h>
+
+using namespace spine;
+
+SkeletonBatch::SkeletonBatch(TaskExecutor *executor) : _executor(executor), _grainSize(8), _delta(0),
+													   _physics(Physics_Update), _context(NULL) {
+}
+
+SkeletonBatch::~SkeletonBatch() {
+	clear();
+}
+
+size_t SkeletonBatch::add(Skeleton *skeleton, AnimationState *state) {
+	Instance instance = {skeleton, state};
+	_instances.add(instance);
+	return _instances.size() - 1;
+}
+
+size_t SkeletonBatch::add(SkeletonData *skeletonData, AnimationStateData *stateData) {
+	return add(new (__FILE__, __LINE__) Skeleton(skeletonData), new (__FILE__, __LINE__) AnimationState(stateData));
+}
+
+void SkeletonBatch::remove(size_t index) {
+	Instance &instance = _instances[index];
+	delete instance.state;
+	delete instance.skeleton;
+	size_t last = _instances.size() - 1;
+	if (index != last) _instances[index] = _instances[last];
+	_instances.removeAt(last);
+}
+
+void SkeletonBatch::clear() {
+	for (size_t i = 0, n = _instances.size(); i < n; i++) {
+		delete _instances[i].state;
+		delete _instances[i].skeleton;
+	}
+	_instances.clear();
+}
+
+void SkeletonBatch::update(float delta, Physics physics) {
+	_delta = delta;
+	_physics = physics;
+	_context = RuntimeContext::getCurrent();
+	size_t count = _instances.size();
+	size_t tasks = (count + _grainSize - 1) / _grainSize;
+	if (_executor && tasks > 1)
+		_executor->run(updateTask, this, (int) tasks);
+	else
+		updateRange(0, count);
+}
+
+void SkeletonBatch::updateRange(size_t start, size_t end) {
+	float delta = _delta;
+	Physics physics = _physics;
+	for (size_t i = start; i < end; i++) {
+		Skeleton &skeleton = *_instances[i].skeleton;
+		AnimationState &state = *_instances[i].state;
+		state.update(delta);
+		skeleton.update(delta);
+		state.apply(skeleton);
+		skeleton.updateWorldTransform(physics);
+	}
+}
+
+void SkeletonBatch::updateTask(void *context, int index) {
+	SkeletonBatch *batch = (SkeletonBatch *) context;
+	RuntimeContextScope contextScope(batch->_context);
+	size_t start = (size_t) index * batch->_grainSize;
+	size_t end = start + batch->_grainSize;
+	if (end > batch->_instances.size()) end = batch->_instances.size();
+	batch->updateRange(start, end);
+}
@@ -30,6 +30,7 @@
 #include <spine/SkeletonBinary.h>
 
 #include <spine/Animation.h>
+#include <spine/Arena.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
@@ -65,6 +66,7 @@
 #include <spine/PointAttachment.h>
 #include <spine/RegionAttachment.h>
 #include <spine/RotateTimeline.h>
+#include <spine/RuntimeContext.h>
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
 #include <spine/SlotData.h>
@@ -81,34 +83,37 @@ using namespace spine;
 
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _ownsLoader(true), _fileMapping(false), _lazyAnimations(false), _useArena(false), _executor(NULL), _internTable(NULL), _context(NULL) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
-																					  _ownsLoader(ownsLoader) {
+																					  _ownsLoader(ownsLoader),
+																					  _fileMapping(false),
+																					  _lazyAnimations(false),
+																					  _useArena(false),
+																					  _executor(NULL),
+																					  _internTable(NULL),
+																					  _context(NULL) {
 	assert(_attachmentLoader != NULL);
 }
 
 SkeletonBinary::~SkeletonBinary() {
-	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
-	_linkedMeshes.clear();
-
 	if (_ownsLoader) delete _attachmentLoader;
 }
 
 SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, const int length) {
+    RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
     SkeletonData *skeletonData;
 
     auto *input = new (__FILE__, __LINE__) DataInput();
     input->cursor = binary;
     input->end = binary + length;
 
-    _linkedMeshes.clear();
-
     skeletonData = new (__FILE__, __LINE__) SkeletonData();
+    skeletonData->_loading = true;
 
     if(*binary <= 0x40) {//might be version 3.8 or below
         char *hashString = readString(input);
@@ -117,17 +122,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
             skeletonData->_hash.own(hashString);
             skeletonData->_version.own(version);
 
-            auto loader = SkeletonLoaderFactory::CreateBinaryLoader(_attachmentLoader, _linkedMeshes, skeletonData->_version, _scale, _error);
-            if(loader == NULL) {
-                char errorMsg[255];
-                snprintf(errorMsg, 255, "Skeleton version %s does not match any supported version.", skeletonData->_version.buffer());
-                delete skeletonData;
-                setError(errorMsg, "");
-                return NULL;
-            }
-            skeletonData = loader->readSkeleton(input, skeletonData);
-            delete loader;
-            return skeletonData;
+            return readSkeleton(input, skeletonData);
         }
         SpineExtension::free(hashString, __FILE__, __LINE__);
         SpineExtension::free(version, __FILE__, __LINE__);
@@ -155,22 +150,73 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
     //	return NULL;
     //}
 
-    auto loader = SkeletonLoaderFactory::CreateBinaryLoader(_attachmentLoader, _linkedMeshes, skeletonData->_version, _scale, _error);
-    if(loader == NULL) {
+    return readSkeleton(input, skeletonData);
+}
+
+SkeletonData *SkeletonBinary::readSkeleton(DataInput *input, SkeletonData *skeletonData) {
+    if (!_useArena) {
+        // The linked meshes are local so no memory allocated in the loading context outlives the call.
+        Vector<LinkedMesh *> linkedMeshes;
+        skeletonData = readSkeleton(input, skeletonData, linkedMeshes, _error);
+        ContainerUtil::cleanUpVectorOfPointers(linkedMeshes);
+        if (skeletonData) skeletonData->buildIndices();
+        return skeletonData;
+    }
+
+    // Everything allocated while loading goes to the arena. The loader's scratch state lives in locals destroyed before
+    // the scope ends, so none of the arena memory leaks into this SkeletonBinary.
+    Arena *arena = new (__FILE__, __LINE__) Arena();
+    {
+        ArenaScope scope(arena);
+        Vector<LinkedMesh *> linkedMeshes;
+        String error;
+        skeletonData = readSkeleton(input, skeletonData, linkedMeshes, error);
+        ContainerUtil::cleanUpVectorOfPointers(linkedMeshes);
+        if (!skeletonData) {
+            ArenaScope heap(NULL);
+            _error = error;
+        }
+    }
+    if (skeletonData) {
+        skeletonData->_arena.set(arena);
+        skeletonData->buildIndices();
+    } else
+        delete arena;
+    return skeletonData;
+}
+
+SkeletonData *SkeletonBinary::readSkeleton(DataInput *input, SkeletonData *skeletonData, Vector<LinkedMesh *> &linkedMeshes, String &error) {
+    ISkeletonBinaryLoader *loader = SkeletonLoaderFactory::CreateBinaryLoader(_attachmentLoader, linkedMeshes, skeletonData->_version, _scale, error);
+    if (loader == NULL) {
         char errorMsg[255];
         snprintf(errorMsg, 255, "Skeleton version %s does not match any supported version.", skeletonData->_version.buffer());
+        delete input;
         delete skeletonData;
-        setError(errorMsg, "");
+        error = errorMsg;
         return NULL;
     }
+    loader->setLazyAnimations(_lazyAnimations);
+    loader->setTaskExecutor(_executor);
+    loader->setInternTable(_internTable);
     skeletonData = loader->readSkeleton(input, skeletonData);
     delete loader;
     return skeletonData;
 }
 
 SkeletonData *SkeletonBinary::readSkeletonDataFile(const String &path) {
-    int length;
+    RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
+    int length = 0;
     SkeletonData *skeletonData;
+    if (_fileMapping) {
+        const unsigned char *mapped = SpineExtension::mapFile(path, &length);
+        if (length == 0 || !mapped) {
+            setError("Unable to map skeleton file: ", path.buffer());
+            return NULL;
+        }
+        skeletonData = readSkeletonData(mapped, length);
+        SpineExtension::unmapFile(mapped, length);
+        return skeletonData;
+    }
     const char *binary = SpineExtension::readFile(path.buffer(), &length);
     if (length == 0 || !binary) {
         setError("Unable to read skeleton file: ", path.buffer());
@@ -29,11 +29,126 @@
 
 #include <spine/SkeletonClipping.h>
 
+#include <spine/Bone.h>
 #include <spine/ClippingAttachment.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
 #include <spine/Slot.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SPINE_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPINE_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
 using namespace spine;
 
+namespace {
+	enum TriangleClass {
+		TriangleClass_Clip = 0,
+		TriangleClass_Inside,
+		TriangleClass_Outside
+	};
+
+#if defined(SPINE_SIMD_AVX2)
+	struct Simd {
+		typedef __m256 V;
+		static const size_t width = 8;
+
+		static V load(const float *p) { return _mm256_loadu_ps(p); }
+
+		static V set(float f) { return _mm256_set1_ps(f); }
+
+		static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+
+		static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+
+		static V min(V a, V b) { return _mm256_min_ps(a, b); }
+
+		static V max(V a, V b) { return _mm256_max_ps(a, b); }
+
+		static V greater(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+
+		static V bitAnd(V a, V b) { return _mm256_and_ps(a, b); }
+
+		static V bitOr(V a, V b) { return _mm256_or_ps(a, b); }
+
+		static V bitAndNot(V a, V b) { return _mm256_andnot_ps(a, b); }
+
+		static V ones() { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+
+		static int mask(V v) { return _mm256_movemask_ps(v); }
+	};
+#elif defined(SPINE_SIMD_SSE2)
+	struct Simd {
+		typedef __m128 V;
+		static const size_t width = 4;
+
+		static V load(const float *p) { return _mm_loadu_ps(p); }
+
+		static V set(float f) { return _mm_set1_ps(f); }
+
+		static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+
+		static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+
+		static V min(V a, V b) { return _mm_min_ps(a, b); }
+
+		static V max(V a, V b) { return _mm_max_ps(a, b); }
+
+		static V greater(V a, V b) { return _mm_cmpgt_ps(a, b); }
+
+		static V bitAnd(V a, V b) { return _mm_and_ps(a, b); }
+
+		static V bitOr(V a, V b) { return _mm_or_ps(a, b); }
+
+		static V bitAndNot(V a, V b) { return _mm_andnot_ps(a, b); }
+
+		static V ones() { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+
+		static int mask(V v) { return _mm_movemask_ps(v); }
+	};
+#elif defined(SPINE_SIMD_NEON)
+	struct Simd {
+		typedef float32x4_t V;
+		static const size_t width = 4;
+
+		static V load(const float *p) { return vld1q_f32(p); }
+
+		static V set(float f) { return vdupq_n_f32(f); }
+
+		static V sub(V a, V b) { return vsubq_f32(a, b); }
+
+		static V mul(V a, V b) { return vmulq_f32(a, b); }
+
+		static V min(V a, V b) { return vminq_f32(a, b); }
+
+		static V max(V a, V b) { return vmaxq_f32(a, b); }
+
+		static V greater(V a, V b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+
+		static V bitAnd(V a, V b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+
+		static V bitOr(V a, V b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+
+		static V bitAndNot(V a, V b) { return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(b), vreinterpretq_u32_f32(a))); }
+
+		static V ones() { return vreinterpretq_f32_u32(vdupq_n_u32(0xffffffff)); }
+
+		static int mask(V v) {
+			uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(v), 31);
+			return (int) (vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) |
+						  (vgetq_lane_u32(bits, 3) << 3));
+		}
+	};
+#endif
+}
+
 SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
 	_clipOutput.ensureCapacity(128);
 	_clippedVertices.ensureCapacity(128);
@@ -41,6 +156,10 @@ SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	clearCache();
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -48,6 +167,60 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 
 	_clipAttachment = clip;
 
+	// A clip bound rigidly to one bone keeps its convex decomposition in bone space, so only the transform is redone
+	// each frame. It is triangulated again only when its bone space vertices change, eg when it is deformed.
+	Bone *bone = computeLocalVertices(slot, *clip, _clippingPolygon);
+	if (bone != NULL) {
+		ClippingCache *cache = _caches.containsKey(clip) ? _caches[clip] : NULL;
+		if (cache == NULL) {
+			cache = new (__FILE__, __LINE__) ClippingCache();
+			cache->decomposed[0] = cache->decomposed[1] = false;
+			_caches.put(clip, cache);
+		}
+		Vector<float> &vertices = cache->vertices;
+		size_t n = _clippingPolygon.size();
+		bool changed = vertices.size() != n;
+		for (size_t i = 0; i < n && !changed; i++)
+			changed = vertices[i] != _clippingPolygon[i];
+		if (changed) {
+			vertices.clear();
+			vertices.addAll(_clippingPolygon);
+			cache->decomposed[0] = cache->decomposed[1] = false;
+		}
+
+		// A mirroring transform would reverse the winding, so the mirrored polygon is decomposed instead.
+		float a = bone->getA(), b = bone->getB(), c = bone->getC(), d = bone->getD();
+		float x = bone->getWorldX(), y = bone->getWorldY();
+		int mirror = a * d - b * c < 0 ? 1 : 0;
+		if (mirror) {
+			a = -a;
+			c = -c;
+		}
+		if (!cache->decomposed[mirror]) decompose(*cache, mirror);
+
+		Vector<float> &polygons = cache->polygons[mirror];
+		Vector<size_t> &polygonEnds = cache->polygonEnds[mirror];
+		size_t polygonsCount = polygonEnds.size();
+		for (size_t i = polygonsCount; i < _worldPolygons.size(); i++)
+			_worldPolygonPool.free(_worldPolygons[i]);
+		for (size_t i = _worldPolygons.size(); i < polygonsCount; i++)
+			_worldPolygons.add(_worldPolygonPool.obtain());
+		_worldPolygons.setSize(polygonsCount, NULL);
+		for (size_t i = 0, start = 0; i < polygonsCount; i++) {
+			size_t end = polygonEnds[i];
+			Vector<float> &polygon = *_worldPolygons[i];
+			polygon.setSize(end - start, 0);
+			for (size_t ii = 0; start < end; ii += 2, start += 2) {
+				float vx = polygons[start], vy = polygons[start + 1];
+				polygon[ii] = vx * a + vy * b + x;
+				polygon[ii + 1] = vx * c + vy * d + y;
+			}
+		}
+		_clippingPolygons = &_worldPolygons;
+		computeClippingEdges();
+		return polygonsCount;
+	}
+
 	int n = (int) clip->getWorldVerticesLength();
 	_clippingPolygon.setSize(n, 0);
 	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
@@ -61,6 +234,7 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 		polygon.add(polygon[0]);
 		polygon.add(polygon[1]);
 	}
+	computeClippingEdges();
 
 	return (*_clippingPolygons).size();
 }
@@ -80,6 +254,9 @@ void SkeletonClipping::clipEnd() {
 	_clippedUVs.clear();
 	_clippedTriangles.clear();
 	_clippingPolygon.clear();
+	_clippingEdges.clear();
+	_clippingEdgeEnds.clear();
+	_clippingBounds.clear();
 }
 
 void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
@@ -96,6 +273,11 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	clippedTriangles.clear();
 
 	int stride = 2;
+	classifyTriangles(vertices, triangles, trianglesLength, stride);
+	const unsigned char *classes = _triangleClasses.buffer();
+	size_t triangleCount = trianglesLength / 3;
+	Vector<int> &vertexRemap = _vertexRemap;
+
 	size_t i = 0;
 continue_outer:
 	for (; i < trianglesLength; i += 3) {
@@ -109,8 +291,10 @@ continue_outer:
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			unsigned char triangleClass = classes[p * triangleCount + i / 3];
+			if (triangleClass == TriangleClass_Outside) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (triangleClass == TriangleClass_Clip && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 
@@ -134,20 +318,17 @@ continue_outer:
 				}
 				index += clipOutputCount + 1;
 			} else {
-				clippedVertices.setSize(s + 3 * 2, 0);
-				clippedVertices[s] = x1;
-				clippedVertices[s + 1] = y1;
-				clippedVertices[s + 2] = x2;
-				clippedVertices[s + 3] = y2;
-				clippedVertices[s + 4] = x3;
-				clippedVertices[s + 5] = y3;
-
-				s = clippedTriangles.size();
-				clippedTriangles.setSize(s + 3, 0);
-				clippedTriangles[s] = (unsigned short) index;
-				clippedTriangles[s + 1] = (unsigned short) (index + 1);
-				clippedTriangles[s + 2] = (unsigned short) (index + 2);
-				index += 3;
+				// Triangles that are not clipped keep sharing their vertices.
+				for (size_t ii = 0; ii < 3; ii++) {
+					int &vertexIndex = vertexRemap[triangles[i + ii]];
+					if (vertexIndex < 0) {
+						vertexIndex = (int) index++;
+						vertexOffset = triangles[i + ii] * stride;
+						clippedVertices.add(vertices[vertexOffset]);
+						clippedVertices.add(vertices[vertexOffset + 1]);
+					}
+					clippedTriangles.add((unsigned short) vertexIndex);
+				}
 				i += 3;
 				goto continue_outer;
 			}
@@ -173,6 +354,11 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	_clippedUVs.clear();
 	clippedTriangles.clear();
 
+	classifyTriangles(vertices, triangles, trianglesLength, stride);
+	const unsigned char *classes = _triangleClasses.buffer();
+	size_t triangleCount = trianglesLength / 3;
+	Vector<int> &vertexRemap = _vertexRemap;
+
 	size_t i = 0;
 continue_outer:
 	for (; i < trianglesLength; i += 3) {
@@ -189,8 +375,10 @@ continue_outer:
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			unsigned char triangleClass = classes[p * triangleCount + i / 3];
+			if (triangleClass == TriangleClass_Outside) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (triangleClass == TriangleClass_Clip && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
@@ -223,28 +411,19 @@ continue_outer:
 				}
 				index += clipOutputCount + 1;
 			} else {
-				clippedVertices.setSize(s + 3 * 2, 0);
-				_clippedUVs.setSize(s + 3 * 2, 0);
-				clippedVertices[s] = x1;
-				clippedVertices[s + 1] = y1;
-				clippedVertices[s + 2] = x2;
-				clippedVertices[s + 3] = y2;
-				clippedVertices[s + 4] = x3;
-				clippedVertices[s + 5] = y3;
-
-				_clippedUVs[s] = u1;
-				_clippedUVs[s + 1] = v1;
-				_clippedUVs[s + 2] = u2;
-				_clippedUVs[s + 3] = v2;
-				_clippedUVs[s + 4] = u3;
-				_clippedUVs[s + 5] = v3;
-
-				s = clippedTriangles.size();
-				clippedTriangles.setSize(s + 3, 0);
-				clippedTriangles[s] = (unsigned short) index;
-				clippedTriangles[s + 1] = (unsigned short) (index + 1);
-				clippedTriangles[s + 2] = (unsigned short) (index + 2);
-				index += 3;
+				// Triangles that are not clipped keep sharing their vertices.
+				for (size_t ii = 0; ii < 3; ii++) {
+					int &vertexIndex = vertexRemap[triangles[i + ii]];
+					if (vertexIndex < 0) {
+						vertexIndex = (int) index++;
+						vertexOffset = triangles[i + ii] * (int) stride;
+						clippedVertices.add(vertices[vertexOffset]);
+						clippedVertices.add(vertices[vertexOffset + 1]);
+						_clippedUVs.add(uvs[vertexOffset]);
+						_clippedUVs.add(uvs[vertexOffset + 1]);
+					}
+					clippedTriangles.add((unsigned short) vertexIndex);
+				}
 				i += 3;
 				goto continue_outer;
 			}
@@ -268,6 +447,146 @@ Vector<float> &SkeletonClipping::getClippedUVs() {
 	return _clippedUVs;
 }
 
+void SkeletonClipping::computeClippingEdges() {
+	Vector<Vector<float> *> &polygons = *_clippingPolygons;
+	size_t polygonsCount = polygons.size();
+	_clippingEdges.clear();
+	_clippingEdgeEnds.setSize(polygonsCount, 0);
+	_clippingBounds.setSize((polygonsCount + 1) << 2, 0);
+	float *bounds = _clippingBounds.buffer();
+	float *clipBounds = bounds + (polygonsCount << 2);
+	for (size_t p = 0; p < polygonsCount; p++, bounds += 4) {
+		Vector<float> &polygon = *polygons[p];
+		float minX = polygon[0], minY = polygon[1], maxX = minX, maxY = minY;
+		for (size_t i = 0, n = polygon.size() - 2; i < n; i += 2) {
+			float edgeX = polygon[i], edgeY = polygon[i + 1];
+			_clippingEdges.add(edgeX);
+			_clippingEdges.add(edgeY);
+			_clippingEdges.add(edgeX - polygon[i + 2]);
+			_clippingEdges.add(edgeY - polygon[i + 3]);
+			minX = MathUtil::min(minX, edgeX);
+			minY = MathUtil::min(minY, edgeY);
+			maxX = MathUtil::max(maxX, edgeX);
+			maxY = MathUtil::max(maxY, edgeY);
+		}
+		_clippingEdgeEnds[p] = _clippingEdges.size();
+		bounds[0] = minX;
+		bounds[1] = minY;
+		bounds[2] = maxX;
+		bounds[3] = maxY;
+		if (p == 0) {
+			for (int i = 0; i < 4; i++) clipBounds[i] = bounds[i];
+		} else {
+			clipBounds[0] = MathUtil::min(clipBounds[0], minX);
+			clipBounds[1] = MathUtil::min(clipBounds[1], minY);
+			clipBounds[2] = MathUtil::max(clipBounds[2], maxX);
+			clipBounds[3] = MathUtil::max(clipBounds[3], maxY);
+		}
+	}
+}
+
+void SkeletonClipping::classifyTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength,
+										 size_t stride) {
+	size_t polygonsCount = _clippingEdgeEnds.size(), triangleCount = trianglesLength / 3;
+	_triangleClasses.setSize(polygonsCount * triangleCount, 0);
+	unsigned char *classes = _triangleClasses.buffer();
+
+	// The corners are gathered into separate x and y arrays so batches of triangles can be tested at once.
+	_triangleCorners.setSize(triangleCount * 6, 0);
+	float *x1 = _triangleCorners.buffer(), *y1 = x1 + triangleCount, *x2 = y1 + triangleCount;
+	float *y2 = x2 + triangleCount, *x3 = y2 + triangleCount, *y3 = x3 + triangleCount;
+	int vertexCount = 0;
+	for (size_t t = 0, i = 0; t < triangleCount; t++, i += 3) {
+		size_t vertexOffset = triangles[i] * stride;
+		x1[t] = vertices[vertexOffset];
+		y1[t] = vertices[vertexOffset + 1];
+		vertexOffset = triangles[i + 1] * stride;
+		x2[t] = vertices[vertexOffset];
+		y2[t] = vertices[vertexOffset + 1];
+		vertexOffset = triangles[i + 2] * stride;
+		x3[t] = vertices[vertexOffset];
+		y3[t] = vertices[vertexOffset + 1];
+		vertexCount = MathUtil::max(vertexCount, MathUtil::max((int) triangles[i], MathUtil::max((int) triangles[i + 1], (int) triangles[i + 2])) + 1);
+	}
+	_vertexRemap.clear();
+	_vertexRemap.setSize(vertexCount, -1);
+
+	// A triangle is inside a convex polygon when all its corners are inside every edge, and outside when its bounds
+	// miss the polygon's bounds or all its corners are outside one edge. Only the rest need the full clipper.
+	const float *edges = _clippingEdges.buffer(), *bounds = _clippingBounds.buffer();
+	const float *clipBounds = bounds + (polygonsCount << 2);
+	size_t t = 0;
+#if defined(SPINE_SIMD_AVX2) || defined(SPINE_SIMD_SSE2) || defined(SPINE_SIMD_NEON)
+	typedef Simd::V V;
+	V ones = Simd::ones();
+	int allLanes = (1 << Simd::width) - 1;
+	for (; t + Simd::width <= triangleCount; t += Simd::width) {
+		V ax = Simd::load(x1 + t), ay = Simd::load(y1 + t), bx = Simd::load(x2 + t), by = Simd::load(y2 + t);
+		V cx = Simd::load(x3 + t), cy = Simd::load(y3 + t);
+		V minX = Simd::min(Simd::min(ax, bx), cx), minY = Simd::min(Simd::min(ay, by), cy);
+		V maxX = Simd::max(Simd::max(ax, bx), cx), maxY = Simd::max(Simd::max(ay, by), cy);
+		V rejected = Simd::bitOr(
+				Simd::bitOr(Simd::greater(Simd::set(clipBounds[0]), maxX), Simd::greater(minX, Simd::set(clipBounds[2]))),
+				Simd::bitOr(Simd::greater(Simd::set(clipBounds[1]), maxY), Simd::greater(minY, Simd::set(clipBounds[3]))));
+		int rejectedMask = Simd::mask(rejected);
+		for (size_t p = 0, e = 0; p < polygonsCount; p++) {
+			unsigned char *polygonClasses = classes + p * triangleCount + t;
+			size_t edgesEnd = _clippingEdgeEnds[p];
+			if (rejectedMask == allLanes) {
+				for (size_t lane = 0; lane < Simd::width; lane++) polygonClasses[lane] = TriangleClass_Outside;
+				e = edgesEnd;
+				continue;
+			}
+			const float *polygonBounds = bounds + (p << 2);
+			V outside = Simd::bitOr(
+					Simd::bitOr(Simd::greater(Simd::set(polygonBounds[0]), maxX), Simd::greater(minX, Simd::set(polygonBounds[2]))),
+					Simd::bitOr(Simd::greater(Simd::set(polygonBounds[1]), maxY), Simd::greater(minY, Simd::set(polygonBounds[3]))));
+			outside = Simd::bitOr(outside, rejected);
+			V inside = ones;
+			for (; e < edgesEnd; e += 4) {
+				V edgeX = Simd::set(edges[e]), edgeY = Simd::set(edges[e + 1]);
+				V ex = Simd::set(edges[e + 2]), ey = Simd::set(edges[e + 3]);
+				V in1 = Simd::greater(Simd::mul(ey, Simd::sub(edgeX, ax)), Simd::mul(ex, Simd::sub(edgeY, ay)));
+				V in2 = Simd::greater(Simd::mul(ey, Simd::sub(edgeX, bx)), Simd::mul(ex, Simd::sub(edgeY, by)));
+				V in3 = Simd::greater(Simd::mul(ey, Simd::sub(edgeX, cx)), Simd::mul(ex, Simd::sub(edgeY, cy)));
+				inside = Simd::bitAnd(inside, Simd::bitAnd(Simd::bitAnd(in1, in2), in3));
+				outside = Simd::bitOr(outside, Simd::bitAndNot(Simd::bitOr(Simd::bitOr(in1, in2), in3), ones));
+			}
+			int insideMask = Simd::mask(inside), outsideMask = Simd::mask(outside);
+			for (size_t lane = 0; lane < Simd::width; lane++) {
+				polygonClasses[lane] = (unsigned char) ((outsideMask >> lane) & 1 ? TriangleClass_Outside
+														: (insideMask >> lane) & 1 ? TriangleClass_Inside
+																				   : TriangleClass_Clip);
+			}
+		}
+	}
+#endif
+	for (; t < triangleCount; t++) {
+		float minX = MathUtil::min(MathUtil::min(x1[t], x2[t]), x3[t]), minY = MathUtil::min(MathUtil::min(y1[t], y2[t]), y3[t]);
+		float maxX = MathUtil::max(MathUtil::max(x1[t], x2[t]), x3[t]), maxY = MathUtil::max(MathUtil::max(y1[t], y2[t]), y3[t]);
+		bool rejected = maxX < clipBounds[0] || minX > clipBounds[2] || maxY < clipBounds[1] || minY > clipBounds[3];
+		for (size_t p = 0, e = 0; p < polygonsCount; p++) {
+			const float *polygonBounds = bounds + (p << 2);
+			size_t edgesEnd = _clippingEdgeEnds[p];
+			bool outside = rejected || maxX < polygonBounds[0] || minX > polygonBounds[2] || maxY < polygonBounds[1] ||
+						   minY > polygonBounds[3];
+			bool inside = true;
+			for (; e < edgesEnd && !outside; e += 4) {
+				float edgeX = edges[e], edgeY = edges[e + 1], ex = edges[e + 2], ey = edges[e + 3];
+				bool in1 = ey * (edgeX - x1[t]) > ex * (edgeY - y1[t]);
+				bool in2 = ey * (edgeX - x2[t]) > ex * (edgeY - y2[t]);
+				bool in3 = ey * (edgeX - x3[t]) > ex * (edgeY - y3[t]);
+				inside = inside && in1 && in2 && in3;
+				outside = !in1 && !in2 && !in3;
+			}
+			e = edgesEnd;
+			classes[p * triangleCount + t] = (unsigned char) (outside ? TriangleClass_Outside
+															  : inside ? TriangleClass_Inside
+																	   : TriangleClass_Clip);
+		}
+	}
+}
+
 bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 							Vector<float> *output) {
 	Vector<float> *originalOutput = output;
@@ -370,6 +689,67 @@ bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, fl
 	return clipped;
 }
 
+void SkeletonClipping::clearCache() {
+	HashMap<ClippingAttachment *, ClippingCache *>::Entries entries = _caches.getEntries();
+	while (entries.hasNext())
+		delete entries.next().value;
+	_caches.clear();
+}
+
+void SkeletonClipping::decompose(ClippingCache &cache, int mirror) {
+	Vector<float> &polygon = _scratch;
+	polygon.clear();
+	polygon.addAll(cache.vertices);
+	if (mirror) {
+		for (size_t i = 0, n = polygon.size(); i < n; i += 2)
+			polygon[i] = -polygon[i];
+	}
+	makeClockwise(polygon);
+	Vector<Vector<float> *> &convexPolygons = _triangulator.decompose(polygon, _triangulator.triangulate(polygon));
+
+	Vector<float> &polygons = cache.polygons[mirror];
+	Vector<size_t> &polygonEnds = cache.polygonEnds[mirror];
+	polygons.clear();
+	polygonEnds.clear();
+	for (size_t i = 0; i < convexPolygons.size(); ++i) {
+		Vector<float> &convexPolygon = *convexPolygons[i];
+		makeClockwise(convexPolygon);
+		polygons.addAll(convexPolygon);
+		polygons.add(convexPolygon[0]);
+		polygons.add(convexPolygon[1]);
+		polygonEnds.add(polygons.size());
+	}
+	cache.decomposed[mirror] = true;
+}
+
+Bone *SkeletonClipping::computeLocalVertices(Slot &slot, ClippingAttachment &clip, Vector<float> &output) {
+	Vector<float> &deform = slot.getDeform();
+	Vector<float> &vertices = clip.getVertices();
+	Vector<int> &bones = clip.getBones();
+	size_t n = clip.getWorldVerticesLength();
+	output.setSize(n, 0);
+	if (bones.size() == 0) {
+		Vector<float> &local = deform.size() > 0 ? deform : vertices;
+		for (size_t i = 0; i < n; i++)
+			output[i] = local[i];
+		return &slot.getBone();
+	}
+
+	// Weighted vertices are rigid only when every vertex is bound to the same bone with a weight of 1.
+	if (bones.size() != n || bones[0] != 1) return NULL;
+	int boneIndex = bones[1];
+	for (size_t v = 0, b = 0; v < n; v += 2, b += 3) {
+		if (bones[v] != 1 || bones[v + 1] != boneIndex || vertices[b + 2] != 1) return NULL;
+		output[v] = vertices[b];
+		output[v + 1] = vertices[b + 1];
+	}
+	if (deform.size() > 0) {
+		for (size_t i = 0; i < n; i++)
+			output[i] += deform[i];
+	}
+	return slot.getBone().getSkeleton().getBones()[boneIndex];
+}
+
 void SkeletonClipping::makeClockwise(Vector<float> &polygon) {
 	size_t verticeslength = polygon.size();
 
@@ -35,6 +35,7 @@
 #include <spine/IkConstraintData.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PhysicsConstraintData.h>
+#include <spine/SkeletonLoader.h>
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
@@ -52,11 +53,17 @@ SkeletonData::SkeletonData() : _name(),
 							   _referenceScale(100),
 							   _version(),
 							   _hash(),
+							   _stringPool(NULL),
+							   _animationDecoder(NULL),
 							   _fps(0),
-							   _imagesPath() {
+							   _imagesPath(),
+							   _loading(false) {
 }
 
 SkeletonData::~SkeletonData() {
+	_context.beginDestruction();
+	_arena.beginDestruction();
+
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_skins);
@@ -69,45 +76,130 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
-	for (size_t i = 0; i < _strings.size(); i++) {
-		SpineExtension::free(_strings[i], __FILE__, __LINE__);
-	}
+	if (_stringPool) SpineExtension::free(_stringPool, __FILE__, __LINE__);
+	delete _animationDecoder;
+}
+
+void *SkeletonData::operator new(size_t sz) {
+	return SpineObject::operator new(sz);
+}
+
+void *SkeletonData::operator new(size_t sz, const char *file, int line) {
+	return SpineObject::operator new(sz, file, line);
+}
+
+void *SkeletonData::operator new(size_t sz, void *ptr) {
+	return SpineObject::operator new(sz, ptr);
+}
+
+void SkeletonData::operator delete(void *p) {
+	RuntimeContextScope context(RuntimeContextOwner::getDestroyed());
+	SpineObject::operator delete(p);
+}
+
+void SkeletonData::operator delete(void *p, const char *file, int line) {
+	SpineObject::operator delete(p, file, line);
+}
+
+void SkeletonData::operator delete(void *p, void *mem) {
+	SpineObject::operator delete(p, mem);
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	if (_loading) _boneIndex.build(_bones);
+	return _boneIndex.find(_bones, boneName);
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	if (_loading) _slotIndex.build(_slots);
+	return _slotIndex.find(_slots, slotName);
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	if (_loading) _skinIndex.build(_skins);
+	return _skinIndex.find(_skins, skinName);
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	if (_loading) _eventIndex.build(_events);
+	return _eventIndex.find(_events, eventDataName);
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	if (_loading) _animationIndex.build(_animations);
+	Animation *animation = _animationIndex.find(_animations, animationName);
+	if (animation) decodeAnimation(animation);
+	return animation;
+}
+
+bool SkeletonData::decodeAnimation(Animation *animation) {
+	if (!_animationDecoder || !isLazy(animation)) return true;
+	RuntimeContextScope context(_context.get());
+	ArenaScope scope(_arena.get(), false);
+	return _animationDecoder->decode(this, (size_t) animation->_decoderIndex);
+}
+
+void SkeletonData::evictAnimation(Animation *animation) {
+	if (!_animationDecoder || !isLazy(animation)) return;
+	RuntimeContextScope context(_context.get());
+	ArenaScope scope(_arena.get(), false);
+	_animationDecoder->evict(this, (size_t) animation->_decoderIndex);
+}
+
+void SkeletonData::evictAnimations() {
+	if (!_animationDecoder) return;
+	RuntimeContextScope context(_context.get());
+	ArenaScope scope(_arena.get(), false);
+	for (size_t i = 0; i < _animations.size(); ++i)
+		_animationDecoder->evict(this, i);
+}
+
+bool SkeletonData::isLazy(Animation *animation) {
+	int index = animation->_decoderIndex;
+	return index >= 0 && (size_t) index < _animations.size() && _animations[index] == animation;
+}
+
+Arena *SkeletonData::getArena() {
+	return _arena.get();
+}
+
+RuntimeContext *SkeletonData::getRuntimeContext() {
+	return _context.get();
+}
+
+void SkeletonData::buildIndices() {
+	RuntimeContextScope context(_context.get());
+	ArenaScope scope(_arena.get(), false);
+	_boneIndex.build(_bones);
+	_slotIndex.build(_slots);
+	_skinIndex.build(_skins);
+	_eventIndex.build(_events);
+	_animationIndex.build(_animations);
+	_ikConstraintIndex.build(_ikConstraints);
+	_transformConstraintIndex.build(_transformConstraints);
+	_pathConstraintIndex.build(_pathConstraints);
+	_physicsConstraintIndex.build(_physicsConstraints);
+	_loading = false;
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	if (_loading) _ikConstraintIndex.build(_ikConstraints);
+	return _ikConstraintIndex.find(_ikConstraints, constraintName);
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	if (_loading) _transformConstraintIndex.build(_transformConstraints);
+	return _transformConstraintIndex.find(_transformConstraints, constraintName);
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	if (_loading) _pathConstraintIndex.build(_pathConstraints);
+	return _pathConstraintIndex.find(_pathConstraints, constraintName);
 }
 
 PhysicsConstraintData *SkeletonData::findPhysicsConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_physicsConstraints, constraintName);
+	if (_loading) _physicsConstraintIndex.build(_physicsConstraints);
+	return _physicsConstraintIndex.find(_physicsConstraints, constraintName);
 }
 
 const String &SkeletonData::getName() {
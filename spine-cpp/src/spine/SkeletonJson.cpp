@@ -33,6 +33,7 @@
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/CurveTimeline.h>
 #include <spine/Json.h>
+#include <spine/RuntimeContext.h>
 #include <spine/LinkedMesh.h>
 #include <spine/SkeletonData.h>
 #include <spine/VertexAttachment.h>
@@ -79,21 +80,22 @@
 using namespace spine;
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _ownsLoader(true), _internTable(NULL), _context(NULL) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
-																				  _ownsLoader(ownsLoader) {
+																				  _ownsLoader(ownsLoader),
+																				  _internTable(NULL),
+																				  _context(NULL) {
 	assert(_attachmentLoader != NULL);
 }
 
 SkeletonJson::~SkeletonJson() {
-	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
-
 	if (_ownsLoader) delete _attachmentLoader;
 }
 
 SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
+	RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
 	int length;
 	SkeletonData *skeletonData;
 	const char *json = SpineExtension::readFile(path, &length);
@@ -110,10 +112,10 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 }
 
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
+    RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
     Json * root, *skeleton;
     SkeletonData* skeletonData;
     _error = "";
-    _linkedMeshes.clear();
 
     root = new (__FILE__, __LINE__) Json(json);
 
@@ -123,6 +125,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
     }
 
     skeletonData = new (__FILE__, __LINE__) SkeletonData();
+    skeletonData->_loading = true;
 
     skeleton = Json::getItem(root, "skeleton");
     if (skeleton) {
@@ -144,7 +147,9 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
         skeletonData->_audioPath = Json::getString(skeleton, "audio", 0);
         skeletonData->_imagesPath = Json::getString(skeleton, "images", 0);
 
-        auto loader = SkeletonLoaderFactory::CreateJsonLoader(_attachmentLoader, _linkedMeshes, skeletonData->_version, _scale, _error);
+        // The linked meshes are local so no memory allocated in the loading context outlives the call.
+        Vector<LinkedMesh *> linkedMeshes;
+        auto loader = SkeletonLoaderFactory::CreateJsonLoader(_attachmentLoader, linkedMeshes, skeletonData->_version, _scale, _error);
         if(loader == NULL) {
             char errorMsg[255];
             snprintf(errorMsg, 255, "Skeleton version %s does not match any supported version.", skeletonData->_version.buffer());
@@ -152,8 +157,11 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
             setError(NULL, errorMsg, "");
             return NULL;
         }
+        loader->setInternTable(_internTable);
         skeletonData = loader->readSkeleton(root, skeletonData);
         delete loader;
+        ContainerUtil::cleanUpVectorOfPointers(linkedMeshes);
+        if (skeletonData) skeletonData->buildIndices();
         return skeletonData;
     }else {
         delete skeletonData;
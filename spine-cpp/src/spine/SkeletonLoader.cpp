@@ -3,11 +3,26 @@
 //
 #include <spine/SkeletonLoader.h>
 #include <spine/SkeletonData.h>
+#include <spine/Animation.h>
+#include <spine/ContainerUtil.h>
+#include <spine/InternTable.h>
+#include <spine/RuntimeContext.h>
+#include <spine/TaskExecutor.h>
 
 #include <spine/skeleton-loader-impl/Loader42.h>
 #include <spine/skeleton-loader-impl/Loader40.h>
 #include <spine/skeleton-loader-impl/Loader38.h>
 
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPINE_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
 namespace spine {
 
     void ISkeletonBinaryLoader::setError(const char *value1, const char *value2) {
@@ -35,11 +50,61 @@ namespace spine {
         return string;
     }
 
+    const char *ISkeletonBinaryLoader::readScratchString(DataInput *input) {
+        int length = readVarint(input, true);
+        if (length == 0) return NULL;
+        _scratch.setSize(length, 0);
+        char *string = _scratch.buffer();
+        memcpy(string, input->cursor, length - 1);
+        input->cursor += length - 1;
+        string[length - 1] = '\0';
+        return string;
+    }
+
+    void ISkeletonBinaryLoader::readStrings(DataInput *input, SkeletonData *skeletonData) {
+        int numStrings = readVarint(input, true);
+        if (numStrings == 0) return;
+
+        // Size the table up front so every string lands in the same allocation.
+        const unsigned char *start = input->cursor;
+        size_t poolSize = 0;
+        for (int i = 0; i < numStrings; i++) {
+            int length = readVarint(input, true);
+            if (length == 0) continue;
+            poolSize += length;
+            input->cursor += length - 1;
+        }
+        input->cursor = start;
+
+        char *pool = poolSize > 0 ? SpineExtension::alloc<char>(poolSize, __FILE__, __LINE__) : NULL;
+        skeletonData->_stringPool = pool;
+        skeletonData->_strings.setSize(numStrings, NULL);
+        for (int i = 0; i < numStrings; i++) {
+            int length = readVarint(input, true);
+            if (length == 0) continue;
+            memcpy(pool, input->cursor, length - 1);
+            input->cursor += length - 1;
+            pool[length - 1] = '\0';
+            skeletonData->_strings[i] = pool;
+            pool += length;
+        }
+    }
+
     char *ISkeletonBinaryLoader::readStringRef(DataInput *input, SkeletonData *skeletonData) {
         int index = readVarint(input, true);
         return index == 0 ? NULL : skeletonData->_strings[index - 1];
     }
 
+    String ISkeletonBinaryLoader::readName(DataInput *input) {
+        const char *chars = readScratchString(input);
+        return _internTable ? _internTable->intern(chars) : String(chars, true, false);
+    }
+
+    String ISkeletonBinaryLoader::readNameRef(DataInput *input, SkeletonData *skeletonData) {
+        const char *chars = readStringRef(input, skeletonData);
+        return _internTable ? _internTable->intern(chars) : String(chars, true, false);
+    }
+
     float ISkeletonBinaryLoader::readFloat(DataInput *input) {
         union {
             int intValue;
@@ -101,28 +166,177 @@ namespace spine {
 
     void ISkeletonBinaryLoader::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
         array.setSize(n, 0);
+        readFloats(input, array.buffer(), n, scale);
+    }
+
+    void ISkeletonBinaryLoader::readShortArray(DataInput *input, Vector<unsigned short> &array) {
+        int n = readVarint(input, true);
+        array.setSize(n, 0);
+        readShorts(input, array.buffer(), n);
+    }
+
+    void ISkeletonBinaryLoader::readFloats(DataInput *input, float *values, int n, float scale) {
+        const unsigned char *bytes = input->cursor;
+        int i = 0;
+#if defined(SPINE_SIMD_SSE2)
+        __m128 scale4 = _mm_set1_ps(scale);
+        __m128i lowMask = _mm_set1_epi32(0x0000ff00), highMask = _mm_set1_epi32(0x00ff0000);
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *) (bytes + (i << 2)));
+            v = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(v, 24), _mm_srli_epi32(v, 24)),
+                             _mm_or_si128(_mm_and_si128(_mm_slli_epi32(v, 8), highMask), _mm_and_si128(_mm_srli_epi32(v, 8), lowMask)));
+            _mm_storeu_ps(values + i, _mm_mul_ps(_mm_castsi128_ps(v), scale4));
+        }
+#elif defined(SPINE_SIMD_NEON)
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t v = vreinterpretq_f32_u8(vrev32q_u8(vld1q_u8(bytes + (i << 2))));
+            vst1q_f32(values + i, vmulq_n_f32(v, scale));
+        }
+#endif
+        for (; i < n; ++i) {
+            const unsigned char *b = bytes + (i << 2);
+            unsigned int bits = ((unsigned int) b[0] << 24) | ((unsigned int) b[1] << 16) | ((unsigned int) b[2] << 8) | b[3];
+            float value;
+            memcpy(&value, &bits, 4);
+            values[i] = value * scale;
+        }
+        input->cursor = bytes + (n << 2);
+    }
 
-        int i;
-        if (scale == 1) {
-            for (i = 0; i < n; ++i) {
-                array[i] = readFloat(input);
+    void ISkeletonBinaryLoader::readShorts(DataInput *input, unsigned short *values, int n) {
+        const unsigned char *bytes = input->cursor;
+        int i = 0;
+#if defined(SPINE_SIMD_SSE2)
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *) (bytes + (i << 1)));
+            _mm_storeu_si128((__m128i *) (values + i), _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+        }
+#elif defined(SPINE_SIMD_NEON)
+        for (; i + 8 <= n; i += 8)
+            vst1q_u16(values + i, vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(bytes + (i << 1)))));
+#endif
+        for (; i < n; ++i)
+            values[i] = (unsigned short) ((bytes[i << 1] << 8) | bytes[(i << 1) + 1]);
+        input->cursor = bytes + (n << 1);
+    }
+
+    bool ISkeletonBinaryLoader::readAnimations(DataInput *input, SkeletonData *skeletonData) {
+        int animationsCount = readVarint(input, true);
+        skeletonData->_animations.setSize(animationsCount, 0);
+        if (!_lazyAnimations || animationsCount == 0) {
+            if (_executor && animationsCount > 1) return readAnimationsParallel(input, skeletonData, animationsCount);
+            for (int i = 0; i < animationsCount; ++i) {
+                String name = _internTable ? readName(input) : String(readString(input), true);
+                Animation *animation = readAnimation(name, input, skeletonData);
+                if (!animation) return false;
+                skeletonData->_animations[i] = animation;
             }
-        } else {
-            for (i = 0; i < n; ++i) {
-                array[i] = readFloat(input) * scale;
+            return true;
+        }
+
+        const unsigned char *start = input->cursor;
+        AnimationDecoder *decoder = new (__FILE__, __LINE__) AnimationDecoder(skeletonData->_version, _scale, start, input->end - start);
+        decoder->_loader->setInternTable(_internTable);
+        skeletonData->_animationDecoder = decoder;
+        decoder->_offsets.setSize(animationsCount, 0);
+        decoder->_decoded.setSize(animationsCount, false);
+        for (int i = 0; i < animationsCount; ++i) {
+            String name = _internTable ? readName(input) : String(readString(input), true);
+            decoder->_offsets[i] = (size_t) (input->cursor - start);
+            skipAnimation(input, skeletonData);
+            if (input->cursor > input->end) {
+                setError("Error reading animation: ", name.buffer());
+                return false;
             }
+            Vector<Timeline *> timelines;
+            skeletonData->_animations[i] = new (__FILE__, __LINE__) Animation(name, timelines, 0);
+            skeletonData->_animations[i]->_decoderIndex = i;
         }
+        return true;
     }
 
-    void ISkeletonBinaryLoader::readShortArray(DataInput *input, Vector<unsigned short> &array) {
-        int n = readVarint(input, true);
-        array.setSize(n, 0);
+    struct ISkeletonBinaryLoader::AnimationTasks {
+        AttachmentLoader *attachmentLoader;
+        SkeletonData *skeletonData;
+        float scale;
+        InternTable *internTable;
+        RuntimeContext *context;
+        const unsigned char *end;
+        Vector<const unsigned char *> starts;
+        Vector<String> names;
+        Vector<Animation *> animations;
+        Vector<String> errors;
+    };
 
-        int i;
-        for (i = 0; i < n; ++i) {
-            array[i] = readByte(input) << 8;
-            array[i] |= readByte(input);
+    void ISkeletonBinaryLoader::readAnimationTask(void *context, int index) {
+        AnimationTasks *tasks = (AnimationTasks *) context;
+        RuntimeContextScope contextScope(tasks->context);
+        Vector<LinkedMesh *> linkedMeshes;
+        float scale = tasks->scale;
+        ISkeletonBinaryLoader *loader = SkeletonLoaderFactory::CreateBinaryLoader(tasks->attachmentLoader, linkedMeshes,
+                                                                                  tasks->skeletonData->_version, scale,
+                                                                                  tasks->errors[index]);
+        loader->setInternTable(tasks->internTable);
+        DataInput input;
+        input.cursor = tasks->starts[index];
+        input.end = tasks->end;
+        tasks->animations[index] = loader->readAnimation(tasks->names[index], &input, tasks->skeletonData);
+        delete loader;
+    }
+
+    bool ISkeletonBinaryLoader::readAnimationsParallel(DataInput *input, SkeletonData *skeletonData, int animationsCount) {
+        AnimationTasks tasks;
+        tasks.attachmentLoader = _attachmentLoader;
+        tasks.skeletonData = skeletonData;
+        tasks.scale = _scale;
+        tasks.internTable = _internTable;
+        tasks.context = RuntimeContext::getCurrent();
+        tasks.end = input->end;
+        tasks.starts.setSize(animationsCount, NULL);
+        tasks.names.setSize(animationsCount, String());
+        tasks.animations.setSize(animationsCount, NULL);
+        tasks.errors.setSize(animationsCount, String());
+        for (int i = 0; i < animationsCount; ++i) {
+            if (_internTable)
+                tasks.names[i] = readName(input);
+            else
+                tasks.names[i].own(readString(input));
+            tasks.starts[i] = input->cursor;
+            skipAnimation(input, skeletonData);
+            if (input->cursor > input->end) {
+                setError("Error reading animation: ", tasks.names[i].buffer());
+                return false;
+            }
+        }
+
+        _executor->run(readAnimationTask, &tasks, animationsCount);
+
+        bool success = true;
+        for (int i = 0; i < animationsCount; ++i) {
+            skeletonData->_animations[i] = tasks.animations[i];
+            if (!tasks.animations[i] && success) {
+                _error = tasks.errors[i];
+                success = false;
+            }
         }
+        return success;
+    }
+
+    void ISkeletonBinaryLoader::skipString(DataInput *input) {
+        int length = readVarint(input, true);
+        if (length > 1) input->cursor += length - 1;
+    }
+
+    void ISkeletonBinaryLoader::skipCurveTimeline(DataInput *input, int frameCount, int valueSize, int bezierValues) {
+        input->cursor += 4 + valueSize;
+        for (int frame = 1; frame < frameCount; frame++) {
+            input->cursor += 4 + valueSize;
+            if (readSByte(input) == CURVE_BEZIER) input->cursor += bezierValues * 16;
+        }
+    }
+
+    String ISkeletonJsonLoader::intern(const char *chars) {
+        return _internTable ? _internTable->intern(chars) : String(chars, true, false);
     }
 
     float ISkeletonJsonLoader::toColor(const char *value, size_t index) {
@@ -150,6 +364,43 @@ namespace spine {
         if (hasAlpha) color.a = toColor(value, 3);
     }
 
+    AnimationDecoder::AnimationDecoder(const String &version, float scale, const unsigned char *data, size_t length)
+            : _scale(scale), _length(length) {
+        _loader = SkeletonLoaderFactory::CreateBinaryLoader(NULL, _linkedMeshes, version, _scale, _error);
+        _data = SpineExtension::alloc<unsigned char>(length, __FILE__, __LINE__);
+        memcpy(_data, data, length);
+    }
+
+    AnimationDecoder::~AnimationDecoder() {
+        delete _loader;
+        SpineExtension::free(_data, __FILE__, __LINE__);
+    }
+
+    bool AnimationDecoder::decode(SkeletonData *skeletonData, size_t index) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_decoded[index]) return true;
+        DataInput input;
+        input.cursor = _data + _offsets[index];
+        input.end = _data + _length;
+        Animation *target = skeletonData->getAnimations()[index];
+        Animation *animation = _loader->readAnimation(target->getName(), &input, skeletonData);
+        if (!animation) return false;
+        target->setTimelines(animation->getTimelines());
+        target->setDuration(animation->getDuration());
+        animation->getTimelines().clear();
+        delete animation;
+        _decoded[index] = true;
+        return true;
+    }
+
+    void AnimationDecoder::evict(SkeletonData *skeletonData, size_t index) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_decoded[index]) return;
+        Vector<Timeline *> timelines;
+        skeletonData->getAnimations()[index]->setTimelines(timelines);
+        _decoded[index] = false;
+    }
+
 #define _STR(s)     #s
 #define STR(s)      _STR(s)
 #define _CONS(a,b)  a##.##b
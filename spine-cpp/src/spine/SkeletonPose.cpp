@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonPose.h>
+
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SPINE_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPINE_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
+using namespace spine;
+
+namespace {
+	// Minimax polynomials for sine and cosine on [-pi/4, pi/4], from Cephes. The angle in degrees is first reduced by a
+	// multiple of 90, which selects the quadrant, so that large angles lose no more precision than MathUtil::sin does.
+	const float Sin1 = -1.6666654611e-1f, Sin2 = 8.3321608736e-3f, Sin3 = -1.9515295891e-4f;
+	const float Cos1 = 4.166664568298827e-2f, Cos2 = -1.388731625493765e-3f, Cos3 = 2.443315711809948e-5f;
+	const float DegRad = 3.1415926535897932385f / 180.0f;
+
+#if defined(SPINE_SIMD_AVX2)
+	struct Simd {
+		typedef __m256 V;
+		static const size_t width = 8;
+
+		static V load(const float *p) { return _mm256_loadu_ps(p); }
+
+		static void store(float *p, V v) { _mm256_storeu_ps(p, v); }
+
+		static V set(float f) { return _mm256_set1_ps(f); }
+
+		static V add(V a, V b) { return _mm256_add_ps(a, b); }
+
+		static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+
+		static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+
+		static void sinCosDeg(V degrees, V &outSin, V &outCos) {
+			__m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(degrees, set(1.0f / 90)));
+			V x = mul(sub(degrees, mul(_mm256_cvtepi32_ps(quadrant), set(90))), set(DegRad));
+			V x2 = mul(x, x);
+			V s = add(x, mul(mul(x, x2), add(set(Sin1), mul(x2, add(set(Sin2), mul(x2, set(Sin3)))))));
+			V c = add(sub(set(1), mul(x2, set(0.5f))), mul(mul(x2, x2), add(set(Cos1), mul(x2, add(set(Cos2), mul(x2, set(Cos3)))))));
+			__m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+			V swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+			V sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+			V cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+			outSin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sinSign);
+			outCos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosSign);
+		}
+	};
+#elif defined(SPINE_SIMD_SSE2)
+	struct Simd {
+		typedef __m128 V;
+		static const size_t width = 4;
+
+		static V load(const float *p) { return _mm_loadu_ps(p); }
+
+		static void store(float *p, V v) { _mm_storeu_ps(p, v); }
+
+		static V set(float f) { return _mm_set1_ps(f); }
+
+		static V add(V a, V b) { return _mm_add_ps(a, b); }
+
+		static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+
+		static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+
+		static V select(V mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+		static void sinCosDeg(V degrees, V &outSin, V &outCos) {
+			__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(degrees, set(1.0f / 90)));
+			V x = mul(sub(degrees, mul(_mm_cvtepi32_ps(quadrant), set(90))), set(DegRad));
+			V x2 = mul(x, x);
+			V s = add(x, mul(mul(x, x2), add(set(Sin1), mul(x2, add(set(Sin2), mul(x2, set(Sin3)))))));
+			V c = add(sub(set(1), mul(x2, set(0.5f))), mul(mul(x2, x2), add(set(Cos1), mul(x2, add(set(Cos2), mul(x2, set(Cos3)))))));
+			__m128i one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+			V swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+			V sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+			V cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+			outSin = _mm_xor_ps(select(swap, c, s), sinSign);
+			outCos = _mm_xor_ps(select(swap, s, c), cosSign);
+		}
+	};
+#elif defined(SPINE_SIMD_NEON)
+	struct Simd {
+		typedef float32x4_t V;
+		static const size_t width = 4;
+
+		static V load(const float *p) { return vld1q_f32(p); }
+
+		static void store(float *p, V v) { vst1q_f32(p, v); }
+
+		static V set(float f) { return vdupq_n_f32(f); }
+
+		static V add(V a, V b) { return vaddq_f32(a, b); }
+
+		static V sub(V a, V b) { return vsubq_f32(a, b); }
+
+		static V mul(V a, V b) { return vmulq_f32(a, b); }
+
+		static void sinCosDeg(V degrees, V &outSin, V &outCos) {
+			V scaled = mul(degrees, set(1.0f / 90));
+			int32x4_t quadrant = vcvtq_s32_f32(add(scaled, vbslq_f32(vcltq_f32(scaled, set(0)), set(-0.5f), set(0.5f))));
+			V x = mul(sub(degrees, mul(vcvtq_f32_s32(quadrant), set(90))), set(DegRad));
+			V x2 = mul(x, x);
+			V s = add(x, mul(mul(x, x2), add(set(Sin1), mul(x2, add(set(Sin2), mul(x2, set(Sin3)))))));
+			V c = add(sub(set(1), mul(x2, set(0.5f))), mul(mul(x2, x2), add(set(Cos1), mul(x2, add(set(Cos2), mul(x2, set(Cos3)))))));
+			int32x4_t one = vdupq_n_s32(1), two = vdupq_n_s32(2);
+			uint32x4_t swap = vceqq_s32(vandq_s32(quadrant, one), one);
+			uint32x4_t sinSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(quadrant, two), 30));
+			uint32x4_t cosSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(vaddq_s32(quadrant, one), two), 30));
+			outSin = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, c, s)), sinSign));
+			outCos = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, s, c)), cosSign));
+		}
+	};
+#endif
+}
+
+SkeletonPose::SkeletonPose() : _stride(0), _updateCacheSize(0) {
+}
+
+static bool isRunBone(Updatable *updatable) {
+	return updatable->getRTTI().isExactly(Bone::rtti) && ((Bone *) updatable)->getParent();
+}
+
+void SkeletonPose::build(Skeleton &skeleton) {
+	_runs.clear();
+	_depths.clear();
+	_bones.clear();
+
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	Vector<int> depths;// The depth in the current run of each bone by index, -1 for bones outside the run.
+	depths.setSize(skeleton.getBones().size(), -1);
+	Vector<size_t> counts;
+	for (size_t i = 0, n = updateCache.size(); i < n;) {
+		if (!isRunBone(updateCache[i])) {
+			i++;
+			continue;
+		}
+		size_t start = i;
+		int maxDepth = 0;
+		for (; i < n && isRunBone(updateCache[i]); i++) {
+			Bone *bone = (Bone *) updateCache[i];
+			int depth = depths[bone->_parent->_data.getIndex()] + 1;
+			depths[bone->_data.getIndex()] = depth;
+			if (depth > maxDepth) maxDepth = depth;
+		}
+
+		if (i - start > 1) {
+			// Sort the bones of the run by depth, keeping their order within each depth.
+			counts.clear();
+			counts.setSize(maxDepth + 1, 0);
+			for (size_t ii = start; ii < i; ii++) counts[depths[((Bone *) updateCache[ii])->_data.getIndex()]]++;
+			size_t first = _bones.size();
+			Run run = {start, i, _depths.size(), _depths.size() + maxDepth + 1};
+			_runs.add(run);
+			for (int depth = 0; depth <= maxDepth; depth++) {
+				_depths.add(first);
+				size_t count = counts[depth];
+				counts[depth] = first;
+				first += count;
+			}
+			_bones.setSize(first, NULL);
+			for (size_t ii = start; ii < i; ii++) {
+				Bone *bone = (Bone *) updateCache[ii];
+				_bones[counts[depths[bone->_data.getIndex()]]++] = bone;
+			}
+		}
+
+		for (size_t ii = start; ii < i; ii++) depths[((Bone *) updateCache[ii])->_data.getIndex()] = -1;
+	}
+	_depths.add(_bones.size());
+	_updateCacheSize = updateCache.size();
+
+	_stride = (_bones.size() + 7) & ~(size_t) 7;
+	_values.clear();
+	_values.setSize(Field_Count * _stride, 0);
+}
+
+void SkeletonPose::update(Skeleton &skeleton, Physics physics) {
+	Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+	if (updateCache.size() != _updateCacheSize) build(skeleton);
+	size_t i = 0;
+	for (size_t r = 0, nr = _runs.size(); r < nr; r++) {
+		Run &run = _runs[r];
+		for (; i < run.start; i++) updateCache[i]->update(physics);
+		for (size_t depth = run.firstDepth; depth < run.lastDepth; depth++)
+			updateDepth(_depths[depth], _depths[depth + 1], physics);
+		i = run.end;
+	}
+	for (size_t n = updateCache.size(); i < n; i++) updateCache[i]->update(physics);
+}
+
+void SkeletonPose::updateDepth(size_t start, size_t end, Physics physics) {
+	float *fields[Field_Count];
+	for (int i = 0; i < Field_Count; i++) fields[i] = field((Field) i);
+	Bone **bones = _bones.buffer();
+
+	for (size_t i = start; i < end; i++) {
+		Bone *bone = bones[i], *parent = bone->_parent;
+		fields[Field_X][i] = bone->_ax;
+		fields[Field_Y][i] = bone->_ay;
+		fields[Field_Rotation][i] = bone->_arotation;
+		fields[Field_ScaleX][i] = bone->_ascaleX;
+		fields[Field_ScaleY][i] = bone->_ascaleY;
+		fields[Field_ShearX][i] = bone->_ashearX;
+		fields[Field_ShearY][i] = bone->_ashearY;
+		fields[Field_ParentA][i] = parent->_a;
+		fields[Field_ParentB][i] = parent->_b;
+		fields[Field_ParentC][i] = parent->_c;
+		fields[Field_ParentD][i] = parent->_d;
+		fields[Field_ParentWorldX][i] = parent->_worldX;
+		fields[Field_ParentWorldY][i] = parent->_worldY;
+	}
+
+	computeWorldTransforms(fields, start, end);
+
+	for (size_t i = start; i < end; i++) {
+		Bone *bone = bones[i];
+		if (bone->_inherit != Inherit_Normal) {
+			bone->update(physics);
+			continue;
+		}
+		bone->_a = fields[Field_A][i];
+		bone->_b = fields[Field_B][i];
+		bone->_c = fields[Field_C][i];
+		bone->_d = fields[Field_D][i];
+		bone->_worldX = fields[Field_WorldX][i];
+		bone->_worldY = fields[Field_WorldY][i];
+	}
+}
+
+void SkeletonPose::computeWorldTransforms(float **fields, size_t start, size_t end) {
+	const float *x = fields[Field_X], *y = fields[Field_Y], *rotation = fields[Field_Rotation];
+	const float *scaleX = fields[Field_ScaleX], *scaleY = fields[Field_ScaleY];
+	const float *shearX = fields[Field_ShearX], *shearY = fields[Field_ShearY];
+	const float *pa = fields[Field_ParentA], *pb = fields[Field_ParentB], *pc = fields[Field_ParentC];
+	const float *pd = fields[Field_ParentD], *pwx = fields[Field_ParentWorldX], *pwy = fields[Field_ParentWorldY];
+	float *a = fields[Field_A], *b = fields[Field_B], *c = fields[Field_C], *d = fields[Field_D];
+	float *worldX = fields[Field_WorldX], *worldY = fields[Field_WorldY];
+
+	size_t i = start;
+#if defined(SPINE_SIMD_AVX2) || defined(SPINE_SIMD_SSE2) || defined(SPINE_SIMD_NEON)
+	typedef Simd::V V;
+	for (; i + Simd::width <= end; i += Simd::width) {
+		V r = Simd::load(rotation + i), sinX, cosX, sinY, cosY;
+		Simd::sinCosDeg(Simd::add(r, Simd::load(shearX + i)), sinX, cosX);
+		Simd::sinCosDeg(Simd::add(Simd::add(r, Simd::set(90)), Simd::load(shearY + i)), sinY, cosY);
+		V sx = Simd::load(scaleX + i), sy = Simd::load(scaleY + i);
+		V la = Simd::mul(cosX, sx), lb = Simd::mul(cosY, sy), lc = Simd::mul(sinX, sx), ld = Simd::mul(sinY, sy);
+		V ppa = Simd::load(pa + i), ppb = Simd::load(pb + i), ppc = Simd::load(pc + i), ppd = Simd::load(pd + i);
+		V lx = Simd::load(x + i), ly = Simd::load(y + i);
+		Simd::store(worldX + i, Simd::add(Simd::add(Simd::mul(ppa, lx), Simd::mul(ppb, ly)), Simd::load(pwx + i)));
+		Simd::store(worldY + i, Simd::add(Simd::add(Simd::mul(ppc, lx), Simd::mul(ppd, ly)), Simd::load(pwy + i)));
+		Simd::store(a + i, Simd::add(Simd::mul(ppa, la), Simd::mul(ppb, lc)));
+		Simd::store(b + i, Simd::add(Simd::mul(ppa, lb), Simd::mul(ppb, ld)));
+		Simd::store(c + i, Simd::add(Simd::mul(ppc, la), Simd::mul(ppd, lc)));
+		Simd::store(d + i, Simd::add(Simd::mul(ppc, lb), Simd::mul(ppd, ld)));
+	}
+#endif
+	for (; i < end; i++) {
+		float rx = (rotation[i] + shearX[i]) * MathUtil::Deg_Rad;
+		float ry = (rotation[i] + 90 + shearY[i]) * MathUtil::Deg_Rad;
+		float la = MathUtil::cos(rx) * scaleX[i];
+		float lb = MathUtil::cos(ry) * scaleY[i];
+		float lc = MathUtil::sin(rx) * scaleX[i];
+		float ld = MathUtil::sin(ry) * scaleY[i];
+		worldX[i] = pa[i] * x[i] + pb[i] * y[i] + pwx[i];
+		worldY[i] = pc[i] * x[i] + pd[i] * y[i] + pwy[i];
+		a[i] = pa[i] * la + pb[i] * lc;
+		b[i] = pa[i] * lb + pb[i] * ld;
+		c[i] = pc[i] * la + pd[i] * lc;
+		d[i] = pc[i] * lb + pd[i] * ld;
+	}
+}
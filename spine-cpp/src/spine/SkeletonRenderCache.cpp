@@ -0,0 +1,236 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonRenderCache.h>
+
+#include <spine/Animation.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+
+#include <string.h>
+
+using namespace spine;
+
+namespace {
+	struct CachedCommand {
+		size_t positions, uvs, colors, darkColors, indices;
+		int32_t numVertices, numIndices;
+		BlendMode blendMode;
+		void *texture;
+	};
+}
+
+// Appends the values, or returns the offset of the previous frame's values if they are the same.
+template<typename T>
+static size_t addValues(Vector<T> &values, const T *data, size_t count, bool reuse, size_t previous) {
+	if (reuse && memcmp(values.buffer() + previous, data, count * sizeof(T)) == 0) return previous;
+	size_t offset = values.size();
+	values.setSize(offset + count, 0);
+	memcpy(values.buffer() + offset, data, count * sizeof(T));
+	return offset;
+}
+
+// Releases the capacity beyond the size.
+template<typename T>
+static void trim(Vector<T> &values) {
+	Vector<T> trimmed;
+	trimmed.addAll(values);
+	values = std::move(trimmed);
+}
+
+SkeletonRenderCache::SkeletonRenderCache(Skeleton &skeleton, Animation &animation, float fps, bool quantize)
+	: _fps(fps), _duration(0), _quantized(quantize), _quantizationError(0) {
+	assert(fps > 0);
+	// A lazily loaded animation has no timelines or duration until it is decoded.
+	skeleton.getData()->decodeAnimation(&animation);
+	_duration = animation.getDuration();
+	SkeletonRenderer renderer;
+	Vector<CachedCommand> cached;
+	Vector<uint16_t> quantized;
+	size_t frameCount = _duration > 0 ? (size_t) MathUtil::ceil(_duration * fps) + 1 : 1, previousFirst = 0;
+	_frameCommands.add(0);
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		float time = MathUtil::min(frame / fps, _duration);
+		skeleton.setToSetupPose();
+		animation.apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		if (frame > 0) skeleton.update(1 / fps);
+		skeleton.updateWorldTransform(Physics_Update);
+		RenderCommand *commands = renderer.render(skeleton);
+
+		float minX = 0, minY = 0, scaleX = 0, scaleY = 0;
+		bool sameBounds = false;
+		if (quantize) {
+			float maxX = 0, maxY = 0;
+			bool first = true;
+			for (RenderCommand *command = commands; command; command = command->next) {
+				for (int32_t i = 0, n = command->numVertices << 1; i < n; i += 2) {
+					float x = command->positions[i], y = command->positions[i + 1];
+					if (first) {
+						minX = maxX = x;
+						minY = maxY = y;
+						first = false;
+						continue;
+					}
+					minX = MathUtil::min(minX, x);
+					minY = MathUtil::min(minY, y);
+					maxX = MathUtil::max(maxX, x);
+					maxY = MathUtil::max(maxY, y);
+				}
+			}
+			scaleX = (maxX - minX) / 65535;
+			scaleY = (maxY - minY) / 65535;
+			size_t bounds = _bounds.size();
+			_bounds.add(minX);
+			_bounds.add(minY);
+			_bounds.add(scaleX);
+			_bounds.add(scaleY);
+			sameBounds = bounds > 0 && memcmp(_bounds.buffer() + bounds - 4, _bounds.buffer() + bounds, 4 * sizeof(float)) == 0;
+		}
+
+		// Data equal to the command at the same position in the previous frame is shared.
+		size_t frameFirst = cached.size(), index = 0;
+		for (RenderCommand *command = commands; command; command = command->next, index++) {
+			int32_t numVertices = command->numVertices, numIndices = command->numIndices;
+			CachedCommand previous = {0, 0, 0, 0, 0, 0, 0, BlendMode_Normal, NULL};
+			if (previousFirst + index < frameFirst) previous = cached[previousFirst + index];
+			bool reuse = previous.numVertices == numVertices && numVertices > 0;
+
+			CachedCommand entry;
+			entry.numVertices = numVertices;
+			entry.numIndices = numIndices;
+			entry.blendMode = command->blendMode;
+			entry.texture = command->texture;
+			if (quantize) {
+				quantized.setSize(numVertices << 1, 0);
+				for (int32_t i = 0, n = numVertices << 1; i < n; i++) {
+					float value = command->positions[i], min = i & 1 ? minY : minX, scale = i & 1 ? scaleY : scaleX;
+					uint16_t q = scale > 0 ? (uint16_t) MathUtil::min((value - min) / scale + 0.5f, 65535.0f) : 0;
+					quantized[i] = q;
+					_quantizationError = MathUtil::max(_quantizationError, MathUtil::abs(min + q * scale - value));
+				}
+				entry.positions = addValues(_quantizedPositions, quantized.buffer(), numVertices << 1,
+											reuse && sameBounds, previous.positions);
+			} else
+				entry.positions = addValues(_floats, command->positions, numVertices << 1, reuse, previous.positions);
+			entry.uvs = addValues(_floats, command->uvs, numVertices << 1, reuse, previous.uvs);
+			entry.colors = addValues(_colors, command->colors, numVertices, reuse, previous.colors);
+			entry.darkColors = addValues(_colors, command->darkColors, numVertices, reuse, previous.darkColors);
+			entry.indices = addValues(_indices, command->indices, numIndices,
+									  reuse && previous.numIndices == numIndices, previous.indices);
+			cached.add(entry);
+		}
+		_frameCommands.add(cached.size());
+		previousFirst = frameFirst;
+	}
+
+	// The buffers are complete, so the commands can point into them.
+	trim(_floats);
+	trim(_colors);
+	trim(_indices);
+	trim(_quantizedPositions);
+	trim(_bounds);
+	_commands.ensureCapacity(cached.size());
+	if (quantize) _quantizedOffsets.ensureCapacity(cached.size());
+	for (size_t i = 0, n = cached.size(); i < n; i++) {
+		CachedCommand &entry = cached[i];
+		RenderCommand command;
+		command.positions = quantize ? NULL : _floats.buffer() + entry.positions;
+		command.uvs = _floats.buffer() + entry.uvs;
+		command.colors = _colors.buffer() + entry.colors;
+		command.darkColors = _colors.buffer() + entry.darkColors;
+		command.numVertices = entry.numVertices;
+		command.indices = _indices.buffer() + entry.indices;
+		command.numIndices = entry.numIndices;
+		command.blendMode = entry.blendMode;
+		command.texture = entry.texture;
+		command.next = NULL;
+		_commands.add(command);
+		if (quantize) _quantizedOffsets.add(entry.positions);
+	}
+	if (quantize) {
+		// Each frame decodes its positions to the start of the same buffer.
+		size_t maxPositions = 0;
+		for (size_t frame = 0; frame < frameCount; frame++) {
+			size_t positions = 0;
+			for (size_t i = _frameCommands[frame], end = _frameCommands[frame + 1]; i < end; i++)
+				positions += _commands[i].numVertices << 1;
+			maxPositions = MathUtil::max(maxPositions, positions);
+		}
+		_positions.setSize(maxPositions, 0);
+		for (size_t frame = 0; frame < frameCount; frame++) {
+			float *positions = _positions.buffer();
+			for (size_t i = _frameCommands[frame], end = _frameCommands[frame + 1]; i < end; i++) {
+				_commands[i].positions = positions;
+				positions += _commands[i].numVertices << 1;
+			}
+		}
+	}
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		for (size_t i = _frameCommands[frame], end = _frameCommands[frame + 1]; i + 1 < end; i++)
+			_commands[i].next = &_commands[i + 1];
+	}
+}
+
+SkeletonRenderCache::~SkeletonRenderCache() {
+}
+
+size_t SkeletonRenderCache::getMemorySize() {
+	return sizeof(SkeletonRenderCache) + _commands.getCapacity() * sizeof(RenderCommand) +
+		   (_frameCommands.getCapacity() + _quantizedOffsets.getCapacity()) * sizeof(size_t) +
+		   (_floats.getCapacity() + _bounds.getCapacity() + _positions.getCapacity()) * sizeof(float) +
+		   _colors.getCapacity() * sizeof(uint32_t) +
+		   (_indices.getCapacity() + _quantizedPositions.getCapacity()) * sizeof(uint16_t);
+}
+
+RenderCommand *SkeletonRenderCache::render(float time, bool loop) {
+	if (loop && _duration != 0) time = MathUtil::fmod(time, _duration);
+	if (time <= 0) return renderFrame(0);
+	return renderFrame((size_t) (time * _fps + 0.5f));
+}
+
+RenderCommand *SkeletonRenderCache::renderFrame(size_t frame) {
+	size_t last = getFrameCount() - 1;
+	if (frame > last) frame = last;
+	size_t first = _frameCommands[frame];
+	if (first == _frameCommands[frame + 1]) return NULL;
+	if (_quantized) {
+		const float *bounds = _bounds.buffer() + (frame << 2);
+		for (size_t i = first, end = _frameCommands[frame + 1]; i < end; i++) {
+			float *positions = _commands[i].positions;
+			const uint16_t *quantized = _quantizedPositions.buffer() + _quantizedOffsets[i];
+			for (int32_t ii = 0, n = _commands[i].numVertices << 1; ii < n; ii += 2) {
+				positions[ii] = bounds[0] + quantized[ii] * bounds[2];
+				positions[ii + 1] = bounds[1] + quantized[ii + 1] * bounds[3];
+			}
+		}
+	}
+	return &_commands[first];
+}
@@ -35,6 +35,8 @@
 #include <spine/MeshAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Sequence.h>
 
 using namespace spine;
 
@@ -50,6 +52,92 @@ SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quad
 SkeletonRenderer::~SkeletonRenderer() {
 }
 
+void SkeletonRenderer::clearCache() {
+	_clipping.clearCache();
+}
+
+namespace {
+	// Converts to an IEEE 754 half float, rounding to nearest even.
+	inline uint16_t toHalf(float value) {
+		const uint32_t infinity = 255 << 23, halfMax = (127 + 16) << 23, subnormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+		uint32_t bits;
+		memcpy(&bits, &value, 4);
+		uint32_t sign = bits & 0x80000000u;
+		bits ^= sign;
+		uint16_t half;
+		if (bits >= halfMax)
+			half = bits > infinity ? 0x7e00 : 0x7c00;
+		else if (bits < (113u << 23)) {
+			// Adding the magic number shifts the mantissa into place and rounds it.
+			float magnitude, magic;
+			memcpy(&magnitude, &bits, 4);
+			memcpy(&magic, &subnormalMagic, 4);
+			magnitude += magic;
+			memcpy(&bits, &magnitude, 4);
+			half = (uint16_t) (bits - subnormalMagic);
+		} else {
+			uint32_t odd = (bits >> 13) & 1;
+			bits += ((uint32_t) (15 - 127) << 23) + 0xfff + odd;
+			half = (uint16_t) (bits >> 13);
+		}
+		return (uint16_t) (half | (sign >> 16));
+	}
+
+	template<UVFormat format>
+	struct UVWriter;
+
+	template<>
+	struct UVWriter<UVFormat_Float> {
+		static void write(uint8_t *dest, float u, float v) {
+			float uv[2] = {u, v};
+			memcpy(dest, uv, 8);
+		}
+	};
+
+	template<>
+	struct UVWriter<UVFormat_Half> {
+		static void write(uint8_t *dest, float u, float v) {
+			uint16_t uv[2] = {toHalf(u), toHalf(v)};
+			memcpy(dest, uv, 4);
+		}
+	};
+
+	template<>
+	struct UVWriter<UVFormat_UNorm16> {
+		static void write(uint8_t *dest, float u, float v) {
+			uint16_t uv[2] = {(uint16_t) (MathUtil::min(MathUtil::max(u, 0.0f), 1.0f) * 65535 + 0.5f),
+							  (uint16_t) (MathUtil::min(MathUtil::max(v, 0.0f), 1.0f) * 65535 + 0.5f)};
+			memcpy(dest, uv, 4);
+		}
+	};
+
+	// Writes the uvs and colors of interleaved vertices. The formats are template arguments so the loop has no branches.
+	template<UVFormat format, bool dark>
+	void writeInterleaved(uint8_t *vertices, const VertexLayout &layout, const float *uvs, int32_t numVertices,
+						  uint32_t color, uint32_t darkColor) {
+		size_t stride = layout.stride;
+		uint8_t *uv = vertices + layout.uvOffset, *colors = vertices + layout.colorOffset;
+		uint8_t *darkColors = vertices + (dark ? layout.darkColorOffset : 0);
+		for (int32_t i = 0; i < numVertices; i++, uvs += 2, uv += stride, colors += stride, darkColors += stride) {
+			UVWriter<format>::write(uv, uvs[0], uvs[1]);
+			memcpy(colors, &color, 4);
+			if (dark) memcpy(darkColors, &darkColor, 4);
+		}
+	}
+
+	typedef void (*InterleavedWriter)(uint8_t *, const VertexLayout &, const float *, int32_t, uint32_t, uint32_t);
+
+	const InterleavedWriter interleavedWriters[3][2] = {
+			{writeInterleaved<UVFormat_Float, false>, writeInterleaved<UVFormat_Float, true>},
+			{writeInterleaved<UVFormat_Half, false>, writeInterleaved<UVFormat_Half, true>},
+			{writeInterleaved<UVFormat_UNorm16, false>, writeInterleaved<UVFormat_UNorm16, true>}};
+
+	uint32_t toColorFormat(uint32_t argb, ColorFormat format) {
+		if (format == ColorFormat_ARGB) return argb;
+		return (argb & 0xff00ff00) | ((argb >> 16) & 0xff) | ((argb & 0xff) << 16);
+	}
+}
+
 static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture) {
 	RenderCommand *cmd = allocator.allocate<RenderCommand>(1);
 	cmd->positions = allocator.allocate<float>(numVertices << 1);
@@ -136,111 +224,290 @@ static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderComm
 	return root;
 }
 
+bool SkeletonRenderer::prepareSlot(Skeleton &skeleton, Slot &slot, SlotGeometry &geometry) {
+	SkeletonClipping &clipper = _clipping;
+	Attachment *attachment = slot.getAttachment();
+	if (!attachment) {
+		clipper.clipEnd(slot);
+		return false;
+	}
+
+	// Early out if the slot color is 0 or the bone is not active
+	if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		clipper.clipEnd(slot);
+		return false;
+	}
+
+	Color *attachmentColor;
+	geometry.region = NULL;
+	geometry.mesh = NULL;
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+		attachmentColor = &regionAttachment->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
+			clipper.clipEnd(slot);
+			return false;
+		}
+
+		// The sequence picks the region, which is needed before the world vertices are computed.
+		if (regionAttachment->getSequence()) regionAttachment->getSequence()->apply(&slot, regionAttachment);
+		geometry.region = regionAttachment;
+		geometry.numVertices = 4;
+		geometry.uvs = &regionAttachment->getUVs();
+		geometry.indices = &_quadIndices;
+		geometry.numIndices = 6;
+		geometry.texture = regionAttachment->getRegion()->rendererObject;
+
+	} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = (MeshAttachment *) attachment;
+		attachmentColor = &mesh->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
+			clipper.clipEnd(slot);
+			return false;
+		}
+
+		if (mesh->getSequence()) mesh->getSequence()->apply(&slot, mesh);
+		geometry.mesh = mesh;
+		geometry.numVertices = (int32_t) (mesh->getWorldVerticesLength() >> 1);
+		geometry.uvs = &mesh->getUVs();
+		geometry.indices = &mesh->getTriangles();
+		geometry.numIndices = (int32_t) geometry.indices->size();
+		geometry.texture = mesh->getRegion()->rendererObject;
+
+	} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
+		clipper.clipStart(slot, clip);
+		return false;
+	} else
+		return false;
+
+	uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
+	uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
+	uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
+	uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
+	geometry.color = (a << 24) | (r << 16) | (g << 8) | b;
+	geometry.darkColor = 0xff000000;
+	if (slot.hasDarkColor()) {
+		Color &slotDarkColor = slot.getDarkColor();
+		geometry.darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+	}
+	geometry.blendMode = slot.getData().getBlendMode();
+
+	if (clipper.isClipping()) {
+		Vector<float> &worldVertices = _worldVertices;
+		worldVertices.setSize(geometry.numVertices << 1, 0);
+		if (geometry.region)
+			geometry.region->computeWorldVertices(slot, worldVertices, 0, 2);
+		else
+			geometry.mesh->computeWorldVertices(slot, 0, worldVertices.size(), worldVertices.buffer(), 0, 2);
+		clipper.clipTriangles(worldVertices, *geometry.indices, *geometry.uvs, 2);
+		geometry.positions = &clipper.getClippedVertices();
+		geometry.numVertices = (int32_t) (clipper.getClippedVertices().size() >> 1);
+		geometry.uvs = &clipper.getClippedUVs();
+		geometry.indices = &clipper.getClippedTriangles();
+		geometry.numIndices = (int32_t) (clipper.getClippedTriangles().size());
+	} else
+		geometry.positions = NULL;
+	return true;
+}
+
+void SkeletonRenderer::writeSlot(Slot &slot, SlotGeometry &geometry, RenderVertices &vertices, int32_t firstVertex,
+								 const VertexLayout *layout) {
+	int32_t numVertices = geometry.numVertices;
+	if (layout) {
+		uint8_t *interleaved = (uint8_t *) vertices.interleaved;
+		float *positions = (float *) (interleaved + layout->positionOffset);
+		size_t stride = layout->stride >> 2;
+		if (geometry.positions) {
+			float *clipped = geometry.positions->buffer();
+			for (int32_t i = 0; i < numVertices; i++, positions += stride, clipped += 2) {
+				positions[0] = clipped[0];
+				positions[1] = clipped[1];
+			}
+		} else if (geometry.region)
+			geometry.region->computeWorldVertices(slot, positions, 0, stride);
+		else
+			geometry.mesh->computeWorldVertices(slot, 0, numVertices << 1, positions, 0, stride);
+		interleavedWriters[layout->uvFormat][layout->darkColorOffset >= 0 ? 1 : 0](
+				interleaved, *layout, geometry.uvs->buffer(), numVertices, toColorFormat(geometry.color, layout->colorFormat),
+				toColorFormat(geometry.darkColor, layout->colorFormat));
+	} else {
+		if (geometry.positions)
+			memcpy(vertices.positions, geometry.positions->buffer(), (numVertices << 1) * sizeof(float));
+		else if (geometry.region)
+			geometry.region->computeWorldVertices(slot, vertices.positions, 0, 2);
+		else
+			geometry.mesh->computeWorldVertices(slot, 0, numVertices << 1, vertices.positions, 0, 2);
+		memcpy(vertices.uvs, geometry.uvs->buffer(), (numVertices << 1) * sizeof(float));
+		for (int ii = 0; ii < numVertices; ii++) {
+			vertices.colors[ii] = geometry.color;
+			vertices.darkColors[ii] = geometry.darkColor;
+		}
+	}
+	unsigned short *indices = geometry.indices->buffer();
+	if (firstVertex == 0)
+		memcpy(vertices.indices, indices, geometry.numIndices * sizeof(uint16_t));
+	else {
+		for (int ii = 0; ii < geometry.numIndices; ii++)
+			vertices.indices[ii] = (uint16_t) (indices[ii] + firstVertex);
+	}
+}
+
 RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 	_allocator.compress();
 	_renderCommands.clear();
 
 	SkeletonClipping &clipper = _clipping;
+	SlotGeometry geometry;
+	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+		Slot &slot = *skeleton.getDrawOrder()[i];
+		if (!prepareSlot(skeleton, slot, geometry)) continue;
+
+		RenderCommand *cmd = createRenderCommand(_allocator, geometry.numVertices, geometry.numIndices, geometry.blendMode, geometry.texture);
+		_renderCommands.add(cmd);
+		RenderVertices vertices = {cmd->positions, cmd->uvs, cmd->colors, cmd->darkColors, NULL, cmd->indices};
+		writeSlot(slot, geometry, vertices, 0, NULL);
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+
+	return batchCommands(_allocator, _renderCommands);
+}
 
+void SkeletonRenderer::render(Skeleton &skeleton, RenderSink &sink, bool batch) {
+	SkeletonClipping &clipper = _clipping;
+	SlotGeometry geometry;
+	RenderVertices vertices;
+	const VertexLayout *layout = sink.getVertexLayout();
+	assert(!layout || ((layout->stride & 3) == 0 && (layout->positionOffset & 3) == 0));
+	bool drawing = false;
+	BlendMode blendMode = BlendMode_Normal;
+	void *texture = NULL;
+	uint32_t color = 0, darkColor = 0;
+	int32_t numVertices = 0, numIndices = 0;
 	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
 		Slot &slot = *skeleton.getDrawOrder()[i];
-		Attachment *attachment = slot.getAttachment();
-		if (!attachment) {
+		if (!prepareSlot(skeleton, slot, geometry)) continue;
+		if (geometry.numVertices == 0 && geometry.numIndices == 0) {
 			clipper.clipEnd(slot);
 			continue;
 		}
 
-		// Early out if the slot color is 0 or the bone is not active
-		if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			clipper.clipEnd(slot);
-			continue;
+		// Slots are merged using the same rules batchCommands uses for render commands.
+		if (drawing && (!batch || geometry.texture != texture || geometry.blendMode != blendMode || geometry.color != color ||
+						geometry.darkColor != darkColor || numIndices + geometry.numIndices >= 0xffff)) {
+			sink.draw(blendMode, texture, numVertices, numIndices);
+			drawing = false;
+		}
+		if (!drawing) {
+			drawing = true;
+			blendMode = geometry.blendMode;
+			texture = geometry.texture;
+			color = geometry.color;
+			darkColor = geometry.darkColor;
+			numVertices = 0;
+			numIndices = 0;
 		}
 
-		Vector<float> *worldVertices = &_worldVertices;
-		Vector<unsigned short> *quadIndices = &_quadIndices;
-		Vector<float> *vertices = worldVertices;
-		int32_t verticesCount;
-		Vector<float> *uvs;
-		Vector<unsigned short> *indices;
-		int32_t indicesCount;
-		Color *attachmentColor;
-		void *texture;
-
-		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
-			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
-			attachmentColor = &regionAttachment->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
+		if (sink.allocate(geometry.numVertices, geometry.numIndices, vertices))
+			writeSlot(slot, geometry, vertices, numVertices, layout);
+		numVertices += geometry.numVertices;
+		numIndices += geometry.numIndices;
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+	if (drawing) sink.draw(blendMode, texture, numVertices, numIndices);
+}
 
-			worldVertices->setSize(8, 0);
-			regionAttachment->computeWorldVertices(slot, *worldVertices, 0, 2);
-			verticesCount = 4;
-			uvs = &regionAttachment->getUVs();
-			indices = quadIndices;
-			indicesCount = 6;
-			texture = regionAttachment->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
-			MeshAttachment *mesh = (MeshAttachment *) attachment;
-			attachmentColor = &mesh->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
+RenderBufferSink::RenderBufferSink() : _positions(NULL), _uvs(NULL), _colors(NULL), _darkColors(NULL), _vertices(NULL),
+									   _layout(), _indices(NULL),
+									   _vertexCapacity(0), _indexCapacity(0), _numVertices(0), _numIndices(0),
+									   _drawVertex(0), _drawIndex(0), _overflowed(false) {
+}
 
-			worldVertices->setSize(mesh->getWorldVerticesLength(), 0);
-			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices->buffer(), 0, 2);
-			verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
-			uvs = &mesh->getUVs();
-			indices = &mesh->getTriangles();
-			indicesCount = (int32_t) indices->size();
-			texture = mesh->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
-			clipper.clipStart(slot, clip);
-			continue;
-		} else
-			continue;
+void RenderBufferSink::setBuffers(float *positions, float *uvs, uint32_t *colors, uint32_t *darkColors,
+								  int32_t vertexCapacity, uint16_t *indices, int32_t indexCapacity) {
+	_positions = positions;
+	_uvs = uvs;
+	_colors = colors;
+	_darkColors = darkColors;
+	_vertexCapacity = vertexCapacity;
+	_vertices = NULL;
+	_indices = indices;
+	_indexCapacity = indexCapacity;
+	clear();
+}
 
-		uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
-		uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
-		uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
-		uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
-		uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
-		uint32_t darkColor = 0xff000000;
-		if (slot.hasDarkColor()) {
-			Color &slotDarkColor = slot.getDarkColor();
-			darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
-		}
+void RenderBufferSink::setBuffers(void *vertices, const VertexLayout &layout, int32_t vertexCapacity, uint16_t *indices,
+								  int32_t indexCapacity) {
+	_positions = NULL;
+	_uvs = NULL;
+	_colors = NULL;
+	_darkColors = NULL;
+	_vertices = (uint8_t *) vertices;
+	_layout = layout;
+	_vertexCapacity = vertexCapacity;
+	_indices = indices;
+	_indexCapacity = indexCapacity;
+	clear();
+}
 
-		if (clipper.isClipping()) {
-			clipper.clipTriangles(*worldVertices, *indices, *uvs, 2);
-			vertices = &clipper.getClippedVertices();
-			verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
-			uvs = &clipper.getClippedUVs();
-			indices = &clipper.getClippedTriangles();
-			indicesCount = (int32_t) (clipper.getClippedTriangles().size());
-		}
+void RenderBufferSink::clear() {
+	_numVertices = 0;
+	_numIndices = 0;
+	_drawVertex = 0;
+	_drawIndex = 0;
+	_overflowed = false;
+	_draws.clear();
+}
 
-		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), texture);
-		_renderCommands.add(cmd);
-		memcpy(cmd->positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
-		memcpy(cmd->uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
-		for (int ii = 0; ii < verticesCount; ii++) {
-			cmd->colors[ii] = color;
-			cmd->darkColors[ii] = darkColor;
-		}
-		memcpy(cmd->indices, indices->buffer(), indices->size() * sizeof(uint16_t));
-		clipper.clipEnd(slot);
+bool RenderBufferSink::allocate(int32_t numVertices, int32_t numIndices, RenderVertices &vertices) {
+	int32_t vertex = _numVertices, index = _numIndices;
+	_numVertices += numVertices;
+	_numIndices += numIndices;
+	if (_overflowed || _numVertices > _vertexCapacity || _numIndices > _indexCapacity) {
+		_overflowed = true;
+		return false;
 	}
-	clipper.clipEnd();
+	if (_vertices) {
+		vertices.interleaved = _vertices + (size_t) vertex * _layout.stride;
+	} else {
+		vertices.positions = _positions + (vertex << 1);
+		vertices.uvs = _uvs + (vertex << 1);
+		vertices.colors = _colors + vertex;
+		vertices.darkColors = _darkColors + vertex;
+	}
+	vertices.indices = _indices + index;
+	return true;
+}
 
-	return batchCommands(_allocator, _renderCommands);
-}
\ No newline at end of file
+void RenderBufferSink::draw(BlendMode blendMode, void *texture, int32_t numVertices, int32_t numIndices) {
+	RenderDraw draw = {blendMode, texture, _drawVertex, numVertices, _drawIndex, numIndices};
+	_draws.add(draw);
+	_drawVertex += numVertices;
+	_drawIndex += numIndices;
+}
+
+const VertexLayout *RenderBufferSink::getVertexLayout() {
+	return _vertices ? &_layout : NULL;
+}
+
+Vector<RenderDraw> &RenderBufferSink::getDraws() {
+	return _draws;
+}
+
+int32_t RenderBufferSink::getNumVertices() {
+	return _numVertices;
+}
+
+int32_t RenderBufferSink::getNumIndices() {
+	return _numIndices;
+}
+
+bool RenderBufferSink::isOverflowed() {
+	return _overflowed;
+}
@@ -0,0 +1,1634 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonSnapshot.h>
+
+#include <spine/Animation.h>
+#include <spine/Arena.h>
+#include <spine/Atlas.h>
+#include <spine/AtlasAttachmentLoader.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/AttachmentType.h>
+#include <spine/BoneData.h>
+#include <spine/BoundingBoxAttachment.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/ColorTimeline.h>
+#include <spine/ContainerUtil.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
+#include <spine/EventData.h>
+#include <spine/EventTimeline.h>
+#include <spine/IkConstraintData.h>
+#include <spine/IkConstraintTimeline.h>
+#include <spine/InheritTimeline.h>
+#include <spine/InternTable.h>
+#include <spine/MeshAttachment.h>
+#include <spine/PathAttachment.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PathConstraintMixTimeline.h>
+#include <spine/PathConstraintPositionTimeline.h>
+#include <spine/PathConstraintSpacingTimeline.h>
+#include <spine/PhysicsConstraintData.h>
+#include <spine/PhysicsConstraintTimeline.h>
+#include <spine/PointAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/RotateTimeline.h>
+#include <spine/RuntimeContext.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/SequenceTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraintData.h>
+#include <spine/TransformConstraintTimeline.h>
+#include <spine/TranslateTimeline.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace spine;
+
+// Header: magic, format version, byte order mark, string count, string pool size. The string offsets and the pool
+// follow, then the body. Everything is 4 byte aligned, in native byte order.
+static const unsigned char MAGIC[4] = {'S', 'P', 'S', 'N'};
+static const unsigned int BYTE_ORDER_MARK = 0x01020304;
+static const int HEADER_SIZE = 20;
+static const int NONE = -1;
+
+// Attachment kinds besides AttachmentType, for attachments shared by several skin entries.
+static const int ATTACHMENT_SHARED = 100;
+
+// Constraint kinds in skins.
+static const int CONSTRAINT_IK = 0;
+static const int CONSTRAINT_TRANSFORM = 1;
+static const int CONSTRAINT_PATH = 2;
+static const int CONSTRAINT_PHYSICS = 3;
+
+enum SnapshotTimelineType {
+	TIMELINE_ATTACHMENT,
+	TIMELINE_RGBA,
+	TIMELINE_RGB,
+	TIMELINE_RGBA2,
+	TIMELINE_RGB2,
+	TIMELINE_ALPHA,
+	TIMELINE_ROTATE,
+	TIMELINE_TRANSLATE,
+	TIMELINE_TRANSLATEX,
+	TIMELINE_TRANSLATEY,
+	TIMELINE_SCALE,
+	TIMELINE_SCALEX,
+	TIMELINE_SCALEY,
+	TIMELINE_SHEAR,
+	TIMELINE_SHEARX,
+	TIMELINE_SHEARY,
+	TIMELINE_INHERIT,
+	TIMELINE_IK,
+	TIMELINE_TRANSFORM,
+	TIMELINE_PATH_POSITION,
+	TIMELINE_PATH_SPACING,
+	TIMELINE_PATH_MIX,
+	TIMELINE_PHYSICS_INERTIA,
+	TIMELINE_PHYSICS_STRENGTH,
+	TIMELINE_PHYSICS_DAMPING,
+	TIMELINE_PHYSICS_MASS,
+	TIMELINE_PHYSICS_WIND,
+	TIMELINE_PHYSICS_GRAVITY,
+	TIMELINE_PHYSICS_MIX,
+	TIMELINE_PHYSICS_RESET,
+	TIMELINE_DEFORM,
+	TIMELINE_SEQUENCE,
+	TIMELINE_DRAW_ORDER,
+	TIMELINE_EVENT
+};
+
+static size_t hashString(const char *chars) {
+	size_t hash = 2166136261u;
+	for (; *chars; chars++)
+		hash = (hash ^ (unsigned char) *chars) * 16777619u;
+	return hash;
+}
+
+static size_t hashPointer(const void *pointer) {
+	uint64_t value = (uint64_t) (uintptr_t) pointer;
+	return (size_t) ((value >> 4) * 0x9E3779B97F4A7C15ull >> 32);
+}
+
+struct SkeletonSnapshot::Output {
+	Vector<unsigned char> body;
+	Vector<const char *> strings;
+	Vector<int> stringTable;
+	Vector<Attachment *> attachments;
+	Vector<int> attachmentTable;
+	Vector<bool> written;
+
+	Output() {
+		stringTable.setSize(1024, NONE);
+		attachmentTable.setSize(1024, NONE);
+	}
+
+	void write(const void *data, size_t size) {
+		size_t offset = body.size();
+		body.setSize(offset + ((size + 3) & ~(size_t) 3), 0);
+		if (size > 0) memcpy(body.buffer() + offset, data, size);
+	}
+
+	void writeInt(int value) {
+		write(&value, 4);
+	}
+
+	void writeFloat(float value) {
+		write(&value, 4);
+	}
+
+	void writeBoolean(bool value) {
+		writeInt(value ? 1 : 0);
+	}
+
+	void writeColor(Color &color) {
+		writeFloat(color.r);
+		writeFloat(color.g);
+		writeFloat(color.b);
+		writeFloat(color.a);
+	}
+
+	void writeFloats(Vector<float> &values) {
+		writeInt((int) values.size());
+		write(values.buffer(), values.size() * sizeof(float));
+	}
+
+	void writeInts(Vector<int> &values) {
+		writeInt((int) values.size());
+		write(values.buffer(), values.size() * sizeof(int));
+	}
+
+	void writeShorts(Vector<unsigned short> &values) {
+		writeInt((int) values.size());
+		write(values.buffer(), values.size() * sizeof(unsigned short));
+	}
+
+	void writeSequence(Sequence *sequence) {
+		writeBoolean(sequence != NULL);
+		if (!sequence) return;
+		writeInt((int) sequence->getRegions().size());
+		writeInt(sequence->getStart());
+		writeInt(sequence->getDigits());
+		writeInt(sequence->getSetupIndex());
+	}
+
+	void writeVertices(VertexAttachment *attachment) {
+		writeInts(attachment->_bones);
+		writeFloats(attachment->_vertices);
+		writeInt((int) attachment->_worldVerticesLength);
+		writeInt(attachment->_timelineAttachment ? findAttachment(attachment->_timelineAttachment) : NONE);
+	}
+
+	void writeString(const char *chars) {
+		if (!chars) {
+			writeInt(NONE);
+			return;
+		}
+		size_t mask = stringTable.size() - 1, i = hashString(chars) & mask;
+		for (; stringTable[i] != NONE; i = (i + 1) & mask) {
+			if (!strcmp(strings[stringTable[i]], chars)) {
+				writeInt(stringTable[i]);
+				return;
+			}
+		}
+		int index = (int) strings.size();
+		strings.add(chars);
+		stringTable[i] = index;
+		if (strings.size() * 2 > stringTable.size()) {
+			stringTable.clear();
+			stringTable.setSize((mask + 1) * 2, NONE);
+			for (size_t n = 0; n < strings.size(); n++)
+				insert(stringTable, hashString(strings[n]), (int) n);
+		}
+		writeInt(index);
+	}
+
+	void writeString(const String &value) {
+		writeString(value.buffer());
+	}
+
+	// Attachments are numbered in the order skins list them, so meshes and timelines can refer to them by index.
+	int findAttachment(Attachment *attachment) {
+		size_t mask = attachmentTable.size() - 1;
+		for (size_t i = hashPointer(attachment) & mask; attachmentTable[i] != NONE; i = (i + 1) & mask)
+			if (attachments[attachmentTable[i]] == attachment) return attachmentTable[i];
+		return NONE;
+	}
+
+	void addAttachment(Attachment *attachment) {
+		if (findAttachment(attachment) != NONE) return;
+		attachments.add(attachment);
+		if (attachments.size() * 2 > attachmentTable.size()) {
+			size_t size = attachmentTable.size() * 2;
+			attachmentTable.clear();
+			attachmentTable.setSize(size, NONE);
+			for (size_t n = 0; n < attachments.size(); n++)
+				insert(attachmentTable, hashPointer(attachments[n]), (int) n);
+		} else
+			insert(attachmentTable, hashPointer(attachment), (int) attachments.size() - 1);
+	}
+
+	static void insert(Vector<int> &table, size_t hash, int index) {
+		size_t mask = table.size() - 1, i = hash & mask;
+		while (table[i] != NONE) i = (i + 1) & mask;
+		table[i] = index;
+	}
+};
+
+struct SkeletonSnapshot::Input {
+	const unsigned char *cursor;
+	const unsigned char *end;
+	Vector<char *> *strings;
+	bool failed;
+
+	Input(const unsigned char *data, int length) : cursor(data), end(data + length), strings(NULL), failed(false) {
+	}
+
+	// Returns the next size bytes, or NULL past the end of the data.
+	const unsigned char *read(size_t size) {
+		if (failed || (size_t) (end - cursor) < size) {
+			failed = true;
+			return NULL;
+		}
+		const unsigned char *data = cursor;
+		cursor += (size + 3) & ~(size_t) 3;
+		if (cursor > end) cursor = end;
+		return data;
+	}
+
+	int readInt() {
+		int value = 0;
+		const unsigned char *data = read(4);
+		if (data) memcpy(&value, data, 4);
+		return value;
+	}
+
+	float readFloat() {
+		float value = 0;
+		const unsigned char *data = read(4);
+		if (data) memcpy(&value, data, 4);
+		return value;
+	}
+
+	bool readBoolean() {
+		return readInt() != 0;
+	}
+
+	Sequence *readSequence() {
+		if (!readBoolean()) return NULL;
+		int count = readInt();
+		int start = readInt(), digits = readInt(), setupIndex = readInt();
+		if (count < 0 || count > 0xffff || failed) {
+			failed = true;
+			return NULL;
+		}
+		Sequence *sequence = new (__FILE__, __LINE__) Sequence(count);
+		sequence->_start = start;
+		sequence->_digits = digits;
+		sequence->_setupIndex = setupIndex;
+		return sequence;
+	}
+
+	int readVertices(VertexAttachment *attachment, size_t attachmentCount) {
+		readArray(attachment->_bones);
+		readArray(attachment->_vertices);
+		int worldVerticesLength = readInt();
+		if (worldVerticesLength < 0) failed = true;
+		attachment->_worldVerticesLength = failed ? 0 : (size_t) worldVerticesLength;
+		return readIndex(attachmentCount, true);
+	}
+
+	void readColor(Color &color) {
+		color.r = readFloat();
+		color.g = readFloat();
+		color.b = readFloat();
+		color.a = readFloat();
+	}
+
+	// Reads an element count, checking that that many elements of the given size are left.
+	int readCount(size_t elementSize) {
+		int count = readInt();
+		if (count < 0 || (size_t) (end - cursor) / elementSize < (size_t) count) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	const unsigned char *readArray(size_t elementSize, int &count) {
+		count = readCount(elementSize);
+		return read(count * elementSize);
+	}
+
+	template<typename T>
+	void readArray(Vector<T> &values) {
+		int count;
+		const unsigned char *data = readArray(sizeof(T), count);
+		values.setSize(count, T());
+		if (count > 0) memcpy(values.buffer(), data, count * sizeof(T));
+	}
+
+	const char *readString() {
+		int index = readInt();
+		if (index == NONE) return NULL;
+		if (index < 0 || index >= (int) strings->size()) {
+			failed = true;
+			return NULL;
+		}
+		return (*strings)[index];
+	}
+
+	// Reads a string that must be set and not empty, as names are.
+	const char *readName() {
+		const char *name = readString();
+		if (!name || !*name) failed = true;
+		return failed ? NULL : name;
+	}
+
+	// Reads an index into items, which must be below limit. Returns NULL for NONE or an invalid index.
+	template<typename T>
+	T *readReference(Vector<T *> &items, size_t limit) {
+		int index = readInt();
+		if (index == NONE) return NULL;
+		if (index < 0 || (size_t) index >= limit || (size_t) index >= items.size()) {
+			failed = true;
+			return NULL;
+		}
+		return items[index];
+	}
+
+	template<typename T>
+	T *readReference(Vector<T *> &items) {
+		return readReference(items, items.size());
+	}
+
+	// Reads an index that must be below count, or NONE if allowed.
+	int readIndex(size_t count, bool optional) {
+		int index = readInt();
+		if ((index == NONE && optional) || (index >= 0 && (size_t) index < count)) return index;
+		failed = true;
+		return NONE;
+	}
+};
+
+static int indexOfConstraint(SkeletonData *skeletonData, ConstraintData *constraint, int &kind) {
+	const RTTI &rtti = constraint->getRTTI();
+	if (rtti.isExactly(IkConstraintData::rtti)) {
+		kind = CONSTRAINT_IK;
+		return skeletonData->getIkConstraints().indexOf(static_cast<IkConstraintData *>(constraint));
+	}
+	if (rtti.isExactly(TransformConstraintData::rtti)) {
+		kind = CONSTRAINT_TRANSFORM;
+		return skeletonData->getTransformConstraints().indexOf(static_cast<TransformConstraintData *>(constraint));
+	}
+	if (rtti.isExactly(PathConstraintData::rtti)) {
+		kind = CONSTRAINT_PATH;
+		return skeletonData->getPathConstraints().indexOf(static_cast<PathConstraintData *>(constraint));
+	}
+	if (rtti.isExactly(PhysicsConstraintData::rtti)) {
+		kind = CONSTRAINT_PHYSICS;
+		return skeletonData->getPhysicsConstraints().indexOf(static_cast<PhysicsConstraintData *>(constraint));
+	}
+	return NONE;
+}
+
+#define SNAPSHOT_TIMELINE(timelineType, Class, getIndex) \
+	if (rtti.isExactly(Class::rtti)) { \
+		index = static_cast<Class *>(timeline)->getIndex(); \
+		return timelineType; \
+	}
+
+static int typeOfTimeline(Timeline *timeline, int &index) {
+	const RTTI &rtti = timeline->getRTTI();
+	index = NONE;
+	SNAPSHOT_TIMELINE(TIMELINE_ATTACHMENT, AttachmentTimeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_RGBA, RGBATimeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_RGB, RGBTimeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_RGBA2, RGBA2Timeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_RGB2, RGB2Timeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_ALPHA, AlphaTimeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_ROTATE, RotateTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_TRANSLATE, TranslateTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_TRANSLATEX, TranslateXTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_TRANSLATEY, TranslateYTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SCALE, ScaleTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SCALEX, ScaleXTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SCALEY, ScaleYTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SHEAR, ShearTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SHEARX, ShearXTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SHEARY, ShearYTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_INHERIT, InheritTimeline, getBoneIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_IK, IkConstraintTimeline, getIkConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_TRANSFORM, TransformConstraintTimeline, getTransformConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PATH_POSITION, PathConstraintPositionTimeline, getPathConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PATH_SPACING, PathConstraintSpacingTimeline, getPathConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PATH_MIX, PathConstraintMixTimeline, getPathConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_INERTIA, PhysicsConstraintInertiaTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_STRENGTH, PhysicsConstraintStrengthTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_DAMPING, PhysicsConstraintDampingTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_MASS, PhysicsConstraintMassTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_WIND, PhysicsConstraintWindTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_GRAVITY, PhysicsConstraintGravityTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_PHYSICS_MIX, PhysicsConstraintMixTimeline, getPhysicsConstraintIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_DEFORM, DeformTimeline, getSlotIndex)
+	SNAPSHOT_TIMELINE(TIMELINE_SEQUENCE, SequenceTimeline, getSlotIndex)
+	if (rtti.isExactly(PhysicsConstraintResetTimeline::rtti)) return TIMELINE_PHYSICS_RESET;
+	if (rtti.isExactly(DrawOrderTimeline::rtti)) return TIMELINE_DRAW_ORDER;
+	if (rtti.isExactly(EventTimeline::rtti)) return TIMELINE_EVENT;
+	return NONE;
+}
+
+#undef SNAPSHOT_TIMELINE
+
+SkeletonSnapshot::SkeletonSnapshot(Atlas *atlasArray) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
+														_error(),
+														_ownsLoader(true),
+														_useArena(false), _internTable(NULL), _context(NULL) {
+}
+
+SkeletonSnapshot::SkeletonSnapshot(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
+																						  _error(),
+																						  _ownsLoader(ownsLoader),
+																						  _useArena(false),
+																						  _internTable(NULL),
+																						  _context(NULL) {
+	assert(_attachmentLoader != NULL);
+}
+
+SkeletonSnapshot::~SkeletonSnapshot() {
+	if (_ownsLoader) delete _attachmentLoader;
+}
+
+bool SkeletonSnapshot::isSnapshot(const unsigned char *data, int length) {
+	return data && length >= HEADER_SIZE && !memcmp(data, MAGIC, 4);
+}
+
+bool SkeletonSnapshot::writeSnapshot(SkeletonData *skeletonData, Vector<unsigned char> &output) {
+	_error = "";
+	for (size_t i = 0, n = skeletonData->_animations.size(); i < n; i++) {
+		if (!skeletonData->decodeAnimation(skeletonData->_animations[i])) {
+			setError("Error decoding animation: ", skeletonData->_animations[i]->getName().buffer());
+			return false;
+		}
+	}
+
+	Output out;
+	out.writeString(skeletonData->_name);
+	out.writeString(skeletonData->_hash);
+	out.writeString(skeletonData->_version);
+	out.writeString(skeletonData->_imagesPath);
+	out.writeString(skeletonData->_audioPath);
+	out.writeFloat(skeletonData->_x);
+	out.writeFloat(skeletonData->_y);
+	out.writeFloat(skeletonData->_width);
+	out.writeFloat(skeletonData->_height);
+	out.writeFloat(skeletonData->_referenceScale);
+	out.writeFloat(skeletonData->_fps);
+
+	/* Bones. */
+	out.writeInt((int) skeletonData->_bones.size());
+	for (size_t i = 0, n = skeletonData->_bones.size(); i < n; i++) {
+		BoneData *data = skeletonData->_bones[i];
+		out.writeString(data->_name);
+		out.writeInt(data->_parent ? data->_parent->_index : NONE);
+		out.writeFloat(data->_length);
+		out.writeFloat(data->_x);
+		out.writeFloat(data->_y);
+		out.writeFloat(data->_rotation);
+		out.writeFloat(data->_scaleX);
+		out.writeFloat(data->_scaleY);
+		out.writeFloat(data->_shearX);
+		out.writeFloat(data->_shearY);
+		out.writeInt(data->_inherit);
+		out.writeBoolean(data->_skinRequired);
+		out.writeColor(data->_color);
+		out.writeString(data->_icon);
+		out.writeBoolean(data->_visible);
+	}
+
+	/* Slots. */
+	out.writeInt((int) skeletonData->_slots.size());
+	for (size_t i = 0, n = skeletonData->_slots.size(); i < n; i++) {
+		SlotData *data = skeletonData->_slots[i];
+		out.writeString(data->_name);
+		out.writeInt(data->_boneData._index);
+		out.writeColor(data->_color);
+		out.writeColor(data->_darkColor);
+		out.writeBoolean(data->_hasDarkColor);
+		out.writeString(data->_attachmentName);
+		out.writeInt(data->_blendMode);
+		out.writeBoolean(data->_visible);
+	}
+
+	/* IK constraints. */
+	out.writeInt((int) skeletonData->_ikConstraints.size());
+	for (size_t i = 0, n = skeletonData->_ikConstraints.size(); i < n; i++) {
+		IkConstraintData *data = skeletonData->_ikConstraints[i];
+		out.writeString(data->_name);
+		out.writeInt((int) data->_order);
+		out.writeBoolean(data->_skinRequired);
+		out.writeInt((int) data->_bones.size());
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			out.writeInt(data->_bones[ii]->_index);
+		out.writeInt(data->_target ? data->_target->_index : NONE);
+		out.writeInt(data->_bendDirection);
+		out.writeBoolean(data->_compress);
+		out.writeBoolean(data->_stretch);
+		out.writeBoolean(data->_uniform);
+		out.writeFloat(data->_mix);
+		out.writeFloat(data->_softness);
+	}
+
+	/* Transform constraints. */
+	out.writeInt((int) skeletonData->_transformConstraints.size());
+	for (size_t i = 0, n = skeletonData->_transformConstraints.size(); i < n; i++) {
+		TransformConstraintData *data = skeletonData->_transformConstraints[i];
+		out.writeString(data->_name);
+		out.writeInt((int) data->_order);
+		out.writeBoolean(data->_skinRequired);
+		out.writeInt((int) data->_bones.size());
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			out.writeInt(data->_bones[ii]->_index);
+		out.writeInt(data->_target ? data->_target->_index : NONE);
+		out.writeFloat(data->_mixRotate);
+		out.writeFloat(data->_mixX);
+		out.writeFloat(data->_mixY);
+		out.writeFloat(data->_mixScaleX);
+		out.writeFloat(data->_mixScaleY);
+		out.writeFloat(data->_mixShearY);
+		out.writeFloat(data->_offsetRotation);
+		out.writeFloat(data->_offsetX);
+		out.writeFloat(data->_offsetY);
+		out.writeFloat(data->_offsetScaleX);
+		out.writeFloat(data->_offsetScaleY);
+		out.writeFloat(data->_offsetShearY);
+		out.writeBoolean(data->_relative);
+		out.writeBoolean(data->_local);
+	}
+
+	/* Path constraints. */
+	out.writeInt((int) skeletonData->_pathConstraints.size());
+	for (size_t i = 0, n = skeletonData->_pathConstraints.size(); i < n; i++) {
+		PathConstraintData *data = skeletonData->_pathConstraints[i];
+		out.writeString(data->_name);
+		out.writeInt((int) data->_order);
+		out.writeBoolean(data->_skinRequired);
+		out.writeInt((int) data->_bones.size());
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			out.writeInt(data->_bones[ii]->_index);
+		out.writeInt(data->_target ? data->_target->_index : NONE);
+		out.writeInt(data->_positionMode);
+		out.writeInt(data->_spacingMode);
+		out.writeInt(data->_rotateMode);
+		out.writeFloat(data->_offsetRotation);
+		out.writeFloat(data->_position);
+		out.writeFloat(data->_spacing);
+		out.writeFloat(data->_mixRotate);
+		out.writeFloat(data->_mixX);
+		out.writeFloat(data->_mixY);
+	}
+
+	/* Physics constraints. */
+	out.writeInt((int) skeletonData->_physicsConstraints.size());
+	for (size_t i = 0, n = skeletonData->_physicsConstraints.size(); i < n; i++) {
+		PhysicsConstraintData *data = skeletonData->_physicsConstraints[i];
+		out.writeString(data->_name);
+		out.writeInt((int) data->_order);
+		out.writeBoolean(data->_skinRequired);
+		out.writeInt(data->_bone ? data->_bone->_index : NONE);
+		out.writeFloat(data->_x);
+		out.writeFloat(data->_y);
+		out.writeFloat(data->_rotate);
+		out.writeFloat(data->_scaleX);
+		out.writeFloat(data->_shearX);
+		out.writeFloat(data->_limit);
+		out.writeFloat(data->_step);
+		out.writeFloat(data->_inertia);
+		out.writeFloat(data->_strength);
+		out.writeFloat(data->_damping);
+		out.writeFloat(data->_massInverse);
+		out.writeFloat(data->_wind);
+		out.writeFloat(data->_gravity);
+		out.writeFloat(data->_mix);
+		out.writeBoolean(data->_inertiaGlobal);
+		out.writeBoolean(data->_strengthGlobal);
+		out.writeBoolean(data->_dampingGlobal);
+		out.writeBoolean(data->_massGlobal);
+		out.writeBoolean(data->_windGlobal);
+		out.writeBoolean(data->_gravityGlobal);
+		out.writeBoolean(data->_mixGlobal);
+	}
+
+	/* Skins. Attachments are numbered up front, so linked meshes can refer to parents in later skins. */
+	for (size_t i = 0, n = skeletonData->_skins.size(); i < n; i++) {
+		Skin::AttachmentMap::Entries entries = skeletonData->_skins[i]->getAttachments();
+		while (entries.hasNext())
+			out.addAttachment(entries.next()._attachment);
+	}
+	out.written.setSize(out.attachments.size(), false);
+	out.writeInt((int) out.attachments.size());
+	out.writeInt((int) skeletonData->_skins.size());
+	out.writeInt(skeletonData->_defaultSkin ? skeletonData->_skins.indexOf(skeletonData->_defaultSkin) : NONE);
+	for (size_t i = 0, n = skeletonData->_skins.size(); i < n; i++)
+		if (!writeSkin(out, skeletonData->_skins[i], skeletonData)) return false;
+
+	/* Events. */
+	out.writeInt((int) skeletonData->_events.size());
+	for (size_t i = 0, n = skeletonData->_events.size(); i < n; i++) {
+		EventData *data = skeletonData->_events[i];
+		out.writeString(data->_name);
+		out.writeInt(data->_intValue);
+		out.writeFloat(data->_floatValue);
+		out.writeString(data->_stringValue);
+		out.writeString(data->_audioPath);
+		out.writeFloat(data->_volume);
+		out.writeFloat(data->_balance);
+	}
+
+	/* Animations. */
+	out.writeInt((int) skeletonData->_animations.size());
+	for (size_t i = 0, n = skeletonData->_animations.size(); i < n; i++) {
+		Animation *animation = skeletonData->_animations[i];
+		Vector<Timeline *> &timelines = animation->getTimelines();
+		out.writeString(animation->getName());
+		out.writeFloat(animation->getDuration());
+		out.writeInt((int) timelines.size());
+		for (size_t ii = 0, nn = timelines.size(); ii < nn; ii++) {
+			if (!writeTimeline(out, timelines[ii], skeletonData)) {
+				setError("Unsupported timeline in animation: ", animation->getName().buffer());
+				return false;
+			}
+		}
+	}
+
+	// Header, string table, body.
+	size_t poolSize = 0;
+	for (size_t i = 0, n = out.strings.size(); i < n; i++)
+		poolSize += strlen(out.strings[i]) + 1;
+	size_t alignedPoolSize = (poolSize + 3) & ~(size_t) 3;
+	size_t start = output.size();
+	size_t size = HEADER_SIZE + out.strings.size() * 4 + alignedPoolSize + out.body.size();
+	output.setSize(start + size, 0);
+	unsigned char *header = output.buffer() + start;
+	int fields[4] = {FORMAT_VERSION, (int) BYTE_ORDER_MARK, (int) out.strings.size(), (int) poolSize};
+	memcpy(header, MAGIC, 4);
+	memcpy(header + 4, fields, sizeof(fields));
+	unsigned char *offsets = header + HEADER_SIZE;
+	unsigned char *pool = offsets + out.strings.size() * 4;
+	int offset = 0;
+	for (size_t i = 0, n = out.strings.size(); i < n; i++) {
+		int length = (int) strlen(out.strings[i]) + 1;
+		memcpy(offsets + i * 4, &offset, 4);
+		memcpy(pool + offset, out.strings[i], length);
+		offset += length;
+	}
+	memcpy(pool + alignedPoolSize, out.body.buffer(), out.body.size());
+	return true;
+}
+
+bool SkeletonSnapshot::writeSkin(Output &output, Skin *skin, SkeletonData *skeletonData) {
+	Vector<BoneData *> &bones = skin->getBones();
+	Vector<ConstraintData *> &constraints = skin->getConstraints();
+	output.writeString(skin->getName());
+	output.writeColor(skin->getColor());
+	output.writeInt((int) bones.size());
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		output.writeInt(bones[i]->_index);
+	output.writeInt((int) constraints.size());
+	for (size_t i = 0, n = constraints.size(); i < n; i++) {
+		int kind = NONE;
+		int index = indexOfConstraint(skeletonData, constraints[i], kind);
+		if (index == NONE) {
+			setError("Skin constraint not found: ", constraints[i]->getName().buffer());
+			return false;
+		}
+		output.writeInt(kind);
+		output.writeInt(index);
+	}
+
+	int count = 0;
+	Skin::AttachmentMap::Entries counted = skin->getAttachments();
+	for (; counted.hasNext(); counted.next())
+		count++;
+	output.writeInt(count);
+	Skin::AttachmentMap::Entries entries = skin->getAttachments();
+	while (entries.hasNext()) {
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		output.writeInt((int) entry._slotIndex);
+		output.writeString(entry._name);
+		if (!writeAttachment(output, entry._attachment)) return false;
+	}
+	return true;
+}
+
+bool SkeletonSnapshot::writeAttachment(Output &output, Attachment *attachment) {
+	int index = output.findAttachment(attachment);
+	if (output.written[index]) {
+		output.writeInt(ATTACHMENT_SHARED);
+		output.writeInt(index);
+		return true;
+	}
+	output.written[index] = true;
+
+	const RTTI &rtti = attachment->getRTTI();
+	if (rtti.isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+		output.writeInt(AttachmentType_Region);
+		output.writeString(region->getName());
+		output.writeString(region->_path);
+		output.writeColor(region->_color);
+		output.writeSequence(region->_sequence);
+		output.writeFloat(region->_x);
+		output.writeFloat(region->_y);
+		output.writeFloat(region->_rotation);
+		output.writeFloat(region->_scaleX);
+		output.writeFloat(region->_scaleY);
+		output.writeFloat(region->_width);
+		output.writeFloat(region->_height);
+	} else if (rtti.isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+		output.writeInt(mesh->_parentMesh ? AttachmentType_Linkedmesh : AttachmentType_Mesh);
+		output.writeString(mesh->getName());
+		output.writeString(mesh->_path);
+		output.writeColor(mesh->_color);
+		output.writeSequence(mesh->_sequence);
+		if (mesh->_parentMesh) {
+			// The vertex data is copied from the parent when the snapshot is read.
+			int parent = output.findAttachment(mesh->_parentMesh);
+			if (parent == NONE) {
+				setError("Parent mesh not found: ", mesh->_parentMesh->getName().buffer());
+				return false;
+			}
+			output.writeInt(parent);
+			output.writeInt(mesh->_timelineAttachment ? output.findAttachment(mesh->_timelineAttachment) : NONE);
+		} else {
+			output.writeVertices(mesh);
+			output.writeFloats(mesh->_regionUVs);
+			output.writeShorts(mesh->_triangles);
+			output.writeShorts(mesh->_edges);
+			output.writeInt(mesh->_hullLength);
+			output.writeInt(mesh->_width);
+			output.writeInt(mesh->_height);
+		}
+	} else if (rtti.isExactly(BoundingBoxAttachment::rtti)) {
+		BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+		output.writeInt(AttachmentType_Boundingbox);
+		output.writeString(box->getName());
+		output.writeVertices(box);
+		output.writeColor(box->getColor());
+	} else if (rtti.isExactly(PathAttachment::rtti)) {
+		PathAttachment *path = static_cast<PathAttachment *>(attachment);
+		output.writeInt(AttachmentType_Path);
+		output.writeString(path->getName());
+		output.writeVertices(path);
+		output.writeFloats(path->_lengths);
+		output.writeBoolean(path->_closed);
+		output.writeBoolean(path->_constantSpeed);
+		output.writeColor(path->_color);
+	} else if (rtti.isExactly(PointAttachment::rtti)) {
+		PointAttachment *point = static_cast<PointAttachment *>(attachment);
+		output.writeInt(AttachmentType_Point);
+		output.writeString(point->getName());
+		output.writeFloat(point->_x);
+		output.writeFloat(point->_y);
+		output.writeFloat(point->_rotation);
+		output.writeColor(point->_color);
+	} else if (rtti.isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+		output.writeInt(AttachmentType_Clipping);
+		output.writeString(clip->getName());
+		output.writeVertices(clip);
+		output.writeInt(clip->_endSlot ? clip->_endSlot->_index : NONE);
+		output.writeColor(clip->_color);
+	} else {
+		setError("Unsupported attachment type: ", rtti.getClassName());
+		return false;
+	}
+	return true;
+}
+
+bool SkeletonSnapshot::writeTimeline(Output &output, Timeline *timeline, SkeletonData *skeletonData) {
+	int index;
+	int type = typeOfTimeline(timeline, index);
+	if (type == NONE) return false;
+	if (type == TIMELINE_PHYSICS_RESET) index = static_cast<PhysicsConstraintResetTimeline *>(timeline)->_constraintIndex;
+	output.writeInt(type);
+	output.writeInt(index);
+	output.writeInt((int) timeline->getFrameCount());
+	output.writeFloats(timeline->getFrames());
+	if (timeline->getRTTI().instanceOf(CurveTimeline::rtti)) {
+		Vector<float> &curves = static_cast<CurveTimeline *>(timeline)->_curves;
+		output.writeInt((int) ((curves.size() - timeline->getFrameCount()) / CurveTimeline::BEZIER_SIZE));
+		output.writeFloats(curves);
+	}
+
+	switch (type) {
+		case TIMELINE_ATTACHMENT: {
+			Vector<String> &names = static_cast<AttachmentTimeline *>(timeline)->getAttachmentNames();
+			for (size_t i = 0, n = names.size(); i < n; i++)
+				output.writeString(names[i]);
+			break;
+		}
+		case TIMELINE_DEFORM: {
+			DeformTimeline *deformTimeline = static_cast<DeformTimeline *>(timeline);
+			int attachment = output.findAttachment(deformTimeline->getAttachment());
+			if (attachment == NONE) return false;
+			output.writeInt(attachment);
+			Vector<Vector<float> > &vertices = deformTimeline->getVertices();
+			for (size_t i = 0, n = vertices.size(); i < n; i++)
+				output.writeFloats(vertices[i]);
+			break;
+		}
+		case TIMELINE_SEQUENCE: {
+			int attachment = output.findAttachment(static_cast<SequenceTimeline *>(timeline)->getAttachment());
+			if (attachment == NONE) return false;
+			output.writeInt(attachment);
+			break;
+		}
+		case TIMELINE_DRAW_ORDER: {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			for (size_t i = 0, n = drawOrders.size(); i < n; i++)
+				output.writeInts(drawOrders[i]);
+			break;
+		}
+		case TIMELINE_EVENT: {
+			Vector<Event *> &events = static_cast<EventTimeline *>(timeline)->getEvents();
+			for (size_t i = 0, n = events.size(); i < n; i++) {
+				Event *event = events[i];
+				int data = skeletonData->_events.indexOf(const_cast<EventData *>(&event->_data));
+				if (data == NONE) return false;
+				output.writeInt(data);
+				output.writeFloat(event->_time);
+				output.writeInt(event->_intValue);
+				output.writeFloat(event->_floatValue);
+				output.writeString(event->_stringValue);
+				output.writeFloat(event->_volume);
+				output.writeFloat(event->_balance);
+			}
+			break;
+		}
+	}
+	return true;
+}
+
+SkeletonData *SkeletonSnapshot::readSnapshotData(const unsigned char *data, const int length) {
+	RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
+	if (!isSnapshot(data, length)) {
+		setError("Not a skeleton snapshot.", "");
+		return NULL;
+	}
+	SkeletonData *skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	if (!_useArena) {
+		skeletonData = readSnapshot(data, length, skeletonData, _error);
+		if (skeletonData) skeletonData->buildIndices();
+		return skeletonData;
+	}
+
+	// See SkeletonBinary::readSkeleton.
+	Arena *arena = new (__FILE__, __LINE__) Arena();
+	{
+		ArenaScope scope(arena);
+		String error;
+		skeletonData = readSnapshot(data, length, skeletonData, error);
+		if (!skeletonData) {
+			ArenaScope heap(NULL);
+			_error = error;
+		}
+	}
+	if (skeletonData) {
+		skeletonData->_arena.set(arena);
+		skeletonData->buildIndices();
+	} else
+		delete arena;
+	return skeletonData;
+}
+
+SkeletonData *SkeletonSnapshot::readSnapshotDataFile(const String &path) {
+	RuntimeContextScope context(_context ? _context : RuntimeContext::getCurrent());
+	int length = 0;
+	const unsigned char *mapped = SpineExtension::mapFile(path, &length);
+	if (length == 0 || !mapped) {
+		setError("Unable to map skeleton snapshot: ", path.buffer());
+		return NULL;
+	}
+	SkeletonData *skeletonData = readSnapshotData(mapped, length);
+	SpineExtension::unmapFile(mapped, length);
+	return skeletonData;
+}
+
+SkeletonData *SkeletonSnapshot::readSnapshot(const unsigned char *data, int length, SkeletonData *skeletonData, String &error) {
+	Input input(data, length);
+	input.read(4);
+	int formatVersion = input.readInt();
+	unsigned int byteOrder = (unsigned int) input.readInt();
+	if (formatVersion != FORMAT_VERSION || byteOrder != BYTE_ORDER_MARK) {
+		char message[128];
+		snprintf(message, 128, "Unsupported skeleton snapshot format version %d.", formatVersion);
+		error = byteOrder != BYTE_ORDER_MARK ? "Skeleton snapshot was written with a different byte order." : message;
+		delete skeletonData;
+		return NULL;
+	}
+
+	Vector<Attachment *> attachments;
+	Vector<int> links;
+
+	/* Strings. */
+	int stringCount = input.readCount(4);
+	int poolSize = input.readInt();
+	const unsigned char *offsets = input.read(stringCount * 4);
+	const unsigned char *pool = poolSize >= 0 ? input.read(poolSize) : NULL;
+	if (!pool && poolSize != 0) input.failed = true;
+	if (stringCount > 0 && poolSize == 0) input.failed = true;
+	if (!input.failed && stringCount > 0) {
+		char *strings = SpineExtension::alloc<char>(poolSize, __FILE__, __LINE__);
+		memcpy(strings, pool, poolSize);
+		skeletonData->_stringPool = strings;
+		skeletonData->_strings.setSize(stringCount, NULL);
+		for (int i = 0; i < stringCount; i++) {
+			int offset;
+			memcpy(&offset, offsets + i * 4, 4);
+			if (offset < 0 || offset >= poolSize || (i == stringCount - 1 && strings[poolSize - 1] != '\0')) {
+				input.failed = true;
+				break;
+			}
+			skeletonData->_strings[i] = strings + offset;
+		}
+	}
+	input.strings = &skeletonData->_strings;
+
+	skeletonData->_name = input.readString();
+	skeletonData->_hash = input.readString();
+	skeletonData->_version = input.readString();
+	skeletonData->_imagesPath = input.readString();
+	skeletonData->_audioPath = input.readString();
+	skeletonData->_x = input.readFloat();
+	skeletonData->_y = input.readFloat();
+	skeletonData->_width = input.readFloat();
+	skeletonData->_height = input.readFloat();
+	skeletonData->_referenceScale = input.readFloat();
+	skeletonData->_fps = input.readFloat();
+
+	/* Bones. */
+	int bonesCount = input.readCount(4);
+	skeletonData->_bones.setSize(bonesCount, NULL);
+	for (int i = 0; i < bonesCount && !input.failed; i++) {
+		const char *name = input.readName();
+		BoneData *parent = input.readReference(skeletonData->_bones, i);
+		if (input.failed) break;
+		BoneData *data = new (__FILE__, __LINE__) BoneData(i, intern(name), parent);
+		data->_length = input.readFloat();
+		data->_x = input.readFloat();
+		data->_y = input.readFloat();
+		data->_rotation = input.readFloat();
+		data->_scaleX = input.readFloat();
+		data->_scaleY = input.readFloat();
+		data->_shearX = input.readFloat();
+		data->_shearY = input.readFloat();
+		data->_inherit = static_cast<Inherit>(input.readInt());
+		data->_skinRequired = input.readBoolean();
+		input.readColor(data->_color);
+		data->_icon = input.readString();
+		data->_visible = input.readBoolean();
+		skeletonData->_bones[i] = data;
+	}
+
+	/* Slots. */
+	int slotsCount = input.readCount(4);
+	skeletonData->_slots.setSize(slotsCount, NULL);
+	for (int i = 0; i < slotsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		BoneData *boneData = input.readReference(skeletonData->_bones);
+		if (!boneData || input.failed) {
+			input.failed = true;
+			break;
+		}
+		SlotData *data = new (__FILE__, __LINE__) SlotData(i, intern(name), *boneData);
+		input.readColor(data->_color);
+		input.readColor(data->_darkColor);
+		data->_hasDarkColor = input.readBoolean();
+		data->_attachmentName = intern(input.readString());
+		data->_blendMode = static_cast<BlendMode>(input.readInt());
+		data->_visible = input.readBoolean();
+		skeletonData->_slots[i] = data;
+	}
+
+	/* IK constraints. */
+	int ikConstraintsCount = input.readCount(4);
+	skeletonData->_ikConstraints.setSize(ikConstraintsCount, NULL);
+	for (int i = 0; i < ikConstraintsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		if (input.failed) break;
+		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(intern(name));
+		data->_order = (size_t) input.readInt();
+		data->_skinRequired = input.readBoolean();
+		data->_bones.setSize(input.readCount(4), NULL);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			data->_bones[ii] = input.readReference(skeletonData->_bones);
+		data->_target = input.readReference(skeletonData->_bones);
+		data->_bendDirection = input.readInt();
+		data->_compress = input.readBoolean();
+		data->_stretch = input.readBoolean();
+		data->_uniform = input.readBoolean();
+		data->_mix = input.readFloat();
+		data->_softness = input.readFloat();
+		skeletonData->_ikConstraints[i] = data;
+	}
+
+	/* Transform constraints. */
+	int transformConstraintsCount = input.readCount(4);
+	skeletonData->_transformConstraints.setSize(transformConstraintsCount, NULL);
+	for (int i = 0; i < transformConstraintsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		if (input.failed) break;
+		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(intern(name));
+		data->_order = (size_t) input.readInt();
+		data->_skinRequired = input.readBoolean();
+		data->_bones.setSize(input.readCount(4), NULL);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			data->_bones[ii] = input.readReference(skeletonData->_bones);
+		data->_target = input.readReference(skeletonData->_bones);
+		data->_mixRotate = input.readFloat();
+		data->_mixX = input.readFloat();
+		data->_mixY = input.readFloat();
+		data->_mixScaleX = input.readFloat();
+		data->_mixScaleY = input.readFloat();
+		data->_mixShearY = input.readFloat();
+		data->_offsetRotation = input.readFloat();
+		data->_offsetX = input.readFloat();
+		data->_offsetY = input.readFloat();
+		data->_offsetScaleX = input.readFloat();
+		data->_offsetScaleY = input.readFloat();
+		data->_offsetShearY = input.readFloat();
+		data->_relative = input.readBoolean();
+		data->_local = input.readBoolean();
+		skeletonData->_transformConstraints[i] = data;
+	}
+
+	/* Path constraints. */
+	int pathConstraintsCount = input.readCount(4);
+	skeletonData->_pathConstraints.setSize(pathConstraintsCount, NULL);
+	for (int i = 0; i < pathConstraintsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		if (input.failed) break;
+		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(intern(name));
+		data->_order = (size_t) input.readInt();
+		data->_skinRequired = input.readBoolean();
+		data->_bones.setSize(input.readCount(4), NULL);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			data->_bones[ii] = input.readReference(skeletonData->_bones);
+		data->_target = input.readReference(skeletonData->_slots);
+		data->_positionMode = static_cast<PositionMode>(input.readInt());
+		data->_spacingMode = static_cast<SpacingMode>(input.readInt());
+		data->_rotateMode = static_cast<RotateMode>(input.readInt());
+		data->_offsetRotation = input.readFloat();
+		data->_position = input.readFloat();
+		data->_spacing = input.readFloat();
+		data->_mixRotate = input.readFloat();
+		data->_mixX = input.readFloat();
+		data->_mixY = input.readFloat();
+		skeletonData->_pathConstraints[i] = data;
+	}
+
+	/* Physics constraints. */
+	int physicsConstraintsCount = input.readCount(4);
+	skeletonData->_physicsConstraints.setSize(physicsConstraintsCount, NULL);
+	for (int i = 0; i < physicsConstraintsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		if (input.failed) break;
+		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(intern(name));
+		data->_order = (size_t) input.readInt();
+		data->_skinRequired = input.readBoolean();
+		data->_bone = input.readReference(skeletonData->_bones);
+		data->_x = input.readFloat();
+		data->_y = input.readFloat();
+		data->_rotate = input.readFloat();
+		data->_scaleX = input.readFloat();
+		data->_shearX = input.readFloat();
+		data->_limit = input.readFloat();
+		data->_step = input.readFloat();
+		data->_inertia = input.readFloat();
+		data->_strength = input.readFloat();
+		data->_damping = input.readFloat();
+		data->_massInverse = input.readFloat();
+		data->_wind = input.readFloat();
+		data->_gravity = input.readFloat();
+		data->_mix = input.readFloat();
+		data->_inertiaGlobal = input.readBoolean();
+		data->_strengthGlobal = input.readBoolean();
+		data->_dampingGlobal = input.readBoolean();
+		data->_massGlobal = input.readBoolean();
+		data->_windGlobal = input.readBoolean();
+		data->_gravityGlobal = input.readBoolean();
+		data->_mixGlobal = input.readBoolean();
+		skeletonData->_physicsConstraints[i] = data;
+	}
+
+	/* Skins. */
+	int attachmentsCount = input.readCount(4);
+	attachments.ensureCapacity(attachmentsCount);
+	int skinsCount = input.readCount(4);
+	int defaultSkin = input.readIndex(skinsCount, true);
+	for (int i = 0; i < skinsCount && !input.failed; i++) {
+		Skin *skin = readSkin(input, skeletonData, attachments, links, error);
+		if (!skin) break;
+		skeletonData->_skins.add(skin);
+	}
+	if (defaultSkin != NONE && !input.failed && error.isEmpty())
+		skeletonData->_defaultSkin = skeletonData->_skins[defaultSkin];
+
+	/* Timeline attachments and linked meshes, which may refer to attachments read after them. */
+	for (size_t i = 0, n = links.size(); i < n && !input.failed && error.isEmpty(); i += 3) {
+		VertexAttachment *attachment = static_cast<VertexAttachment *>(attachments[links[i]]);
+		int timelineAttachment = links[i + 1], parent = links[i + 2];
+		if (timelineAttachment >= (int) attachments.size() || parent >= (int) attachments.size()) {
+			input.failed = true;
+			break;
+		}
+		if (timelineAttachment != NONE) attachment->_timelineAttachment = attachments[timelineAttachment];
+		if (parent == NONE) continue;
+		Attachment *parentMesh = attachments[parent];
+		if (!parentMesh->getRTTI().isExactly(MeshAttachment::rtti)) {
+			input.failed = true;
+			break;
+		}
+		MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+		mesh->setParentMesh(static_cast<MeshAttachment *>(parentMesh));
+		if (mesh->_region) mesh->updateRegion();
+		_attachmentLoader->configureAttachment(mesh);
+	}
+
+	/* Events. */
+	int eventsCount = input.failed || !error.isEmpty() ? 0 : input.readCount(4);
+	skeletonData->_events.setSize(eventsCount, NULL);
+	for (int i = 0; i < eventsCount && !input.failed; i++) {
+		const char *name = input.readName();
+		if (input.failed) break;
+		EventData *data = new (__FILE__, __LINE__) EventData(intern(name));
+		data->_intValue = input.readInt();
+		data->_floatValue = input.readFloat();
+		data->_stringValue = input.readString();
+		data->_audioPath = input.readString();
+		data->_volume = input.readFloat();
+		data->_balance = input.readFloat();
+		skeletonData->_events[i] = data;
+	}
+
+	/* Animations. */
+	int animationsCount = input.failed || !error.isEmpty() ? 0 : input.readCount(4);
+	skeletonData->_animations.ensureCapacity(animationsCount);
+	for (int i = 0; i < animationsCount && !input.failed; i++) {
+		Animation *animation = readAnimation(input, skeletonData, attachments, error);
+		if (!animation) break;
+		skeletonData->_animations.add(animation);
+	}
+
+	if (input.failed || !error.isEmpty()) {
+		if (error.isEmpty()) error = "Invalid skeleton snapshot.";
+		delete skeletonData;
+		return NULL;
+	}
+	return skeletonData;
+}
+
+Skin *SkeletonSnapshot::readSkin(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments, Vector<int> &links, String &error) {
+	const char *name = input.readName();
+	if (input.failed) return NULL;
+	Skin *skin = new (__FILE__, __LINE__) Skin(intern(name));
+	input.readColor(skin->getColor());
+	Vector<BoneData *> &bones = skin->getBones();
+	bones.setSize(input.readCount(4), NULL);
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		bones[i] = input.readReference(skeletonData->_bones);
+	Vector<ConstraintData *> &constraints = skin->getConstraints();
+	for (int i = 0, n = input.readCount(8); i < n && !input.failed; i++) {
+		int kind = input.readInt();
+		ConstraintData *constraint = NULL;
+		switch (kind) {
+			case CONSTRAINT_IK:
+				constraint = input.readReference(skeletonData->_ikConstraints);
+				break;
+			case CONSTRAINT_TRANSFORM:
+				constraint = input.readReference(skeletonData->_transformConstraints);
+				break;
+			case CONSTRAINT_PATH:
+				constraint = input.readReference(skeletonData->_pathConstraints);
+				break;
+			case CONSTRAINT_PHYSICS:
+				constraint = input.readReference(skeletonData->_physicsConstraints);
+				break;
+		}
+		if (!constraint) input.failed = true;
+		constraints.add(constraint);
+	}
+
+	for (int i = 0, n = input.readCount(12); i < n && !input.failed; i++) {
+		int slotIndex = input.readIndex(skeletonData->_slots.size(), false);
+		const char *attachmentName = input.readName();
+		Attachment *attachment = readAttachment(input, skin, skeletonData, attachments, links, error);
+		if (!attachment) {
+			if (error.isEmpty()) input.failed = true;
+			break;
+		}
+		if (!input.failed)
+			skin->setAttachment(slotIndex, intern(attachmentName), attachment);
+		else if (attachment->getRefCount() == 0)
+			delete attachment;
+	}
+	if (input.failed || !error.isEmpty()) {
+		delete skin;
+		return NULL;
+	}
+	return skin;
+}
+
+Attachment *SkeletonSnapshot::readAttachment(Input &input, Skin *skin, SkeletonData *skeletonData, Vector<Attachment *> &attachments, Vector<int> &links, String &error) {
+	int kind = input.readInt();
+	if (kind == ATTACHMENT_SHARED) return input.readReference(attachments);
+
+	String name = intern(input.readName());
+	if (input.failed) return NULL;
+	Attachment *attachment = NULL;
+	switch (kind) {
+		case AttachmentType_Region: {
+			String path = intern(input.readString());
+			Color color;
+			input.readColor(color);
+			Sequence *sequence = input.readSequence();
+			float x = input.readFloat(), y = input.readFloat(), rotation = input.readFloat();
+			float scaleX = input.readFloat(), scaleY = input.readFloat(), width = input.readFloat(), height = input.readFloat();
+			if (input.failed) {
+				delete sequence;
+				return NULL;
+			}
+			RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, name, path, sequence);
+			if (!region) {
+				delete sequence;
+				break;
+			}
+			region->_path = path;
+			region->_rotation = rotation;
+			region->_x = x;
+			region->_y = y;
+			region->_scaleX = scaleX;
+			region->_scaleY = scaleY;
+			region->_width = width;
+			region->_height = height;
+			region->getColor().set(color);
+			region->_sequence = sequence;
+			if (sequence == NULL) region->updateRegion();
+			_attachmentLoader->configureAttachment(region);
+			attachment = region;
+			break;
+		}
+		case AttachmentType_Mesh:
+		case AttachmentType_Linkedmesh: {
+			String path = intern(input.readString());
+			Color color;
+			input.readColor(color);
+			Sequence *sequence = input.readSequence();
+			if (input.failed) return NULL;
+			MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, sequence);
+			if (!mesh) {
+				delete sequence;
+				break;
+			}
+			mesh->_path = path;
+			mesh->_color.set(color);
+			mesh->_sequence = sequence;
+			links.add((int) attachments.size());
+			if (kind == AttachmentType_Linkedmesh) {
+				// Configured once the parent is known.
+				int parent = input.readIndex((size_t) -1, false);
+				links.add(input.readIndex((size_t) -1, true));
+				links.add(parent);
+			} else {
+				links.add(input.readVertices(mesh, (size_t) -1));
+				links.add(NONE);
+				input.readArray(mesh->_regionUVs);
+				input.readArray(mesh->_triangles);
+				input.readArray(mesh->_edges);
+				mesh->_hullLength = input.readInt();
+				mesh->_width = input.readInt();
+				mesh->_height = input.readInt();
+				if (mesh->_regionUVs.size() != mesh->_worldVerticesLength) input.failed = true;
+				if (!input.failed) {
+					if (sequence == NULL) mesh->updateRegion();
+					_attachmentLoader->configureAttachment(mesh);
+				}
+			}
+			attachment = mesh;
+			break;
+		}
+		case AttachmentType_Boundingbox: {
+			BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, name);
+			if (!box) break;
+			links.add((int) attachments.size());
+			links.add(input.readVertices(box, (size_t) -1));
+			links.add(NONE);
+			input.readColor(box->getColor());
+			_attachmentLoader->configureAttachment(box);
+			attachment = box;
+			break;
+		}
+		case AttachmentType_Path: {
+			PathAttachment *path = _attachmentLoader->newPathAttachment(*skin, name);
+			if (!path) break;
+			links.add((int) attachments.size());
+			links.add(input.readVertices(path, (size_t) -1));
+			links.add(NONE);
+			input.readArray(path->_lengths);
+			path->_closed = input.readBoolean();
+			path->_constantSpeed = input.readBoolean();
+			input.readColor(path->_color);
+			_attachmentLoader->configureAttachment(path);
+			attachment = path;
+			break;
+		}
+		case AttachmentType_Point: {
+			PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, name);
+			if (!point) break;
+			point->_x = input.readFloat();
+			point->_y = input.readFloat();
+			point->_rotation = input.readFloat();
+			input.readColor(point->_color);
+			_attachmentLoader->configureAttachment(point);
+			attachment = point;
+			break;
+		}
+		case AttachmentType_Clipping: {
+			ClippingAttachment *clip = _attachmentLoader->newClippingAttachment(*skin, name);
+			if (!clip) break;
+			links.add((int) attachments.size());
+			links.add(input.readVertices(clip, (size_t) -1));
+			links.add(NONE);
+			clip->_endSlot = input.readReference(skeletonData->_slots);
+			input.readColor(clip->_color);
+			_attachmentLoader->configureAttachment(clip);
+			attachment = clip;
+			break;
+		}
+		default:
+			input.failed = true;
+			return NULL;
+	}
+	if (!attachment) {
+		if (!input.failed) error = String("Error reading attachment: ").append(name);
+		return NULL;
+	}
+	attachments.add(attachment);
+	return attachment;
+}
+
+#define SNAPSHOT_CURVE_TIMELINE(timelineType, Class) \
+	case timelineType: \
+		timeline = new (__FILE__, __LINE__) Class(frameCount, bezierCount, index); \
+		break;
+
+Timeline *SkeletonSnapshot::readTimeline(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments) {
+	int type = input.readInt();
+	int index = input.readInt();
+	int frameCount = input.readInt();
+	int framesCount;
+	const unsigned char *frames = input.readArray(sizeof(float), framesCount);
+	if (input.failed || frameCount < 1 || frameCount > framesCount) return NULL;
+
+	size_t limit = 0;
+	bool indexed = true;
+	switch (type) {
+		case TIMELINE_ATTACHMENT:
+		case TIMELINE_RGBA:
+		case TIMELINE_RGB:
+		case TIMELINE_RGBA2:
+		case TIMELINE_RGB2:
+		case TIMELINE_ALPHA:
+		case TIMELINE_DEFORM:
+		case TIMELINE_SEQUENCE:
+			limit = skeletonData->_slots.size();
+			break;
+		case TIMELINE_IK:
+			limit = skeletonData->_ikConstraints.size();
+			break;
+		case TIMELINE_TRANSFORM:
+			limit = skeletonData->_transformConstraints.size();
+			break;
+		case TIMELINE_PATH_POSITION:
+		case TIMELINE_PATH_SPACING:
+		case TIMELINE_PATH_MIX:
+			limit = skeletonData->_pathConstraints.size();
+			break;
+		case TIMELINE_DRAW_ORDER:
+		case TIMELINE_EVENT:
+			indexed = false;
+			break;
+		default:
+			if (type < TIMELINE_PHYSICS_INERTIA) {
+				limit = skeletonData->_bones.size();
+				break;
+			}
+			limit = skeletonData->_physicsConstraints.size();
+			// Physics timelines use -1 for all constraints.
+			if (index == NONE) indexed = false;
+	}
+	if (indexed && (index < 0 || (size_t) index >= limit)) return NULL;
+
+	Timeline *timeline = NULL;
+	int bezierCount = 0, curvesCount = 0;
+	const unsigned char *curves = NULL;
+	if (type <= TIMELINE_DEFORM && type != TIMELINE_ATTACHMENT && type != TIMELINE_INHERIT && type != TIMELINE_PHYSICS_RESET) {
+		bezierCount = input.readCount(sizeof(float) * 18);
+		curves = input.readArray(sizeof(float), curvesCount);
+		if (input.failed) return NULL;
+	}
+
+	switch (type) {
+		case TIMELINE_ATTACHMENT:
+			timeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, index);
+			break;
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_RGBA, RGBATimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_RGB, RGBTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_RGBA2, RGBA2Timeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_RGB2, RGB2Timeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_ALPHA, AlphaTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_ROTATE, RotateTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_TRANSLATE, TranslateTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_TRANSLATEX, TranslateXTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_TRANSLATEY, TranslateYTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SCALE, ScaleTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SCALEX, ScaleXTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SCALEY, ScaleYTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SHEAR, ShearTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SHEARX, ShearXTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_SHEARY, ShearYTimeline)
+		case TIMELINE_INHERIT:
+			timeline = new (__FILE__, __LINE__) InheritTimeline(frameCount, index);
+			break;
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_IK, IkConstraintTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_TRANSFORM, TransformConstraintTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PATH_POSITION, PathConstraintPositionTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PATH_SPACING, PathConstraintSpacingTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PATH_MIX, PathConstraintMixTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_INERTIA, PhysicsConstraintInertiaTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_STRENGTH, PhysicsConstraintStrengthTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_DAMPING, PhysicsConstraintDampingTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_MASS, PhysicsConstraintMassTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_WIND, PhysicsConstraintWindTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_GRAVITY, PhysicsConstraintGravityTimeline)
+			SNAPSHOT_CURVE_TIMELINE(TIMELINE_PHYSICS_MIX, PhysicsConstraintMixTimeline)
+		case TIMELINE_PHYSICS_RESET:
+			timeline = new (__FILE__, __LINE__) PhysicsConstraintResetTimeline(frameCount, index);
+			break;
+		case TIMELINE_DEFORM: {
+			Attachment *attachment = input.readReference(attachments);
+			if (!attachment || !attachment->getRTTI().instanceOf(VertexAttachment::rtti)) return NULL;
+			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+			timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, index, vertexAttachment);
+			break;
+		}
+		case TIMELINE_SEQUENCE: {
+			Attachment *attachment = input.readReference(attachments);
+			if (!attachment) return NULL;
+			const RTTI &rtti = attachment->getRTTI();
+			Sequence *sequence = NULL;
+			if (rtti.isExactly(RegionAttachment::rtti)) sequence = static_cast<RegionAttachment *>(attachment)->getSequence();
+			if (rtti.isExactly(MeshAttachment::rtti)) sequence = static_cast<MeshAttachment *>(attachment)->getSequence();
+			if (!sequence) return NULL;
+			timeline = new (__FILE__, __LINE__) SequenceTimeline(frameCount, index, attachment);
+			break;
+		}
+		case TIMELINE_DRAW_ORDER:
+			timeline = new (__FILE__, __LINE__) DrawOrderTimeline(frameCount);
+			break;
+		case TIMELINE_EVENT:
+			timeline = new (__FILE__, __LINE__) EventTimeline(frameCount);
+			break;
+	}
+	if (!timeline) return NULL;
+
+	Vector<float> &timelineFrames = timeline->getFrames();
+	bool valid = timelineFrames.size() == (size_t) framesCount;
+	if (valid) memcpy(timelineFrames.buffer(), frames, framesCount * sizeof(float));
+	if (valid && curves) {
+		Vector<float> &timelineCurves = static_cast<CurveTimeline *>(timeline)->_curves;
+		valid = timelineCurves.size() == (size_t) curvesCount;
+		if (valid && curvesCount > 0) memcpy(timelineCurves.buffer(), curves, curvesCount * sizeof(float));
+	}
+	if (!valid) {
+		delete timeline;
+		return NULL;
+	}
+
+	switch (type) {
+		case TIMELINE_ATTACHMENT: {
+			Vector<String> &names = static_cast<AttachmentTimeline *>(timeline)->getAttachmentNames();
+			for (int i = 0; i < frameCount; i++)
+				names[i] = intern(input.readString());
+			break;
+		}
+		case TIMELINE_DEFORM: {
+			Vector<Vector<float> > &vertices = static_cast<DeformTimeline *>(timeline)->getVertices();
+			for (int i = 0; i < frameCount; i++)
+				input.readArray(vertices[i]);
+			break;
+		}
+		case TIMELINE_DRAW_ORDER: {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			for (int i = 0; i < frameCount; i++)
+				input.readArray(drawOrders[i]);
+			break;
+		}
+		case TIMELINE_EVENT: {
+			EventTimeline *eventTimeline = static_cast<EventTimeline *>(timeline);
+			for (int i = 0; i < frameCount && !input.failed; i++) {
+				EventData *eventData = input.readReference(skeletonData->_events);
+				float time = input.readFloat();
+				if (!eventData) {
+					input.failed = true;
+					break;
+				}
+				Event *event = new (__FILE__, __LINE__) Event(time, *eventData);
+				event->_intValue = input.readInt();
+				event->_floatValue = input.readFloat();
+				event->_stringValue = input.readString();
+				event->_volume = input.readFloat();
+				event->_balance = input.readFloat();
+				eventTimeline->setFrame(i, event);
+			}
+			break;
+		}
+	}
+	if (input.failed) {
+		delete timeline;
+		return NULL;
+	}
+	return timeline;
+}
+
+#undef SNAPSHOT_CURVE_TIMELINE
+#undef SNAPSHOT_CURVE_TIMELINE_CURRENT
+
+Animation *SkeletonSnapshot::readAnimation(Input &input, SkeletonData *skeletonData, Vector<Attachment *> &attachments, String &error) {
+	const char *name = input.readName();
+	float duration = input.readFloat();
+	int timelinesCount = input.readCount(16);
+	if (input.failed) return NULL;
+	Vector<Timeline *> timelines;
+	timelines.ensureCapacity(timelinesCount);
+	for (int i = 0; i < timelinesCount; i++) {
+		Timeline *timeline = readTimeline(input, skeletonData, attachments);
+		if (!timeline) {
+			ContainerUtil::cleanUpVectorOfPointers(timelines);
+			error = String("Invalid timeline in animation: ").append(name);
+			return NULL;
+		}
+		timelines.add(timeline);
+	}
+	if (input.failed) {
+		ContainerUtil::cleanUpVectorOfPointers(timelines);
+		return NULL;
+	}
+	return new (__FILE__, __LINE__) Animation(intern(name), timelines, duration);
+}
+
+void SkeletonSnapshot::setError(const char *value1, const char *value2) {
+	char message[256];
+	int length;
+	strcpy(message, value1);
+	length = (int) strlen(value1);
+	if (value2) strncat(message + length, value2, 255 - length);
+	_error = String(message);
+}
+
+String SkeletonSnapshot::intern(const char *chars) {
+	return _internTable ? _internTable->intern(chars) : String(chars, true, false);
+}
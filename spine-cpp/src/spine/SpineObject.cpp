@@ -33,11 +33,11 @@
 using namespace spine;
 
 void *SpineObject::operator new(size_t sz) {
-	return SpineExtension::getInstance()->_calloc(sz, __FILE__, __LINE__);
+	return SpineExtension::calloc<char>(sz, __FILE__, __LINE__);
 }
 
 void *SpineObject::operator new(size_t sz, const char *file, int line) {
-	return SpineExtension::getInstance()->_calloc(sz, file, line);
+	return SpineExtension::calloc<char>(sz, file, line);
 }
 
 void *SpineObject::operator new(size_t sz, void *ptr) {
@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/TaskExecutor.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+TaskExecutor::~TaskExecutor() {
+}
+
+struct ThreadPool::State : public SpineObject {
+	std::vector<std::thread> threads;
+	std::mutex batchMutex;
+	std::mutex mutex;
+	std::condition_variable workAvailable;
+	std::condition_variable workDone;
+	TaskFunction function;
+	void *context;
+	int count;
+	int next;
+	int finished;
+	int active;
+	unsigned int generation;
+	bool quit;
+
+	// The pool whose tasks the calling thread is running, if any.
+	static thread_local State *current;
+
+	State() : function(NULL), context(NULL), count(0), next(0), finished(0), active(0), generation(0), quit(false) {
+	}
+
+	// Runs tasks of the batch until none are left, returning how many were run. A worker that picked up a batch just as
+	// it completed must not claim tasks of the next batch, so the batch is identified by its generation.
+	int work(TaskFunction function, void *context, unsigned int batch) {
+		State *previous = current;
+		current = this;
+		int done = 0;
+		for (;;) {
+			int index;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (generation != batch || next >= count) break;
+				index = next++;
+			}
+			function(context, index);
+			done++;
+		}
+		current = previous;
+		return done;
+	}
+
+	void workerLoop() {
+		unsigned int seen = 0;
+		for (;;) {
+			TaskFunction batchFunction;
+			void *batchContext;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				while (!quit && generation == seen)
+					workAvailable.wait(lock);
+				if (quit) return;
+				seen = generation;
+				batchFunction = function;
+				batchContext = context;
+				active++;
+			}
+			int done = work(batchFunction, batchContext, seen);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				finished += done;
+				active--;
+				if (finished == count && active == 0) workDone.notify_all();
+			}
+		}
+	}
+};
+
+thread_local ThreadPool::State *ThreadPool::State::current = NULL;
+
+ThreadPool::ThreadPool(int threadCount) : _state(new (__FILE__, __LINE__) State()) {
+	if (threadCount <= 0) threadCount = (int) std::thread::hardware_concurrency() - 1;
+	for (int i = 0; i < threadCount; i++)
+		_state->threads.push_back(std::thread(&State::workerLoop, _state));
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->quit = true;
+	}
+	_state->workAvailable.notify_all();
+	for (size_t i = 0; i < _state->threads.size(); i++)
+		_state->threads[i].join();
+	delete _state;
+}
+
+void ThreadPool::run(TaskFunction function, void *context, int count) {
+	if (count <= 0) return;
+	// A task of this pool running a batch on it would wait for the batch it is part of, so it runs the batch itself.
+	if (_state->threads.empty() || count == 1 || State::current == _state) {
+		for (int i = 0; i < count; i++)
+			function(context, i);
+		return;
+	}
+
+	std::lock_guard<std::mutex> batch(_state->batchMutex);
+	unsigned int generation;
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->function = function;
+		_state->context = context;
+		_state->count = count;
+		_state->next = 0;
+		_state->finished = 0;
+		generation = ++_state->generation;
+	}
+	_state->workAvailable.notify_all();
+
+	int done = _state->work(function, context, generation);
+	std::unique_lock<std::mutex> lock(_state->mutex);
+	_state->finished += done;
+	while (_state->finished != count || _state->active != 0)
+		_state->workDone.wait(lock);
+}
+
+int ThreadPool::getThreadCount() {
+	return (int) _state->threads.size();
+}
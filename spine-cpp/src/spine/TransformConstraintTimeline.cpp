@@ -53,12 +53,6 @@ TransformConstraintTimeline::TransformConstraintTimeline(size_t frameCount, size
 	setPropertyIds(ids, 1);
 }
 
-TransformConstraintTimeline::TransformConstraintTimeline(size_t frameCount, int transformConstraintIndex)
-: CurveTimeline(frameCount, TransformConstraintTimeline::ENTRIES), _constraintIndex(transformConstraintIndex) {
-	PropertyId ids[] = {((PropertyId) Property_TransformConstraint << 32) | transformConstraintIndex};
-	setPropertyIds(ids, 1);
-}
-
 void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
 										float alpha, MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
@@ -69,19 +63,6 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 	TransformConstraint &constraint = *constraintP;
 	if (!constraint.isActive()) return;
 
-    if(BEZIER_SIZE != 18) {
-        static const int ENTRIES_L = 5;
-        static const int PREV_TIME = -5;
-        static const int PREV_ROTATE = -4;
-        static const int PREV_TRANSLATE = -3;
-        static const int PREV_SCALE = -2;
-        static const int PREV_SHEAR = -1;
-        static const int TRANSLATE = 2;
-        static const int SCALE = 3;
-        static const int SHEAR = 4;
-    } else {
-
-    }
 	TransformConstraintData &data = constraint._data;
 	if (time < _frames[0]) {
 		switch (blend) {
@@ -108,81 +89,44 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 
 	float rotate, x, y, scaleX, scaleY, shearY;
 
-    if(BEZIER_SIZE != 18) {
-        static const int PREV_TIME = -7;
-        static const int PREV_ROTATE = -6;
-        static const int PREV_TRANSLATE = -5;
-        static const int PREV_SCALE = -3;
-        static const int PREV_SHEAR = -1;
-        static const int TRANSLATE = 2;
-        static const int SCALE = 4;
-        static const int SHEAR = 6;
-
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            size_t i = _frames.size();
-            rotate = _frames[i + PREV_ROTATE];
-            x = y = _frames[i + PREV_TRANSLATE];
-            scaleX = scaleY = _frames[i + PREV_SCALE];
-            shearY = _frames[i + PREV_SHEAR];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            rotate = _frames[frame + PREV_ROTATE];
-            x = y = _frames[frame + PREV_TRANSLATE];
-            scaleX = scaleY = _frames[frame + PREV_SCALE];
-            shearY = _frames[frame + PREV_SHEAR];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            rotate += (_frames[frame + ROTATE] - rotate) * percent;
-            x += (_frames[frame + TRANSLATE] - x) * percent;
-            y += (_frames[frame + TRANSLATE] - y) * percent;
-            scaleX += (_frames[frame + SCALE] - scaleX) * percent;
-            scaleY += (_frames[frame + SCALE] - scaleY) * percent;
-            shearY += (_frames[frame + SHEAR] - shearY) * percent;
-        }
-    }else {
-        int i = Animation::search(_frames, time, TransformConstraintTimeline::ENTRIES);
-        int curveType = (int) _curves[i / TransformConstraintTimeline::ENTRIES];
-        switch (curveType) {
-            case TransformConstraintTimeline::LINEAR: {
-                float before = _frames[i];
-                rotate = _frames[i + ROTATE];
-                x = _frames[i + X];
-                y = _frames[i + Y];
-                scaleX = _frames[i + SCALEX];
-                scaleY = _frames[i + SCALEY];
-                shearY = _frames[i + SHEARY];
-                float t = (time - before) / (_frames[i + ENTRIES] - before);
-                rotate += (_frames[i + ENTRIES + ROTATE] - rotate) * t;
-                x += (_frames[i + ENTRIES + X] - x) * t;
-                y += (_frames[i + ENTRIES + Y] - y) * t;
-                scaleX += (_frames[i + ENTRIES + SCALEX] - scaleX) * t;
-                scaleY += (_frames[i + ENTRIES + SCALEY] - scaleY) * t;
-                shearY += (_frames[i + ENTRIES + SHEARY] - shearY) * t;
-                break;
-            }
-            case TransformConstraintTimeline::STEPPED: {
-                rotate = _frames[i + ROTATE];
-                x = _frames[i + X];
-                y = _frames[i + Y];
-                scaleX = _frames[i + SCALEX];
-                scaleY = _frames[i + SCALEY];
-                shearY = _frames[i + SHEARY];
-                break;
-            }
-            default: {
-                rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
-                x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
-                y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
-                scaleX = getBezierValue(time, i, SCALEX, curveType + BEZIER_SIZE * 3 - BEZIER);
-                scaleY = getBezierValue(time, i, SCALEY, curveType + BEZIER_SIZE * 4 - BEZIER);
-                shearY = getBezierValue(time, i, SHEARY, curveType + BEZIER_SIZE * 5 - BEZIER);
-            }
-        }
-    }
+	int i = Animation::search(_frames, time, TransformConstraintTimeline::ENTRIES);
+	int curveType = (int) _curves[i / TransformConstraintTimeline::ENTRIES];
+	switch (curveType) {
+		case TransformConstraintTimeline::LINEAR: {
+			float before = _frames[i];
+			rotate = _frames[i + ROTATE];
+			x = _frames[i + X];
+			y = _frames[i + Y];
+			scaleX = _frames[i + SCALEX];
+			scaleY = _frames[i + SCALEY];
+			shearY = _frames[i + SHEARY];
+			float t = (time - before) / (_frames[i + ENTRIES] - before);
+			rotate += (_frames[i + ENTRIES + ROTATE] - rotate) * t;
+			x += (_frames[i + ENTRIES + X] - x) * t;
+			y += (_frames[i + ENTRIES + Y] - y) * t;
+			scaleX += (_frames[i + ENTRIES + SCALEX] - scaleX) * t;
+			scaleY += (_frames[i + ENTRIES + SCALEY] - scaleY) * t;
+			shearY += (_frames[i + ENTRIES + SHEARY] - shearY) * t;
+			break;
+		}
+		case TransformConstraintTimeline::STEPPED: {
+			rotate = _frames[i + ROTATE];
+			x = _frames[i + X];
+			y = _frames[i + Y];
+			scaleX = _frames[i + SCALEX];
+			scaleY = _frames[i + SCALEY];
+			shearY = _frames[i + SHEARY];
+			break;
+		}
+		default: {
+			rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
+			x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
+			y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
+			scaleX = getBezierValue(time, i, SCALEX, curveType + BEZIER_SIZE * 3 - BEZIER);
+			scaleY = getBezierValue(time, i, SCALEY, curveType + BEZIER_SIZE * 4 - BEZIER);
+			shearY = getBezierValue(time, i, SHEARY, curveType + BEZIER_SIZE * 5 - BEZIER);
+		}
+	}
 
 	if (blend == MixBlend_Setup) {
 		constraint._mixRotate = data._mixRotate + (rotate - data._mixRotate) * alpha;
@@ -49,13 +49,6 @@ TranslateTimeline::TranslateTimeline(size_t frameCount, size_t bezierCount, int
 	setPropertyIds(ids, 2);
 }
 
-TranslateTimeline::TranslateTimeline(size_t frameCount, int boneIndex)
-    : CurveTimeline2(frameCount), _boneIndex(boneIndex) {
-	PropertyId ids[] = {((PropertyId) Property_X << 32) | boneIndex,
-						((PropertyId) Property_Y << 32) | boneIndex};
-	setPropertyIds(ids, 2);
-}
-
 TranslateTimeline::~TranslateTimeline() {
 }
 
@@ -65,123 +58,63 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
 
-	if(BEZIER_SIZE != 18) {
-        static const int ENTRIES = 3;
-        static const int PREV_TIME = -3;
-        static const int PREV_X = -2;
-        static const int PREV_Y = -1;
-        static const int X = 1;
-        static const int Y = 2;
-
-        Bone *boneP = skeleton._bones[_boneIndex];
-        Bone &bone = *boneP;
-        if (!bone._active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone._x = bone._data._x;
-                    bone._y = bone._data._y;
-                    return;
-                case MixBlend_First:
-                    bone._x += (bone._data._x - bone._x) * alpha;
-                    bone._y += (bone._data._y - bone._y) * alpha;
-                default: {}
-            }
-            return;
-        }
-
-        float x, y;
-        if (time >= _frames[_frames.size() - ENTRIES]) {
-            // Time is after last frame.
-            x = _frames[_frames.size() + PREV_X];
-            y = _frames[_frames.size() + PREV_Y];
-        } else {
-            // Interpolate between the previous frame and the current frame.
-            int frame = Animation::binarySearch(_frames, time, ENTRIES);
-            x = _frames[frame + PREV_X];
-            y = _frames[frame + PREV_Y];
-            float frameTime = _frames[frame];
-            float percent = getCurvePercent(frame / ENTRIES - 1,
-                                            1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-            x += (_frames[frame + X] - x) * percent;
-            y += (_frames[frame + Y] - y) * percent;
-        }
-
-        switch (blend) {
-            case MixBlend_Setup:
-                bone._x = bone._data._x + x * alpha;
-                bone._y = bone._data._y + y * alpha;
-                break;
-            case MixBlend_First:
-            case MixBlend_Replace:
-                bone._x += (bone._data._x + x - bone._x) * alpha;
-                bone._y += (bone._data._y + y - bone._y) * alpha;
-                break;
-            case MixBlend_Add:
-                bone._x += x * alpha;
-                bone._y += y * alpha;
-        }
-    } else {
-        Bone *bone = skeleton._bones[_boneIndex];
-        if (!bone->_active) return;
-
-        if (time < _frames[0]) {
-            switch (blend) {
-                case MixBlend_Setup:
-                    bone->_x = bone->_data._x;
-                    bone->_y = bone->_data._y;
-                    return;
-                case MixBlend_First:
-                    bone->_x += (bone->_data._x - bone->_x) * alpha;
-                    bone->_y += (bone->_data._y - bone->_y) * alpha;
-                default: {
-                }
-            }
-            return;
-        }
-
-        float x = 0, y = 0;
-        int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-        int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-        switch (curveType) {
-            case CurveTimeline::LINEAR: {
-                float before = _frames[i];
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-                x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-                y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-                break;
-            }
-            case CurveTimeline::STEPPED: {
-                x = _frames[i + CurveTimeline2::VALUE1];
-                y = _frames[i + CurveTimeline2::VALUE2];
-                break;
-            }
-            default: {
-                x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
-                y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-                                   curveType + BEZIER_SIZE - CurveTimeline::BEZIER);
-            }
-        }
-
-        switch (blend) {
-            case MixBlend_Setup:
-                bone->_x = bone->_data._x + x * alpha;
-                bone->_y = bone->_data._y + y * alpha;
-                break;
-            case MixBlend_First:
-            case MixBlend_Replace:
-                bone->_x += (bone->_data._x + x - bone->_x) * alpha;
-                bone->_y += (bone->_data._y + y - bone->_y) * alpha;
-                break;
-            case MixBlend_Add:
-                bone->_x += x * alpha;
-                bone->_y += y * alpha;
-        }
-    }
+	Bone *bone = skeleton._bones[_boneIndex];
+	if (!bone->_active) return;
+
+	if (time < _frames[0]) {
+		switch (blend) {
+			case MixBlend_Setup:
+				bone->_x = bone->_data._x;
+				bone->_y = bone->_data._y;
+				return;
+			case MixBlend_First:
+				bone->_x += (bone->_data._x - bone->_x) * alpha;
+				bone->_y += (bone->_data._y - bone->_y) * alpha;
+			default: {
+			}
+		}
+		return;
+	}
+
+	float x = 0, y = 0;
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
+			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			x = _frames[i + CurveTimeline2::VALUE1];
+			y = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
+			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
+							   curveType + BEZIER_SIZE - CurveTimeline::BEZIER);
+		}
+	}
+
+	switch (blend) {
+		case MixBlend_Setup:
+			bone->_x = bone->_data._x + x * alpha;
+			bone->_y = bone->_data._y + y * alpha;
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
+			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			break;
+		case MixBlend_Add:
+			bone->_x += x * alpha;
+			bone->_y += y * alpha;
+	}
 }
 
 RTTI_IMPL(TranslateXTimeline, CurveTimeline1)
@@ -34,8 +34,7 @@
 using namespace spine;
 
 Triangulator::~Triangulator() {
-	ContainerUtil::cleanUpVectorOfPointers(_convexPolygons);
-	ContainerUtil::cleanUpVectorOfPointers(_convexPolygonsIndices);
+	// The polygons, including those in _convexPolygons, are destroyed with the pools.
 }
 
 Vector<int> &Triangulator::triangulate(Vector<float> &vertices) {
@@ -34,6 +34,8 @@
 #include <spine/Bone.h>
 #include <spine/Skeleton.h>
 
+#include <atomic>
+
 using namespace spine;
 
 RTTI_IMPL(VertexAttachment, Attachment)
@@ -155,8 +157,9 @@ void VertexAttachment::setTimelineAttachment(Attachment *attachment) {
 }
 
 int VertexAttachment::getNextID() {
-	static int nextID = 0;
-	return nextID++;
+	// Attachments may be created by several threads loading skeletons at once.
+	static std::atomic<int> nextID(0);
+	return nextID.fetch_add(1, std::memory_order_relaxed);
 }
 
 void VertexAttachment::copyTo(VertexAttachment *other) {
@@ -45,6 +45,17 @@
 
 using namespace spine;
 
+// 3.8 interpolates rotation between keys the shortest way around, 4.x interpolates key values as they are.
+static void unwrapRotations(RotateTimeline *timeline) {
+    Vector<float> &frames = timeline->getFrames();
+    float previous = frames[1];
+    for (size_t i = 3, n = frames.size(); i < n; i += 2) {
+        float rotation = frames[i], r = rotation - previous;
+        frames[i] = frames[i - 2] + r - (16384 - (int) (16384.499999999996 - r / 360)) * 360;
+        previous = rotation;
+    }
+}
+
 SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skeletonData) {
     bool nonessential;
 
@@ -62,17 +73,15 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
         skeletonData->_audioPath.own(readString(input));
     }
 
-    int numStrings = readVarint(input, true);
-    for (int i = 0; i < numStrings; i++)
-        skeletonData->_strings.add(readString(input));
+    readStrings(input, skeletonData);
 
     /* Bones. */
     int numBones = readVarint(input, true);
     skeletonData->_bones.setSize(numBones, 0);
     for (int i = 0; i < numBones; ++i) {
-        const char *name = readString(input);
+        String name = readName(input);
         BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-        BoneData *data = new(__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+        BoneData *data = new(__FILE__, __LINE__) BoneData(i, name, parent);
         data->_rotation = readFloat(input);
         data->_x = readFloat(input) * _scale;
         data->_y = readFloat(input) * _scale;
@@ -91,9 +100,9 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     int slotsCount = readVarint(input, true);
     skeletonData->_slots.setSize(slotsCount, 0);
     for (int i = 0; i < slotsCount; ++i) {
-        const char *slotName = readString(input);
+        String slotName = readName(input);
         BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
-        SlotData *slotData = new(__FILE__, __LINE__) SlotData(i, String(slotName, true), *boneData);
+        SlotData *slotData = new(__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
         readColor(input, slotData->getColor());
         unsigned char r = readByte(input);
@@ -104,7 +113,8 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
             slotData->getDarkColor().set(r / 255.0f, g / 255.0f, b / 255.0f, 1);
             slotData->setHasDarkColor(true);
         }
-        slotData->_attachmentName = readStringRef(input, skeletonData);
+        String attachmentName = readNameRef(input, skeletonData);
+        slotData->_attachmentName = attachmentName;
         slotData->_blendMode = static_cast<BlendMode>(readVarint(input, true));
         skeletonData->_slots[i] = slotData;
     }
@@ -113,8 +123,8 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     int ikConstraintsCount = readVarint(input, true);
     skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
     for (int i = 0; i < ikConstraintsCount; ++i) {
-        const char *name = readString(input);
-        IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(String(name, true));
+        String name = readName(input);
+        IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -135,8 +145,8 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     int transformConstraintsCount = readVarint(input, true);
     skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
     for (int i = 0; i < transformConstraintsCount; ++i) {
-        const char *name = readString(input);
-        TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(String(name, true));
+        String name = readName(input);
+        TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -163,8 +173,8 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     int pathConstraintsCount = readVarint(input, true);
     skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
     for (int i = 0; i < pathConstraintsCount; ++i) {
-        const char *name = readString(input);
-        PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(String(name, true));
+        String name = readName(input);
+        PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -236,8 +246,7 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     int eventsCount = readVarint(input, true);
     skeletonData->_events.setSize(eventsCount, 0);
     for (int i = 0; i < eventsCount; ++i) {
-        const char *name = readStringRef(input, skeletonData);
-        EventData *eventData = new(__FILE__, __LINE__) EventData(String(name));
+        EventData *eventData = new(__FILE__, __LINE__) EventData(readNameRef(input, skeletonData));
         eventData->_intValue = readVarint(input, false);
         eventData->_floatValue = readFloat(input);
         eventData->_stringValue.own(readString(input));
@@ -250,17 +259,10 @@ SkeletonData *BinaryLoader38::readSkeleton(DataInput *input, SkeletonData *skele
     }
 
     /* Animations. */
-    int animationsCount = readVarint(input, true);
-    skeletonData->_animations.setSize(animationsCount, 0);
-    for (int i = 0; i < animationsCount; ++i) {
-        String name(readString(input), true);
-        Animation *animation = readAnimation(name, input, skeletonData);
-        if (!animation) {
-            delete input;
-            delete skeletonData;
-            return NULL;
-        }
-        skeletonData->_animations[i] = animation;
+    if (!readAnimations(input, skeletonData)) {
+        delete input;
+        delete skeletonData;
+        return NULL;
     }
 
     delete input;
@@ -275,7 +277,7 @@ Skin *BinaryLoader38::readSkin(DataInput *input, bool defaultSkin, SkeletonData
         if (slotCount == 0) return NULL;
         skin = new(__FILE__, __LINE__) Skin("default");
     } else {
-        skin = new(__FILE__, __LINE__) Skin(readStringRef(input, skeletonData));
+        skin = new(__FILE__, __LINE__) Skin(readNameRef(input, skeletonData));
         for (int i = 0, n = readVarint(input, true); i < n; i++)
             skin->getBones().add(skeletonData->_bones[readVarint(input, true)]);
 
@@ -293,10 +295,10 @@ Skin *BinaryLoader38::readSkin(DataInput *input, bool defaultSkin, SkeletonData
     for (int i = 0; i < slotCount; ++i) {
         int slotIndex = readVarint(input, true);
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
-            String name(readStringRef(input, skeletonData));
+            String name = readNameRef(input, skeletonData);
             Attachment *attachment = readAttachment(input, skin, slotIndex, name, skeletonData, nonessential);
             if (attachment)
-                skin->setAttachment(slotIndex, String(name), attachment);
+                skin->setAttachment(slotIndex, name, attachment);
             else {
                 delete skin;
                 return nullptr;
@@ -309,15 +311,15 @@ Skin *BinaryLoader38::readSkin(DataInput *input, bool defaultSkin, SkeletonData
 Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
                                            SkeletonData *skeletonData, bool nonessential
 ) {
-    String name(readStringRef(input, skeletonData));
+    String name = readNameRef(input, skeletonData);
     if (name.isEmpty()) name = attachmentName;
 
     AttachmentType type = static_cast<AttachmentType>(readByte(input));
     switch (type) {
         case AttachmentType_Region: {
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
-            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, String(name), String(path), NULL);
+            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, name, path, NULL);
             if (!region) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -338,7 +340,7 @@ Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slo
         }
         case AttachmentType_Boundingbox: {
             int vertexCount = readVarint(input, true);
-            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, String(name));
+            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, name);
             if (!box) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -354,10 +356,10 @@ Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slo
         case AttachmentType_Mesh: {
             int vertexCount;
             MeshAttachment *mesh;
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
 
-            mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), NULL);
+            mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, NULL);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -383,31 +385,31 @@ Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slo
             return mesh;
         }
         case AttachmentType_Linkedmesh: {
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
 
-            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), NULL);
+            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, NULL);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
             }
             mesh->_path = path;
             readColor(input, mesh->getColor());
-            String skinName(readStringRef(input, skeletonData));
-            String parent(readStringRef(input, skeletonData));
+            String skinName = readNameRef(input, skeletonData);
+            String parent = readNameRef(input, skeletonData);
             bool inheritDeform = readBoolean(input);
             if (nonessential) {
                 mesh->_width = readFloat(input) * _scale;
                 mesh->_height = readFloat(input) * _scale;
             }
             mesh->_sequence = NULL;
-            LinkedMesh *linkedMesh = new(__FILE__, __LINE__) LinkedMesh(mesh, String(skinName), slotIndex,
-                                                                        String(parent), inheritDeform);
+            LinkedMesh *linkedMesh = new(__FILE__, __LINE__) LinkedMesh(mesh, skinName, slotIndex,
+                                                                        parent, inheritDeform);
             _linkedMeshes.add(linkedMesh);
             return mesh;
         }
         case AttachmentType_Path: {
-            PathAttachment* path = _attachmentLoader->newPathAttachment(*skin, String(name));
+            PathAttachment* path = _attachmentLoader->newPathAttachment(*skin, name);
             if (!path) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -418,9 +420,7 @@ Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slo
             readVertices(input, static_cast<VertexAttachment *>(path), vertexCount);
             int lengthsLength = vertexCount / 3;
             path->_lengths.setSize(lengthsLength, 0);
-            for (int i = 0; i < lengthsLength; ++i) {
-                path->_lengths[i] = readFloat(input) * _scale;
-            }
+            readFloats(input, path->_lengths.buffer(), lengthsLength, _scale);
             if (nonessential) {
                 /* Skip color. */
                 readInt(input);
@@ -429,7 +429,7 @@ Attachment *BinaryLoader38::readAttachment(DataInput *input, Skin *skin, int slo
             return path;
         }
         case AttachmentType_Point: {
-            PointAttachment* point = _attachmentLoader->newPointAttachment(*skin, String(name));
+            PointAttachment* point = _attachmentLoader->newPointAttachment(*skin, name);
             if (!point) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -509,14 +509,15 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                     AttachmentTimeline *timeline = new(__FILE__, __LINE__) AttachmentTimeline(frameCount, slotIndex);
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                         float time = readFloat(input);
-                        String attachmentName(readStringRef(input, skeletonData));
+                        String attachmentName = readNameRef(input, skeletonData);
                         timeline->setFrame(frameIndex, time, attachmentName);
                     }
                     timelines.add(timeline);
                     break;
                 }
                 case SLOT_RGBA: {//SLOT_COLOR
-                    RGBATimeline *timeline = new(__FILE__, __LINE__) RGBATimeline(frameCount, slotIndex);
+                    RGBATimeline *timeline = new(__FILE__, __LINE__) RGBATimeline(frameCount, 0, slotIndex);
+                    Vector<float> curves;
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                         float time = readFloat(input);
                         int color = readInt(input);
@@ -525,13 +526,15 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                         float b = ((color & 0x0000ff00) >> 8) / 255.0f;
                         float a = ((color & 0x000000ff)) / 255.0f;
                         timeline->setFrame(frameIndex, time, r, g, b, a);
-                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                     }
+                    timeline->setNormalizedCurves(curves, 4);
                     timelines.add(timeline);
                     break;
                 }
                 case SLOT_RGB: {//SLOT_TWO_COLOR
-                    RGBA2Timeline *timeline = new(__FILE__, __LINE__) RGBA2Timeline(frameCount, slotIndex);
+                    RGBA2Timeline *timeline = new(__FILE__, __LINE__) RGBA2Timeline(frameCount, 0, slotIndex);
+                    Vector<float> curves;
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                         float time = readFloat(input);
                         int color = readInt(input);
@@ -545,8 +548,9 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                         float b2 = ((color2 & 0x000000ff)) / 255.0f;
 
                         timeline->setFrame(frameIndex, time, r, g, b, a, r2, g2, b2);
-                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                     }
+                    timeline->setNormalizedCurves(curves, 7);
                     timelines.add(timeline);
                     break;
                 }
@@ -567,13 +571,16 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
             int frameCount = readVarint(input, true);
             switch (timelineType) {
                 case BONE_ROTATE: {
-                    RotateTimeline *timeline = new(__FILE__, __LINE__) RotateTimeline(frameCount, boneIndex);
+                    RotateTimeline *timeline = new(__FILE__, __LINE__) RotateTimeline(frameCount, 0, boneIndex);
+                    Vector<float> curves;
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                         float time = readFloat(input);
                         float degrees = readFloat(input);
                         timeline->setFrame(frameIndex, time, degrees);
-                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                     }
+                    unwrapRotations(timeline);
+                    timeline->setNormalizedCurves(curves, 1);
                     timelines.add(timeline);
                     break;
                 }
@@ -581,13 +588,14 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                 case 2/*BONE_SCALE*/:
                 case 3/*BONE_SHEAR*/: {
                     CurveTimeline2 *timeline;
+                    Vector<float> curves;
                     float timelineScale = 1;
                     if (timelineType == 2/*BONE_SCALE*/) {
-                        timeline = new(__FILE__, __LINE__) ScaleTimeline(frameCount, boneIndex);
+                        timeline = new(__FILE__, __LINE__) ScaleTimeline(frameCount, 0, boneIndex);
                     } else if (timelineType == 3/*BONE_SHEAR*/) {
-                        timeline = new(__FILE__, __LINE__) ShearTimeline(frameCount, boneIndex);
+                        timeline = new(__FILE__, __LINE__) ShearTimeline(frameCount, 0, boneIndex);
                     } else {
-                        timeline = new(__FILE__, __LINE__) TranslateTimeline(frameCount, boneIndex);
+                        timeline = new(__FILE__, __LINE__) TranslateTimeline(frameCount, 0, boneIndex);
                         timelineScale = scale;
                     }
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
@@ -596,9 +604,10 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                         float y = readFloat(input) * timelineScale;
                         timeline->setFrame(frameIndex, time, x, y);
                         if (frameIndex < frameCount - 1) {
-                            readCurve(input, frameIndex, timeline);
+                            readCurve(input, frameIndex, timeline, curves);
                         }
                     }
+                    timeline->setNormalizedCurves(curves, 2);
                     timelines.add(timeline);
                     break;
                 }
@@ -615,7 +624,8 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
     for (int i = 0, n = readVarint(input, true); i < n; ++i) {
         int index = readVarint(input, true);
         int frameCount = readVarint(input, true);
-        IkConstraintTimeline *timeline = new(__FILE__, __LINE__) IkConstraintTimeline(frameCount, index);
+        IkConstraintTimeline *timeline = new(__FILE__, __LINE__) IkConstraintTimeline(frameCount, 0, index);
+        Vector<float> curves;
         for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
             float time = readFloat(input);
             float mix = readFloat(input);
@@ -624,8 +634,9 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
             bool compress = readBoolean(input);
             bool stretch = readBoolean(input);
             timeline->setFrame(frameIndex, time, mix, softness, bendDirection, compress, stretch);
-            if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+            if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
         }
+        timeline->setNormalizedCurves(curves, 2);
         timelines.add(timeline);
     }
 
@@ -633,7 +644,8 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
     for (int i = 0, n = readVarint(input, true); i < n; ++i) {
         int index = readVarint(input, true);
         int frameCount = readVarint(input, true);
-        TransformConstraintTimeline *timeline = new(__FILE__, __LINE__) TransformConstraintTimeline(frameCount, index);
+        TransformConstraintTimeline *timeline = new(__FILE__, __LINE__) TransformConstraintTimeline(frameCount, 0, index);
+        Vector<float> curves;
         for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
             float time = readFloat(input);
             float rotateMix = readFloat(input);
@@ -641,8 +653,9 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
             float scaleMix = readFloat(input);
             float shearMix = readFloat(input);
             timeline->setFrame(frameIndex, time, rotateMix, translateMix, translateMix, scaleMix, scaleMix, shearMix);
-            if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+            if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
         }
+        timeline->setNormalizedCurves(curves, 6);
         timelines.add(timeline);
     }
 
@@ -657,13 +670,14 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                 case PATH_POSITION:
                 case PATH_SPACING: {
                     CurveTimeline1 *timeline;
+                    Vector<float> curves;
                     float timelineScale = 1;
                     if (timelineType == PATH_SPACING) {
-                        timeline = new(__FILE__, __LINE__) PathConstraintSpacingTimeline(frameCount, index);
+                        timeline = new(__FILE__, __LINE__) PathConstraintSpacingTimeline(frameCount, 0, index);
 
                         if (data->_spacingMode == SpacingMode_Length || data->_spacingMode == SpacingMode_Fixed) timelineScale = scale;
                     } else {
-                        timeline = new(__FILE__, __LINE__) PathConstraintPositionTimeline(frameCount, index);
+                        timeline = new(__FILE__, __LINE__) PathConstraintPositionTimeline(frameCount, 0, index);
 
                         if (data->_positionMode == PositionMode_Fixed) timelineScale = scale;
                     }
@@ -671,21 +685,24 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                         float time = readFloat(input);
                         float value = readFloat(input) * timelineScale;
                         timeline->setFrame(frameIndex, time, value);
-                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                     }
+                    timeline->setNormalizedCurves(curves, 1);
                     timelines.add(timeline);
                     break;
                 }
                 case PATH_MIX: {
-                    PathConstraintMixTimeline *timeline = new(__FILE__, __LINE__) PathConstraintMixTimeline(frameCount, index);
+                    PathConstraintMixTimeline *timeline = new(__FILE__, __LINE__) PathConstraintMixTimeline(frameCount, 0, index);
+                    Vector<float> curves;
 
                     for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                         float time = readFloat(input);
                         float rotateMix = readFloat(input);
                         float translateMix = readFloat(input);
                         timeline->setFrame(frameIndex, time, rotateMix, translateMix, translateMix);
-                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                        if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                     }
+                    timeline->setNormalizedCurves(curves, 3);
                     timelines.add(timeline);
                     break;
                 }
@@ -699,12 +716,12 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
             int slotIndex = readVarint(input, true);
             for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
-                const char *attachmentName = readStringRef(input, skeletonData);
-                Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName));
+                String attachmentName = readNameRef(input, skeletonData);
+                Attachment *baseAttachment = skin->getAttachment(slotIndex, attachmentName);
 
                 if (!baseAttachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
-                    setError("Attachment not found: ", attachmentName);
+                    setError("Attachment not found: ", attachmentName.buffer());
                     return NULL;
                 }
 
@@ -716,7 +733,8 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
 
                 size_t frameCount = (size_t)readVarint(input, true);
 
-                DeformTimeline *timeline = new(__FILE__, __LINE__) DeformTimeline(frameCount, slotIndex, attachment);
+                DeformTimeline *timeline = new(__FILE__, __LINE__) DeformTimeline(frameCount, 0, slotIndex, attachment);
+                Vector<float> curves;
 
                 for (size_t frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
                     float time = readFloat(input);
@@ -733,14 +751,7 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                     } else {
                         deform.setSize(deformLength, 0);
                         size_t start = (size_t)readVarint(input, true);
-                        end += start;
-                        if (scale == 1) {
-                            for (size_t v = start; v < end; ++v)
-                                deform[v] = readFloat(input);
-                        } else {
-                            for (size_t v = start; v < end; ++v)
-                                deform[v] = readFloat(input) * scale;
-                        }
+                        readFloats(input, deform.buffer() + start, (int) end, scale);
 
                         if (!weighted) {
                             for (size_t v = 0, vn = deform.size(); v < vn; ++v)
@@ -749,9 +760,10 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
                     }
 
                     timeline->setFrame(frameIndex, time, deform);
-                    if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline);
+                    if (frameIndex < frameCount - 1) readCurve(input, frameIndex, timeline, curves);
                 }
 
+                timeline->setNormalizedCurves(curves, 0);
                 timelines.add(timeline);
             }
         }
@@ -811,9 +823,8 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
             event->_intValue = readVarint(input, false);
             event->_floatValue = readFloat(input);
             bool freeString = readBoolean(input);
-            const char *event_stringValue = freeString ? readString(input) : eventData->_stringValue.buffer();
-            event->_stringValue = String(event_stringValue);
-            if (freeString) SpineExtension::free(event_stringValue, __FILE__, __LINE__);
+            const char *event_stringValue = freeString ? readScratchString(input) : eventData->_stringValue.buffer();
+            event->_stringValue = event_stringValue;
 
             if (!eventData->_audioPath.isEmpty()) {
                 event->_volume = readFloat(input);
@@ -829,21 +840,119 @@ Animation *BinaryLoader38::readAnimation(const String &name, DataInput *input, S
     for (int i = 0, n = timelines.size(); i < n; i++) {
         duration = MathUtil::max(duration, (timelines[i])->getDuration());
     }
-    return new(__FILE__, __LINE__) Animation(String(name), timelines, duration);
+    return new(__FILE__, __LINE__) Animation(name, timelines, duration);
+}
+void BinaryLoader38::skipAnimation(DataInput *input, SkeletonData *skeletonData) {
+    // Slot timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+                input->cursor += 4;
+                if (timelineType == SLOT_ATTACHMENT) {
+                    readVarint(input, true);
+                    continue;
+                }
+                input->cursor += timelineType == SLOT_RGB ? 8 : 4;
+                if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+            }
+        }
+    }
+    // Bone timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+                input->cursor += timelineType == BONE_ROTATE ? 8 : 12;
+                if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+            }
+        }
+    }
+    // IK timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+            input->cursor += 15;
+            if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+        }
+    }
+    // Transform constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+            input->cursor += 20;
+            if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+        }
+    }
+    // Path constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            int timelineType = readSByte(input);
+            int frameCount = readVarint(input, true);
+            for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+                input->cursor += timelineType == PATH_MIX ? 12 : 8;
+                if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+            }
+        }
+    }
+    // Deform timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
+                readVarint(input, true);
+                int frameCount = readVarint(input, true);
+                for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex) {
+                    input->cursor += 4;
+                    int end = readVarint(input, true);
+                    if (end != 0) {
+                        readVarint(input, true);
+                        input->cursor += end * 4;
+                    }
+                    if (frameIndex < frameCount - 1 && readByte(input) == CURVE_BEZIER) input->cursor += 16;
+                }
+            }
+        }
+    }
+    // Draw order timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            readVarint(input, true);
+        }
+    }
+    // Event timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        EventData *eventData = skeletonData->_events[readVarint(input, true)];
+        readVarint(input, false);
+        input->cursor += 4;
+        if (readBoolean(input)) skipString(input);
+        if (!eventData->_audioPath.isEmpty()) input->cursor += 8;
+    }
 }
 
-void BinaryLoader38::readCurve(DataInput *input, int frameIndex, CurveTimeline *timeline) {
+void BinaryLoader38::readCurve(DataInput *input, int frameIndex, CurveTimeline *timeline, Vector<float> &curves) {
     switch (readByte(input)) {
         case CURVE_STEPPED: {
             timeline->setStepped(frameIndex);
             break;
         }
         case CURVE_BEZIER: {
-            float cx1 = readFloat(input);
-            float cy1 = readFloat(input);
-            float cx2 = readFloat(input);
-            float cy2 = readFloat(input);
-            timeline->setCurve(frameIndex, cx1, cy1, cx2, cy2);
+            curves.add((float) frameIndex);
+            curves.add(readFloat(input));
+            curves.add(readFloat(input));
+            curves.add(readFloat(input));
+            curves.add(readFloat(input));
             break;
         }
     }
@@ -62,17 +62,15 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
         skeletonData->_audioPath.own(readString(input));
     }
 
-    int numStrings = readVarint(input, true);
-    for (int i = 0; i < numStrings; i++)
-        skeletonData->_strings.add(readString(input));
+    readStrings(input, skeletonData);
 
     /* Bones. */
     int numBones = readVarint(input, true);
     skeletonData->_bones.setSize(numBones, 0);
     for (int i = 0; i < numBones; ++i) {
-        const char *name = readString(input);
+        String name = readName(input);
         BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-        BoneData *data = new (__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+        BoneData *data = new (__FILE__, __LINE__) BoneData(i, name, parent);
         data->_rotation = readFloat(input);
         data->_x = readFloat(input) * _scale;
         data->_y = readFloat(input) * _scale;
@@ -93,9 +91,9 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     int slotsCount = readVarint(input, true);
     skeletonData->_slots.setSize(slotsCount, 0);
     for (int i = 0; i < slotsCount; ++i) {
-        const char *slotName = readString(input);
+        String slotName = readName(input);
         BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
-        SlotData *slotData = new (__FILE__, __LINE__) SlotData(i, String(slotName, true), *boneData);
+        SlotData *slotData = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
         readColor(input, slotData->getColor());
         unsigned char a = readByte(input);
@@ -106,7 +104,8 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
             slotData->getDarkColor().set(r / 255.0f, g / 255.0f, b / 255.0f, 1);
             slotData->setHasDarkColor(true);
         }
-        slotData->_attachmentName = readStringRef(input, skeletonData);
+        String attachmentName = readNameRef(input, skeletonData);
+        slotData->_attachmentName = attachmentName;
         slotData->_blendMode = static_cast<BlendMode>(readVarint(input, true));
         skeletonData->_slots[i] = slotData;
     }
@@ -115,8 +114,8 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     int ikConstraintsCount = readVarint(input, true);
     skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
     for (int i = 0; i < ikConstraintsCount; ++i) {
-        const char *name = readString(input);
-        IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(String(name, true));
+        String name = readName(input);
+        IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -137,8 +136,8 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     int transformConstraintsCount = readVarint(input, true);
     skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
     for (int i = 0; i < transformConstraintsCount; ++i) {
-        const char *name = readString(input);
-        TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(String(name, true));
+        String name = readName(input);
+        TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -167,8 +166,8 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     int pathConstraintsCount = readVarint(input, true);
     skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
     for (int i = 0; i < pathConstraintsCount; ++i) {
-        const char *name = readString(input);
-        PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(String(name, true));
+        String name = readName(input);
+        PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(name);
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -240,8 +239,7 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     int eventsCount = readVarint(input, true);
     skeletonData->_events.setSize(eventsCount, 0);
     for (int i = 0; i < eventsCount; ++i) {
-        const char *name = readStringRef(input, skeletonData);
-        EventData *eventData = new (__FILE__, __LINE__) EventData(String(name));
+        EventData *eventData = new (__FILE__, __LINE__) EventData(readNameRef(input, skeletonData));
         eventData->_intValue = readVarint(input, false);
         eventData->_floatValue = readFloat(input);
         eventData->_stringValue.own(readString(input));
@@ -254,17 +252,10 @@ SkeletonData *BinaryLoader40::readSkeleton(DataInput *input, SkeletonData *skele
     }
 
     /* Animations. */
-    int animationsCount = readVarint(input, true);
-    skeletonData->_animations.setSize(animationsCount, 0);
-    for (int i = 0; i < animationsCount; ++i) {
-        String name(readString(input), true);
-        Animation *animation = readAnimation(name, input, skeletonData);
-        if (!animation) {
-            delete input;
-            delete skeletonData;
-            return NULL;
-        }
-        skeletonData->_animations[i] = animation;
+    if (!readAnimations(input, skeletonData)) {
+        delete input;
+        delete skeletonData;
+        return NULL;
     }
 
     delete input;
@@ -279,7 +270,7 @@ Skin *BinaryLoader40::readSkin(DataInput *input, bool defaultSkin, SkeletonData
         if (slotCount == 0) return NULL;
         skin = new (__FILE__, __LINE__) Skin("default");
     } else {
-        skin = new (__FILE__, __LINE__) Skin(readStringRef(input, skeletonData));
+        skin = new (__FILE__, __LINE__) Skin(readNameRef(input, skeletonData));
         for (int i = 0, n = readVarint(input, true); i < n; i++)
             skin->getBones().add(skeletonData->_bones[readVarint(input, true)]);
 
@@ -297,10 +288,10 @@ Skin *BinaryLoader40::readSkin(DataInput *input, bool defaultSkin, SkeletonData
     for (int i = 0; i < slotCount; ++i) {
         int slotIndex = readVarint(input, true);
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
-            String name(readStringRef(input, skeletonData));
+            String name = readNameRef(input, skeletonData);
             Attachment *attachment = readAttachment(input, skin, slotIndex, name, skeletonData, nonessential);
             if (attachment)
-                skin->setAttachment(slotIndex, String(name), attachment);
+                skin->setAttachment(slotIndex, name, attachment);
             else {
                 delete skin;
                 return nullptr;
@@ -312,15 +303,15 @@ Skin *BinaryLoader40::readSkin(DataInput *input, bool defaultSkin, SkeletonData
 
 Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
                                            SkeletonData *skeletonData, bool nonessential) {
-    String name(readStringRef(input, skeletonData));
+    String name = readNameRef(input, skeletonData);
     if (name.isEmpty()) name = attachmentName;
 
     AttachmentType type = static_cast<AttachmentType>(readByte(input));
     switch (type) {
         case AttachmentType_Region: {
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
-            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, String(name), String(path), NULL);
+            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, name, path, NULL);
             if (!region) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -341,7 +332,7 @@ Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slo
         }
         case AttachmentType_Boundingbox: {
             int vertexCount = readVarint(input, true);
-            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, String(name));
+            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, name);
             if (!box) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -356,10 +347,10 @@ Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slo
         case AttachmentType_Mesh: {
             int vertexCount;
             MeshAttachment *mesh;
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
 
-            mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), NULL);
+            mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, NULL);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -385,31 +376,31 @@ Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slo
             return mesh;
         }
         case AttachmentType_Linkedmesh: {
-            String path(readStringRef(input, skeletonData));
+            String path = readNameRef(input, skeletonData);
             if (path.isEmpty()) path = name;
 
-            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), NULL);
+            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, NULL);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
             }
             mesh->_path = path;
             readColor(input, mesh->getColor());
-            String skinName(readStringRef(input, skeletonData));
-            String parent(readStringRef(input, skeletonData));
+            String skinName = readNameRef(input, skeletonData);
+            String parent = readNameRef(input, skeletonData);
             bool inheritDeform = readBoolean(input);
             if (nonessential) {
                 mesh->_width = readFloat(input) * _scale;
                 mesh->_height = readFloat(input) * _scale;
             }
             mesh->_sequence = NULL;
-            LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, String(skinName), slotIndex,
-                                                                         String(parent), inheritDeform);
+            LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, skinName, slotIndex,
+                                                                         parent, inheritDeform);
             _linkedMeshes.add(linkedMesh);
             return mesh;
         }
         case AttachmentType_Path: {
-            PathAttachment *path = _attachmentLoader->newPathAttachment(*skin, String(name));
+            PathAttachment *path = _attachmentLoader->newPathAttachment(*skin, name);
             if (!path) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -420,9 +411,7 @@ Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slo
             readVertices(input, static_cast<VertexAttachment *>(path), vertexCount);
             int lengthsLength = vertexCount / 3;
             path->_lengths.setSize(lengthsLength, 0);
-            for (int i = 0; i < lengthsLength; ++i) {
-                path->_lengths[i] = readFloat(input) * _scale;
-            }
+            readFloats(input, path->_lengths.buffer(), lengthsLength, _scale);
             if (nonessential) {
                 readColor(input, path->getColor());
             }
@@ -430,7 +419,7 @@ Attachment *BinaryLoader40::readAttachment(DataInput *input, Skin *skin, int slo
             return path;
         }
         case AttachmentType_Point: {
-            PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, String(name));
+            PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, name);
             if (!point) {
                 setError("Error reading attachment: ", name.buffer());
                 return nullptr;
@@ -565,7 +554,7 @@ Animation *BinaryLoader40::readAnimation(const String &name, DataInput *input, S
                     AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, slotIndex);
                     for (int frame = 0; frame < frameCount; ++frame) {
                         float time = readFloat(input);
-                        String attachmentName(readStringRef(input, skeletonData));
+                        String attachmentName = readNameRef(input, skeletonData);
                         timeline->setFrame(frame, time, attachmentName);
                     }
                     timelines.add(timeline);
@@ -982,12 +971,12 @@ Animation *BinaryLoader40::readAnimation(const String &name, DataInput *input, S
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
             int slotIndex = readVarint(input, true);
             for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
-                const char *attachmentName = readStringRef(input, skeletonData);
-                Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName));
+                String attachmentName = readNameRef(input, skeletonData);
+                Attachment *baseAttachment = skin->getAttachment(slotIndex, attachmentName);
 
                 if (!baseAttachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
-                    setError("Attachment not found: ", attachmentName);
+                    setError("Attachment not found: ", attachmentName.buffer());
                     return NULL;
                 }
 
@@ -1018,14 +1007,7 @@ Animation *BinaryLoader40::readAnimation(const String &name, DataInput *input, S
                     } else {
                         deform.setSize(deformLength, 0);
                         size_t start = (size_t) readVarint(input, true);
-                        end += start;
-                        if (scale == 1) {
-                            for (size_t v = start; v < end; ++v)
-                                deform[v] = readFloat(input);
-                        } else {
-                            for (size_t v = start; v < end; ++v)
-                                deform[v] = readFloat(input) * scale;
-                        }
+                        readFloats(input, deform.buffer() + start, (int) end, scale);
 
                         if (!weighted) {
                             for (size_t v = 0, vn = deform.size(); v < vn; ++v)
@@ -1105,9 +1087,8 @@ Animation *BinaryLoader40::readAnimation(const String &name, DataInput *input, S
             event->_intValue = readVarint(input, false);
             event->_floatValue = readFloat(input);
             bool freeString = readBoolean(input);
-            const char *event_stringValue = freeString ? readString(input) : eventData->_stringValue.buffer();
-            event->_stringValue = String(event_stringValue);
-            if (freeString) SpineExtension::free(event_stringValue, __FILE__, __LINE__);
+            const char *event_stringValue = freeString ? readScratchString(input) : eventData->_stringValue.buffer();
+            event->_stringValue = event_stringValue;
 
             if (!eventData->_audioPath.isEmpty()) {
                 event->_volume = readFloat(input);
@@ -1122,5 +1103,130 @@ Animation *BinaryLoader40::readAnimation(const String &name, DataInput *input, S
     for (int i = 0, n = timelines.size(); i < n; i++) {
         duration = MathUtil::max(duration, (timelines[i])->getDuration());
     }
-    return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
+    return new (__FILE__, __LINE__) Animation(name, timelines, duration);
+}
+void BinaryLoader40::skipAnimation(DataInput *input, SkeletonData *skeletonData) {
+    readVarint(input, true);
+    // Slot timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            if (timelineType == SLOT_ATTACHMENT) {
+                for (int frame = 0; frame < frameCount; ++frame) {
+                    input->cursor += 4;
+                    readVarint(input, true);
+                }
+                continue;
+            }
+            readVarint(input, true);
+            switch (timelineType) {
+                case SLOT_RGBA:
+                    skipCurveTimeline(input, frameCount, 4, 4);
+                    break;
+                case SLOT_RGB:
+                    skipCurveTimeline(input, frameCount, 3, 3);
+                    break;
+                case SLOT_RGBA2:
+                    skipCurveTimeline(input, frameCount, 7, 7);
+                    break;
+                case SLOT_RGB2:
+                    skipCurveTimeline(input, frameCount, 6, 6);
+                    break;
+                case SLOT_ALPHA:
+                    skipCurveTimeline(input, frameCount, 1, 1);
+            }
+        }
+    }
+    // Bone timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            readVarint(input, true);
+            if (timelineType == BONE_TRANSLATE || timelineType == BONE_SCALE || timelineType == BONE_SHEAR)
+                skipCurveTimeline(input, frameCount, 8, 2);
+            else
+                skipCurveTimeline(input, frameCount, 4, 1);
+        }
+    }
+    // IK timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        readVarint(input, true);
+        input->cursor += 12;
+        for (int frame = 0;; frame++) {
+            input->cursor += 3;
+            if (frame == frameCount - 1) break;
+            input->cursor += 12;
+            if (readSByte(input) == CURVE_BEZIER) input->cursor += 2 * 16;
+        }
+    }
+    // Transform constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        readVarint(input, true);
+        skipCurveTimeline(input, frameCount, 24, 6);
+    }
+    // Path constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+            int type = readSByte(input);
+            int frameCount = readVarint(input, true);
+            readVarint(input, true);
+            switch (type) {
+                case PATH_POSITION:
+                case PATH_SPACING:
+                    skipCurveTimeline(input, frameCount, 4, 1);
+                    break;
+                case PATH_MIX:
+                    skipCurveTimeline(input, frameCount, 12, 3);
+            }
+        }
+    }
+    // Deform timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
+                readVarint(input, true);
+                int frameCount = readVarint(input, true);
+                readVarint(input, true);
+                input->cursor += 4;
+                for (int frame = 0;; ++frame) {
+                    int end = readVarint(input, true);
+                    if (end != 0) {
+                        readVarint(input, true);
+                        input->cursor += end * 4;
+                    }
+                    if (frame == frameCount - 1) break;
+                    input->cursor += 4;
+                    if (readSByte(input) == CURVE_BEZIER) input->cursor += 16;
+                }
+            }
+        }
+    }
+    // Draw order timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            readVarint(input, true);
+        }
+    }
+    // Event timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        EventData *eventData = skeletonData->_events[readVarint(input, true)];
+        readVarint(input, false);
+        input->cursor += 4;
+        if (readBoolean(input)) skipString(input);
+        if (!eventData->_audioPath.isEmpty()) input->cursor += 8;
+    }
 }
\ No newline at end of file
@@ -38,6 +38,7 @@
 #include <spine/PointAttachment.h>
 #include <spine/RegionAttachment.h>
 #include <spine/RotateTimeline.h>
+#include <spine/RuntimeContext.h>
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
 #include <spine/SlotData.h>
@@ -45,6 +46,7 @@
 #include <spine/TransformConstraintTimeline.h>
 #include <spine/TranslateTimeline.h>
 #include <spine/SequenceTimeline.h>
+#include <spine/TaskExecutor.h>
 #include <spine/Version.h>
 
 using namespace spine;
@@ -66,17 +68,15 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
         skeletonData->_audioPath.own(readString(input));
     }
 
-    int numStrings = readVarint(input, true);
-    for (int i = 0; i < numStrings; i++)
-        skeletonData->_strings.add(readString(input));
+    readStrings(input, skeletonData);
 
     /* Bones. */
     int numBones = readVarint(input, true);
     skeletonData->_bones.setSize(numBones, 0);
     for (int i = 0; i < numBones; ++i) {
-        const char *name = readString(input);
+        String name = readName(input);
         BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-        BoneData *data = new (__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+        BoneData *data = new (__FILE__, __LINE__) BoneData(i, name, parent);
         data->_rotation = readFloat(input);
         data->_x = readFloat(input) * _scale;
         data->_y = readFloat(input) * _scale;
@@ -99,7 +99,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int slotsCount = readVarint(input, true);
     skeletonData->_slots.setSize(slotsCount, 0);
     for (int i = 0; i < slotsCount; ++i) {
-        String slotName = String(readString(input), true);
+        String slotName = readName(input);
         BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
         SlotData *slotData = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
@@ -112,7 +112,8 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
             slotData->getDarkColor().set(r / 255.0f, g / 255.0f, b / 255.0f, 1);
             slotData->setHasDarkColor(true);
         }
-        slotData->_attachmentName = readStringRef(input, skeletonData);
+        String attachmentName = readNameRef(input, skeletonData);
+        slotData->_attachmentName = attachmentName;
         slotData->_blendMode = static_cast<BlendMode>(readVarint(input, true));
         if (nonessential) {
             slotData->_visible = readBoolean(input);
@@ -124,8 +125,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int ikConstraintsCount = readVarint(input, true);
     skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
     for (int i = 0; i < ikConstraintsCount; ++i) {
-        const char *name = readString(input);
-        IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(String(name, true));
+        IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(readName(input));
         data->setOrder(readVarint(input, true));
         int bonesCount = readVarint(input, true);
         data->_bones.setSize(bonesCount, 0);
@@ -148,8 +148,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int transformConstraintsCount = readVarint(input, true);
     skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
     for (int i = 0; i < transformConstraintsCount; ++i) {
-        const char *name = readString(input);
-        TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(String(name, true));
+        TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(readName(input));
         data->setOrder(readVarint(input, true));
         int bonesCount = readVarint(input, true);
         data->_bones.setSize(bonesCount, 0);
@@ -181,8 +180,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int pathConstraintsCount = readVarint(input, true);
     skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
     for (int i = 0; i < pathConstraintsCount; ++i) {
-        const char *name = readString(input);
-        PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(String(name, true));
+        PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(readName(input));
         data->setOrder(readVarint(input, true));
         data->setSkinRequired(readBoolean(input));
         int bonesCount = readVarint(input, true);
@@ -210,8 +208,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int physicsConstraintsCount = readVarint(input, true);
     skeletonData->_physicsConstraints.setSize(physicsConstraintsCount, 0);
     for (int i = 0; i < physicsConstraintsCount; i++) {
-        const char *name = readString(input);
-        PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(String(name, true));
+        PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(readName(input));
         data->_order = readVarint(input, true);
         data->_bone = skeletonData->_bones[readVarint(input, true)];
         int flags = readByte(input);
@@ -241,31 +238,13 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
         skeletonData->_physicsConstraints[i] = data;
     }
 
-    /* Default skin. */
-    Skin *defaultSkin = readSkin(input, true, skeletonData, nonessential);
-    if (defaultSkin) {
-        skeletonData->_defaultSkin = defaultSkin;
-        skeletonData->_skins.add(defaultSkin);
-    }
-
-    if (!this->getError().isEmpty()) {
+    /* Skins. */
+    if (!readSkins(input, skeletonData, nonessential)) {
         delete input;
         delete skeletonData;
         return NULL;
     }
 
-    /* Skins. */
-    for (size_t i = 0, n = (size_t) readVarint(input, true); i < n; ++i) {
-        Skin *skin = readSkin(input, false, skeletonData, nonessential);
-        if (skin)
-            skeletonData->_skins.add(skin);
-        else {
-            delete input;
-            delete skeletonData;
-            return NULL;
-        }
-    }
-
     /* Linked meshes. */
     for (int i = 0, n = (int) _linkedMeshes.size(); i < n; ++i) {
         LinkedMesh *linkedMesh = _linkedMeshes[i];
@@ -290,8 +269,7 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     int eventsCount = readVarint(input, true);
     skeletonData->_events.setSize(eventsCount, 0);
     for (int i = 0; i < eventsCount; ++i) {
-        const char *name = readString(input);
-        EventData *eventData = new (__FILE__, __LINE__) EventData(String(name, true));
+        EventData *eventData = new (__FILE__, __LINE__) EventData(readName(input));
         eventData->_intValue = readVarint(input, false);
         eventData->_floatValue = readFloat(input);
         eventData->_stringValue.own(readString(input));
@@ -304,23 +282,110 @@ SkeletonData *BinaryLoader42::readSkeleton(DataInput *input, SkeletonData *skele
     }
 
     /* Animations. */
-    int animationsCount = readVarint(input, true);
-    skeletonData->_animations.setSize(animationsCount, 0);
-    for (int i = 0; i < animationsCount; ++i) {
-        String name(readString(input), true);
-        Animation *animation = readAnimation(name, input, skeletonData);
-        if (!animation) {
-            delete input;
-            delete skeletonData;
-            return NULL;
-        }
-        skeletonData->_animations[i] = animation;
+    if (!readAnimations(input, skeletonData)) {
+        delete input;
+        delete skeletonData;
+        return NULL;
     }
 
     delete input;
     return skeletonData;
 }
 
+bool BinaryLoader42::readSkins(DataInput *input, SkeletonData *skeletonData, bool nonessential) {
+    if (_executor) return readSkinsParallel(input, skeletonData, nonessential);
+
+    /* Default skin. */
+    Skin *defaultSkin = readSkin(input, true, skeletonData, nonessential);
+    if (defaultSkin) {
+        skeletonData->_defaultSkin = defaultSkin;
+        skeletonData->_skins.add(defaultSkin);
+    }
+
+    if (!this->getError().isEmpty()) return false;
+
+    for (size_t i = 0, n = (size_t) readVarint(input, true); i < n; ++i) {
+        Skin *skin = readSkin(input, false, skeletonData, nonessential);
+        if (!skin) return false;
+        skeletonData->_skins.add(skin);
+    }
+    return true;
+}
+
+struct BinaryLoader42::SkinTasks {
+    AttachmentLoader *attachmentLoader;
+    SkeletonData *skeletonData;
+    bool nonessential;
+    float scale;
+    InternTable *internTable;
+    RuntimeContext *context;
+    const unsigned char *end;
+    Vector<const unsigned char *> starts;
+    Vector<Skin *> skins;
+    Vector<Vector<LinkedMesh *> > linkedMeshes;
+    Vector<String> errors;
+};
+
+void BinaryLoader42::readSkinTask(void *context, int index) {
+    SkinTasks *tasks = (SkinTasks *) context;
+    RuntimeContextScope contextScope(tasks->context);
+    float scale = tasks->scale;
+    BinaryLoader42 loader(tasks->attachmentLoader, tasks->linkedMeshes[index], scale, tasks->errors[index]);
+    loader.setInternTable(tasks->internTable);
+    DataInput input;
+    input.cursor = tasks->starts[index];
+    input.end = tasks->end;
+    tasks->skins[index] = loader.readSkin(&input, index == 0, tasks->skeletonData, tasks->nonessential);
+}
+
+bool BinaryLoader42::readSkinsParallel(DataInput *input, SkeletonData *skeletonData, bool nonessential) {
+    // Index the skins first, the default skin being at index 0, then decode them concurrently.
+    SkinTasks tasks;
+    tasks.attachmentLoader = _attachmentLoader;
+    tasks.skeletonData = skeletonData;
+    tasks.nonessential = nonessential;
+    tasks.scale = _scale;
+    tasks.internTable = _internTable;
+    tasks.context = RuntimeContext::getCurrent();
+    tasks.end = input->end;
+    tasks.starts.add(input->cursor);
+    skipSkin(input, true, nonessential);
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        tasks.starts.add(input->cursor);
+        skipSkin(input, false, nonessential);
+    }
+    if (input->cursor > input->end) {
+        setError("Error reading skins.", "");
+        return false;
+    }
+    int count = (int) tasks.starts.size();
+    tasks.skins.setSize(count, NULL);
+    tasks.linkedMeshes.setSize(count, Vector<LinkedMesh *>());
+    tasks.errors.setSize(count, String());
+
+    _executor->run(readSkinTask, &tasks, count);
+
+    // Linked meshes are collected in skin order so they are resolved exactly as when loading serially.
+    bool success = true;
+    for (int i = 0; i < count; ++i) {
+        _linkedMeshes.addAll(tasks.linkedMeshes[i]);
+        Skin *skin = tasks.skins[i];
+        if (!success) {
+            delete skin;
+            continue;
+        }
+        if (!skin) {
+            if (i == 0 && tasks.errors[i].isEmpty()) continue;
+            _error = tasks.errors[i];
+            success = false;
+            continue;
+        }
+        if (i == 0) skeletonData->_defaultSkin = skin;
+        skeletonData->_skins.add(skin);
+    }
+    return success;
+}
+
 Skin *BinaryLoader42::readSkin(DataInput *input, bool defaultSkin, SkeletonData *skeletonData, bool nonessential) {
     Skin *skin;
     int slotCount = 0;
@@ -329,7 +394,7 @@ Skin *BinaryLoader42::readSkin(DataInput *input, bool defaultSkin, SkeletonData
         if (slotCount == 0) return NULL;
         skin = new (__FILE__, __LINE__) Skin("default");
     } else {
-        skin = new (__FILE__, __LINE__) Skin(String(readString(input), true));
+        skin = new (__FILE__, __LINE__) Skin(readName(input));
 
         if (nonessential) readColor(input, skin->getColor());
 
@@ -368,10 +433,10 @@ Skin *BinaryLoader42::readSkin(DataInput *input, bool defaultSkin, SkeletonData
     for (int i = 0; i < slotCount; ++i) {
         int slotIndex = readVarint(input, true);
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
-            String name(readStringRef(input, skeletonData));
+            String name = readNameRef(input, skeletonData);
             Attachment *attachment = readAttachment(input, skin, slotIndex, name, skeletonData, nonessential);
             if (attachment)
-                skin->setAttachment(slotIndex, String(name), attachment);
+                skin->setAttachment(slotIndex, name, attachment);
             else {
                 delete skin;
                 return NULL;
@@ -381,6 +446,111 @@ Skin *BinaryLoader42::readSkin(DataInput *input, bool defaultSkin, SkeletonData
     return skin;
 }
 
+void BinaryLoader42::skipSkin(DataInput *input, bool defaultSkin, bool nonessential) {
+    if (!defaultSkin) {
+        skipString(input);
+        if (nonessential) input->cursor += 4;
+        for (int list = 0; list < 5; list++) {
+            for (int i = 0, n = readVarint(input, true); i < n; i++)
+                readVarint(input, true);
+        }
+    }
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            skipAttachment(input, nonessential);
+        }
+    }
+}
+
+void BinaryLoader42::skipAttachment(DataInput *input, bool nonessential) {
+    int flags = readByte(input);
+    if ((flags & 8) != 0) readVarint(input, true);
+    switch (static_cast<AttachmentType>(flags & 0x7)) {
+        case AttachmentType_Region: {
+            if ((flags & 16) != 0) readVarint(input, true);
+            if ((flags & 32) != 0) input->cursor += 4;
+            if ((flags & 64) != 0) {
+                for (int i = 0; i < 4; i++)
+                    readVarint(input, true);
+            }
+            if ((flags & 128) != 0) input->cursor += 4;
+            input->cursor += 24;
+            break;
+        }
+        case AttachmentType_Boundingbox: {
+            skipVertices(input, (flags & 16) != 0);
+            if (nonessential) input->cursor += 4;
+            break;
+        }
+        case AttachmentType_Mesh: {
+            if ((flags & 16) != 0) readVarint(input, true);
+            if ((flags & 32) != 0) input->cursor += 4;
+            if ((flags & 64) != 0) {
+                for (int i = 0; i < 4; i++)
+                    readVarint(input, true);
+            }
+            int hullLength = readVarint(input, true);
+            int verticesLength = skipVertices(input, (flags & 128) != 0);
+            input->cursor += verticesLength * 4;
+            for (int i = 0, n = (verticesLength - hullLength - 2) * 3; i < n; i++)
+                readVarint(input, true);
+            if (nonessential) {
+                for (int i = 0, n = readVarint(input, true); i < n; i++)
+                    readVarint(input, true);
+                input->cursor += 8;
+            }
+            break;
+        }
+        case AttachmentType_Linkedmesh: {
+            if ((flags & 16) != 0) readVarint(input, true);
+            if ((flags & 32) != 0) input->cursor += 4;
+            if ((flags & 64) != 0) {
+                for (int i = 0; i < 4; i++)
+                    readVarint(input, true);
+            }
+            readVarint(input, true);
+            readVarint(input, true);
+            if (nonessential) input->cursor += 8;
+            break;
+        }
+        case AttachmentType_Path: {
+            int verticesLength = skipVertices(input, (flags & 64) != 0);
+            input->cursor += verticesLength / 6 * 4;
+            if (nonessential) input->cursor += 4;
+            break;
+        }
+        case AttachmentType_Point: {
+            input->cursor += 12;
+            if (nonessential) input->cursor += 4;
+            break;
+        }
+        case AttachmentType_Clipping: {
+            readVarint(input, true);
+            skipVertices(input, (flags & 16) != 0);
+            if (nonessential) input->cursor += 4;
+            break;
+        }
+    }
+}
+
+int BinaryLoader42::skipVertices(DataInput *input, bool weighted) {
+    int vertexCount = readVarint(input, true);
+    if (!weighted) {
+        input->cursor += vertexCount * 2 * 4;
+    } else {
+        for (int i = 0; i < vertexCount; ++i) {
+            int boneCount = readVarint(input, true);
+            for (int ii = 0; ii < boneCount; ++ii) {
+                readVarint(input, true);
+                input->cursor += 12;
+            }
+        }
+    }
+    return vertexCount << 1;
+}
+
 Sequence *BinaryLoader42::readSequence(DataInput *input) {
     Sequence *sequence = new (__FILE__, __LINE__) Sequence(readVarint(input, true));
     sequence->_start = readVarint(input, true);
@@ -393,11 +563,11 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
                                            SkeletonData *skeletonData, bool nonessential) {
 
     int flags = readByte(input);
-    String name = (flags & 8) != 0 ? readStringRef(input, skeletonData) : attachmentName;
+    String name = (flags & 8) != 0 ? readNameRef(input, skeletonData) : attachmentName;
     AttachmentType type = static_cast<AttachmentType>(flags & 0x7);
     switch (type) {
         case AttachmentType_Region: {
-            String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+            String path = (flags & 16) != 0 ? readNameRef(input, skeletonData) : name;
             Color color(1, 1, 1, 1);
             if ((flags & 32) != 0) readColor(input, color);
             Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
@@ -408,7 +578,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             float scaleY = readFloat(input);
             float width = readFloat(input) * _scale;
             float height = readFloat(input) * _scale;
-            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, String(name), String(path), sequence);
+            RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, name, path, sequence);
             if (!region) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -428,7 +598,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             return region;
         }
         case AttachmentType_Boundingbox: {
-            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, String(name));
+            BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, name);
             if (!box) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -451,7 +621,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             float height = 0;
             Vector<unsigned short> edges;
 
-            String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+            String path = (flags & 16) != 0 ? readNameRef(input, skeletonData) : name;
             Color color(1, 1, 1, 1);
             if ((flags & 32) != 0) readColor(input, color);
             Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
@@ -466,7 +636,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
                 height = readFloat(input);
             }
 
-            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), sequence);
+            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, sequence);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -490,20 +660,20 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             return mesh;
         }
         case AttachmentType_Linkedmesh: {
-            String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+            String path = (flags & 16) != 0 ? readNameRef(input, skeletonData) : name;
             Color color(1, 1, 1, 1);
             if ((flags & 32) != 0) readColor(input, color);
             Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
             bool inheritTimelines = (flags & 128) != 0;
             int skinIndex = readVarint(input, true);
-            String parent(readStringRef(input, skeletonData));
+            String parent = readNameRef(input, skeletonData);
             float width = 0, height = 0;
             if (nonessential) {
                 width = readFloat(input) * _scale;
                 height = readFloat(input) * _scale;
             }
 
-            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), sequence);
+            MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, sequence);
             if (!mesh) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -517,12 +687,12 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             }
 
             LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, skinIndex, slotIndex,
-                                                                         String(parent), inheritTimelines);
+                                                                         parent, inheritTimelines);
             _linkedMeshes.add(linkedMesh);
             return mesh;
         }
         case AttachmentType_Path: {
-            PathAttachment *path = _attachmentLoader->newPathAttachment(*skin, String(name));
+            PathAttachment *path = _attachmentLoader->newPathAttachment(*skin, name);
             if (!path) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -533,9 +703,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             path->setWorldVerticesLength(verticesLength);
             int lengthsLength = verticesLength / 6;
             path->_lengths.setSize(lengthsLength, 0);
-            for (int i = 0; i < lengthsLength; ++i) {
-                path->_lengths[i] = readFloat(input) * _scale;
-            }
+            readFloats(input, path->_lengths.buffer(), lengthsLength, _scale);
             if (nonessential) {
                 readColor(input, path->getColor());
             }
@@ -543,7 +711,7 @@ Attachment *BinaryLoader42::readAttachment(DataInput *input, Skin *skin, int slo
             return path;
         }
         case AttachmentType_Point: {
-            PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, String(name));
+            PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, name);
             if (!point) {
                 setError("Error reading attachment: ", name.buffer());
                 return NULL;
@@ -683,7 +851,7 @@ Animation *BinaryLoader42::readAnimation(const String &name, DataInput *input, S
                     AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, slotIndex);
                     for (int frame = 0; frame < frameCount; ++frame) {
                         float time = readFloat(input);
-                        String attachmentName(readStringRef(input, skeletonData));
+                        String attachmentName = readNameRef(input, skeletonData);
                         timeline->setFrame(frame, time, attachmentName);
                     }
                     timelines.add(timeline);
@@ -1140,11 +1308,11 @@ Animation *BinaryLoader42::readAnimation(const String &name, DataInput *input, S
         for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
             int slotIndex = readVarint(input, true);
             for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
-                const char *attachmentName = readStringRef(input, skeletonData);
-                Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName));
+                String attachmentName = readNameRef(input, skeletonData);
+                Attachment *baseAttachment = skin->getAttachment(slotIndex, attachmentName);
                 if (!baseAttachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
-                    setError("Attachment not found: ", attachmentName);
+                    setError("Attachment not found: ", attachmentName.buffer());
                     return NULL;
                 }
                 unsigned int timelineType = readByte(input);
@@ -1177,14 +1345,7 @@ Animation *BinaryLoader42::readAnimation(const String &name, DataInput *input, S
                             } else {
                                 deform.setSize(deformLength, 0);
                                 size_t start = (size_t) readVarint(input, true);
-                                end += start;
-                                if (scale == 1) {
-                                    for (size_t v = start; v < end; ++v)
-                                        deform[v] = readFloat(input);
-                                } else {
-                                    for (size_t v = start; v < end; ++v)
-                                        deform[v] = readFloat(input) * scale;
-                                }
+                                readFloats(input, deform.buffer() + start, (int) end, scale);
 
                                 if (!weighted) {
                                     for (size_t v = 0, vn = deform.size(); v < vn; ++v)
@@ -1277,12 +1438,11 @@ Animation *BinaryLoader42::readAnimation(const String &name, DataInput *input, S
 
             event->_intValue = readVarint(input, false);
             event->_floatValue = readFloat(input);
-            const char *event_stringValue = readString(input);
+            const char *event_stringValue = readScratchString(input);
             if (event_stringValue == nullptr) {
                 event->_stringValue = eventData->_stringValue;
             } else {
-                event->_stringValue = String(event_stringValue);
-                SpineExtension::free(event_stringValue, __FILE__, __LINE__);
+                event->_stringValue = event_stringValue;
             }
 
             if (!eventData->_audioPath.isEmpty()) {
@@ -1298,5 +1458,157 @@ Animation *BinaryLoader42::readAnimation(const String &name, DataInput *input, S
     for (int i = 0, n = (int) timelines.size(); i < n; i++) {
         duration = MathUtil::max(duration, (timelines[i])->getDuration());
     }
-    return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
+    return new (__FILE__, __LINE__) Animation(name, timelines, duration);
+}
+void BinaryLoader42::skipAnimation(DataInput *input, SkeletonData *skeletonData) {
+    readVarint(input, true);
+    // Slot timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            if (timelineType == SLOT_ATTACHMENT) {
+                for (int frame = 0; frame < frameCount; ++frame) {
+                    input->cursor += 4;
+                    readVarint(input, true);
+                }
+                continue;
+            }
+            readVarint(input, true);
+            switch (timelineType) {
+                case SLOT_RGBA:
+                    skipCurveTimeline(input, frameCount, 4, 4);
+                    break;
+                case SLOT_RGB:
+                    skipCurveTimeline(input, frameCount, 3, 3);
+                    break;
+                case SLOT_RGBA2:
+                    skipCurveTimeline(input, frameCount, 7, 7);
+                    break;
+                case SLOT_RGB2:
+                    skipCurveTimeline(input, frameCount, 6, 6);
+                    break;
+                case SLOT_ALPHA:
+                    skipCurveTimeline(input, frameCount, 1, 1);
+            }
+        }
+    }
+    // Bone timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            unsigned char timelineType = readByte(input);
+            int frameCount = readVarint(input, true);
+            if (timelineType == BONE_INHERIT) {
+                input->cursor += frameCount * 5;
+                continue;
+            }
+            readVarint(input, true);
+            if (timelineType == BONE_TRANSLATE || timelineType == BONE_SCALE || timelineType == BONE_SHEAR)
+                skipCurveTimeline(input, frameCount, 8, 2);
+            else
+                skipCurveTimeline(input, frameCount, 4, 1);
+        }
+    }
+    // IK timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        readVarint(input, true);
+        for (int frame = 0; frame < frameCount; frame++) {
+            int flags = readByte(input);
+            input->cursor += 4;
+            if ((flags & 1) != 0 && (flags & 2) != 0) input->cursor += 4;
+            if ((flags & 4) != 0) input->cursor += 4;
+            if (frame > 0 && (flags & 64) == 0 && (flags & 128) != 0) input->cursor += 2 * 16;
+        }
+    }
+    // Transform constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        int frameCount = readVarint(input, true);
+        readVarint(input, true);
+        skipCurveTimeline(input, frameCount, 24, 6);
+    }
+    // Path constraint timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+            int type = readByte(input);
+            int frameCount = readVarint(input, true);
+            readVarint(input, true);
+            switch (type) {
+                case PATH_POSITION:
+                case PATH_SPACING:
+                    skipCurveTimeline(input, frameCount, 4, 1);
+                    break;
+                case PATH_MIX:
+                    skipCurveTimeline(input, frameCount, 12, 3);
+            }
+        }
+    }
+    // Physics timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; i++) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+            int type = readByte(input);
+            int frameCount = readVarint(input, true);
+            if (type == PHYSICS_RESET) {
+                input->cursor += frameCount * 4;
+                continue;
+            }
+            readVarint(input, true);
+            skipCurveTimeline(input, frameCount, 4, 1);
+        }
+    }
+    // Attachment timelines.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        readVarint(input, true);
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
+                readVarint(input, true);
+                unsigned int timelineType = readByte(input);
+                int frameCount = readVarint(input, true);
+                switch (timelineType) {
+                    case ATTACHMENT_DEFORM: {
+                        readVarint(input, true);
+                        input->cursor += 4;
+                        for (int frame = 0;; ++frame) {
+                            int end = readVarint(input, true);
+                            if (end != 0) {
+                                readVarint(input, true);
+                                input->cursor += end * 4;
+                            }
+                            if (frame == frameCount - 1) break;
+                            input->cursor += 4;
+                            if (readSByte(input) == CURVE_BEZIER) input->cursor += 16;
+                        }
+                        break;
+                    }
+                    case ATTACHMENT_SEQUENCE:
+                        input->cursor += frameCount * 12;
+                        break;
+                }
+            }
+        }
+    }
+    // Draw order timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+            readVarint(input, true);
+            readVarint(input, true);
+        }
+    }
+    // Event timeline.
+    for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+        input->cursor += 4;
+        EventData *eventData = skeletonData->_events[readVarint(input, true)];
+        readVarint(input, false);
+        input->cursor += 4;
+        skipString(input);
+        if (!eventData->_audioPath.isEmpty()) input->cursor += 8;
+    }
 }
\ No newline at end of file
@@ -45,6 +45,17 @@
 
 using namespace spine;
 
+// 3.8 interpolates rotation between keys the shortest way around, 4.x interpolates key values as they are.
+static void unwrapRotations(RotateTimeline *timeline) {
+    Vector<float> &frames = timeline->getFrames();
+    float previous = frames[1];
+    for (size_t i = 3, n = frames.size(); i < n; i += 2) {
+        float rotation = frames[i], r = rotation - previous;
+        frames[i] = frames[i - 2] + r - (16384 - (int) (16384.499999999996 - r / 360)) * 360;
+        previous = rotation;
+    }
+}
+
 SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData) {
     int i, ii;
     Json *bones, *boneMap, *ik, *transform, *path, *slots, *skins, *animations, *events;
@@ -68,7 +79,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
             }
         }
 
-        data = new(__FILE__, __LINE__) BoneData(bonesCount, Json::getString(boneMap, "name", 0), parent);
+        data = new(__FILE__, __LINE__) BoneData(bonesCount, intern(Json::getString(boneMap, "name", 0)), parent);
 
         data->_length = Json::getFloat(boneMap, "length", 0) * _scale;
         data->_x = Json::getFloat(boneMap, "x", 0) * _scale;
@@ -111,7 +122,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
                 return NULL;
             }
 
-            data = new(__FILE__, __LINE__) SlotData(i, Json::getString(slotMap, "name", 0), *boneData);
+            data = new(__FILE__, __LINE__) SlotData(i, intern(Json::getString(slotMap, "name", 0)), *boneData);
 
             color = Json::getString(slotMap, "color", 0);
             if (color) {
@@ -133,7 +144,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
             }
 
             item = Json::getItem(slotMap, "attachment");
-            if (item) data->setAttachmentName(item->_valueString);
+            if (item) data->setAttachmentName(intern(item->_valueString));
 
             item = Json::getItem(slotMap, "blend");
             if (item) {
@@ -155,7 +166,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
         for (constraintMap = ik->_child, i = 0; constraintMap; constraintMap = constraintMap->_next, ++i) {
             const char *targetName;
 
-            IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(Json::getString(constraintMap, "name", 0));
+            IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -199,7 +210,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
         for (constraintMap = transform->_child, i = 0; constraintMap; constraintMap = constraintMap->_next, ++i) {
             const char *name;
 
-            TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(Json::getString(constraintMap, "name", 0));
+            TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -251,7 +262,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
             const char *name;
             const char *item;
 
-            PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(Json::getString(constraintMap, "name", 0));
+            PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -315,7 +326,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
             Json *attachmentsMap;
             Json *curves;
 
-            Skin *skin = new(__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
+            Skin *skin = new(__FILE__, __LINE__) Skin(intern(Json::getString(skinMap, "name", "")));
 
             Json *item = Json::getItem(skinMap, "bones");
             if (item) {
@@ -380,9 +391,9 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
 
                 for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
                     Attachment *attachment = NULL;
-                    const char *skinAttachmentName = attachmentMap->_name;
-                    const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
-                    const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
+                    String skinAttachmentName = intern(attachmentMap->_name);
+                    String attachmentName = intern(Json::getString(attachmentMap, "name", attachmentMap->_name));
+                    String attachmentPath = intern(Json::getString(attachmentMap, "path", attachmentName.buffer()));
                     const char *color;
                     Json *entry;
 
@@ -490,7 +501,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
                             } else {
                                 bool inheritDeform = Json::getInt(attachmentMap, "deform", 1) ? true : false;
                                 LinkedMesh *linkedMesh = new(__FILE__, __LINE__) LinkedMesh(mesh,
-                                                                                            String(Json::getString(attachmentMap, "skin", 0)), slot->getIndex(), String(entry->_valueString),
+                                                                                            intern(Json::getString(attachmentMap, "skin", 0)), slot->getIndex(), intern(entry->_valueString),
                                                                                             inheritDeform);
                                 _linkedMeshes.add(linkedMesh);
                             }
@@ -590,7 +601,7 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
         skeletonData->_events.ensureCapacity(events->_size);
         skeletonData->_events.setSize(events->_size, 0);
         for (eventMap = events->_child, i = 0; eventMap; eventMap = eventMap->_next, ++i) {
-            EventData *eventData = new(__FILE__, __LINE__) EventData(String(eventMap->_name));
+            EventData *eventData = new(__FILE__, __LINE__) EventData(intern(eventMap->_name));
 
             eventData->_intValue = Json::getInt(eventMap, "int", 0);
             eventData->_floatValue = Json::getFloat(eventMap, "float", 0);
@@ -629,22 +640,23 @@ SkeletonData *JsonLoader38::readSkeleton(Json *root,SkeletonData *skeletonData)
     return skeletonData;
 }
 
-void JsonLoader38::readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex) {
+void JsonLoader38::readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex, Vector<float> &curves) {
     Json *curve = Json::getItem(frame, "curve");
     if (!curve) return;
     if (curve->_type == Json::JSON_STRING && strcmp(curve->_valueString, "stepped") == 0)
         timeline->setStepped(frameIndex);
     else {
-        float c1 = Json::getFloat(frame, "curve", 0);
-        float c2 = Json::getFloat(frame, "c2", 0);
-        float c3 = Json::getFloat(frame, "c3", 1);
-        float c4 = Json::getFloat(frame, "c4", 1);
-        timeline->setCurve(frameIndex, c1, c2, c3, c4);
+        curves.add((float) frameIndex);
+        curves.add(Json::getFloat(frame, "curve", 0));
+        curves.add(Json::getFloat(frame, "c2", 0));
+        curves.add(Json::getFloat(frame, "c3", 1));
+        curves.add(Json::getFloat(frame, "c4", 1));
     }
 }
 
 int JsonLoader38::findSlotIndex(SkeletonData *skeletonData, const String &slotName, Vector<Timeline *> timelines) {
-    int slotIndex = ContainerUtil::findIndexWithName(skeletonData->getSlots(), slotName);
+    SlotData *slotData = skeletonData->findSlot(slotName);
+    int slotIndex = slotData ? slotData->getIndex() : -1;
     if (slotIndex == -1) {
         ContainerUtil::cleanUpVectorOfPointers(timelines);
         setError(NULL, "Slot not found: ", slotName);
@@ -707,34 +719,38 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
 
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     Json *name = Json::getItem(valueMap, "name");
-                    String attachmentName = name->_type == Json::JSON_NULL ? "" : name->_valueString;
+                    String attachmentName = intern(name->_type == Json::JSON_NULL ? "" : name->_valueString);
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), attachmentName);
                 }
                 timelines.add(timeline);
                 timelinesCount++;
 
             } else if (strcmp(timelineMap->_name, "color") == 0) {
-                RGBATimeline *timeline = new(__FILE__, __LINE__) RGBATimeline(timelineMap->_size, slotIndex);
+                RGBATimeline *timeline = new(__FILE__, __LINE__) RGBATimeline(timelineMap->_size, 0, slotIndex);
+                Vector<float> curves;
 
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     const char *s = Json::getString(valueMap, "color", 0);
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), toColor(s, 0), toColor(s, 1),
                                        toColor(s, 2), toColor(s, 3));
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
+                timeline->setNormalizedCurves(curves, 4);
                 timelines.add(timeline);
                 timelinesCount++;
 
             } else if (strcmp(timelineMap->_name, "twoColor") == 0) {
-                RGBA2Timeline *timeline = new(__FILE__, __LINE__) RGBA2Timeline(timelineMap->_size, slotIndex);
+                RGBA2Timeline *timeline = new(__FILE__, __LINE__) RGBA2Timeline(timelineMap->_size, 0, slotIndex);
+                Vector<float> curves;
 
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     const char *s = Json::getString(valueMap, "light", 0);
                     const char *ds = Json::getString(valueMap, "dark", 0);
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), toColor(s, 0), toColor(s, 1),
                                        toColor(s, 2), toColor(s, 3), toColor(ds, 0), toColor(ds, 1), toColor(ds, 2));
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
+                timeline->setNormalizedCurves(curves, 7);
                 timelines.add(timeline);
                 timelinesCount++;
             } else {
@@ -749,7 +765,8 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
     for (boneMap = bones ? bones->_child : 0; boneMap; boneMap = boneMap->_next) {
         Json *timelineMap;
 
-        int boneIndex = ContainerUtil::findIndexWithName(skeletonData->_bones, boneMap->_name);
+        BoneData *timelineBone = skeletonData->findBone(boneMap->_name);
+        int boneIndex = timelineBone ? timelineBone->getIndex() : -1;
         if (boneIndex == -1) {
             ContainerUtil::cleanUpVectorOfPointers(timelines);
             setError(NULL, "Bone not found: ", boneMap->_name);
@@ -758,13 +775,16 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
 
         for (timelineMap = boneMap->_child; timelineMap; timelineMap = timelineMap->_next) {
             if (strcmp(timelineMap->_name, "rotate") == 0) {
-                RotateTimeline *timeline = new(__FILE__, __LINE__) RotateTimeline(timelineMap->_size, boneIndex);
+                RotateTimeline *timeline = new(__FILE__, __LINE__) RotateTimeline(timelineMap->_size, 0, boneIndex);
+                Vector<float> curves;
 
 
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), Json::getFloat(valueMap, "angle", 0));
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
+                unwrapRotations(timeline);
+                timeline->setNormalizedCurves(curves, 1);
                 timelines.add(timeline);
                 timelinesCount++;
             } else {
@@ -775,22 +795,24 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
                     float timelineScale = isTranslate ? _scale : 1;
                     float defaultValue = 0;
                     CurveTimeline2 *timeline = 0;
+                    Vector<float> curves;
                     if (isScale) {
-                        timeline = new(__FILE__, __LINE__) ScaleTimeline(timelineMap->_size, boneIndex);
+                        timeline = new(__FILE__, __LINE__) ScaleTimeline(timelineMap->_size, 0, boneIndex);
                         defaultValue = 1;
                     } else if (isTranslate) {
-                        timeline = new(__FILE__, __LINE__) TranslateTimeline(timelineMap->_size, boneIndex);
+                        timeline = new(__FILE__, __LINE__) TranslateTimeline(timelineMap->_size, 0, boneIndex);
                     } else if (isShear) {
-                        timeline = new(__FILE__, __LINE__) ShearTimeline(timelineMap->_size, boneIndex);
+                        timeline = new(__FILE__, __LINE__) ShearTimeline(timelineMap->_size, 0, boneIndex);
                     }
 
                     for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                         timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0),
                                            Json::getFloat(valueMap, "x", defaultValue) * timelineScale,
                                            Json::getFloat(valueMap, "y", defaultValue) * timelineScale);
-                        readCurve(valueMap, timeline, frameIndex);
+                        readCurve(valueMap, timeline, frameIndex, curves);
                     }
 
+                    timeline->setNormalizedCurves(curves, 2);
                     timelines.add(timeline);
                     timelinesCount++;
                 } else {
@@ -806,14 +828,16 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
     for (constraintMap = ik ? ik->_child : 0; constraintMap; constraintMap = constraintMap->_next) {
         IkConstraintData *constraint = skeletonData->findIkConstraint(constraintMap->_name);
         int constraintIndex = skeletonData->_ikConstraints.indexOf(constraint);
-        IkConstraintTimeline *timeline = new(__FILE__, __LINE__) IkConstraintTimeline(constraintMap->_size, constraintIndex);
+        IkConstraintTimeline *timeline = new(__FILE__, __LINE__) IkConstraintTimeline(constraintMap->_size, 0, constraintIndex);
+        Vector<float> curves;
 
         for (valueMap = constraintMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
             timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), Json::getFloat(valueMap, "mix", 1),
                                Json::getFloat(valueMap, "softness", 0) * _scale, Json::getInt(valueMap, "bendPositive", 1) ? 1 : -1,
                                Json::getInt(valueMap, "compress", 0) ? true : false, Json::getInt(valueMap, "stretch", 0) ? true : false);
-            readCurve(valueMap, timeline, frameIndex);
+            readCurve(valueMap, timeline, frameIndex, curves);
         }
+        timeline->setNormalizedCurves(curves, 2);
         timelines.add(timeline);
         timelinesCount++;
     }
@@ -822,14 +846,16 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
     for (constraintMap = transform ? transform->_child : 0; constraintMap; constraintMap = constraintMap->_next) {
         TransformConstraintData *constraint = skeletonData->findTransformConstraint(constraintMap->_name);
         int constraintIndex = skeletonData->_transformConstraints.indexOf(constraint);
-        TransformConstraintTimeline *timeline = new(__FILE__, __LINE__) TransformConstraintTimeline(constraintMap->_size, constraintIndex);
+        TransformConstraintTimeline *timeline = new(__FILE__, __LINE__) TransformConstraintTimeline(constraintMap->_size, 0, constraintIndex);
+        Vector<float> curves;
 
         for (valueMap = constraintMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
             timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0),
                                Json::getFloat(valueMap, "rotateMix", 1), Json::getFloat(valueMap, "translateMix", 1), Json::getFloat(valueMap, "translateMix", 1),
                                Json::getFloat(valueMap, "scaleMix", 1), Json::getFloat(valueMap, "scaleMix", 1), Json::getFloat(valueMap, "shearMix", 1));
-            readCurve(valueMap, timeline, frameIndex);
+            readCurve(valueMap, timeline, frameIndex, curves);
         }
+        timeline->setNormalizedCurves(curves, 6);
         timelines.add(timeline);
         timelinesCount++;
     }
@@ -852,15 +878,16 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
             const char *timelineName = timelineMap->_name;
             if (strcmp(timelineName, "position") == 0 || strcmp(timelineName, "spacing") == 0) {
                 CurveTimeline1 *timeline;
+                Vector<float> curves;
                 float timelineScale = 1;
                 if (strcmp(timelineName, "spacing") == 0) {
-                    timeline = new(__FILE__, __LINE__) PathConstraintSpacingTimeline(timelineMap->_size, constraintIndex);
+                    timeline = new(__FILE__, __LINE__) PathConstraintSpacingTimeline(timelineMap->_size, 0, constraintIndex);
 
                     if (data->_spacingMode == SpacingMode_Length || data->_spacingMode == SpacingMode_Fixed) {
                         timelineScale = _scale;
                     }
                 } else {
-                    timeline = new(__FILE__, __LINE__) PathConstraintPositionTimeline(timelineMap->_size, constraintIndex);
+                    timeline = new(__FILE__, __LINE__) PathConstraintPositionTimeline(timelineMap->_size, 0, constraintIndex);
 
                     if (data->_positionMode == PositionMode_Fixed) {
                         timelineScale = _scale;
@@ -870,19 +897,22 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0),
                                        Json::getFloat(valueMap, timelineName, 0) * timelineScale);
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
+                timeline->setNormalizedCurves(curves, 1);
                 timelines.add(timeline);
                 timelinesCount++;
             } else if (strcmp(timelineName, "mix") == 0) {
-                PathConstraintMixTimeline *timeline = new(__FILE__, __LINE__) PathConstraintMixTimeline(timelineMap->_size, constraintIndex);
+                PathConstraintMixTimeline *timeline = new(__FILE__, __LINE__) PathConstraintMixTimeline(timelineMap->_size, 0, constraintIndex);
+                Vector<float> curves;
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0),
                                        Json::getFloat(valueMap, "rotateMix", 1),
                                        Json::getFloat(valueMap, "translateMix", 1),
                                        Json::getFloat(valueMap, "translateMix", 1));
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
+                timeline->setNormalizedCurves(curves, 3);
                 timelines.add(timeline);
                 timelinesCount++;
             }
@@ -900,7 +930,7 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
                 DeformTimeline *timeline;
                 int weighted, deformLength;
 
-                Attachment *baseAttachment = skin->getAttachment(slotIndex, timelineMap->_name);
+                Attachment *baseAttachment = skin->getAttachment(slotIndex, intern(timelineMap->_name));
 
                 if (!baseAttachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
@@ -914,7 +944,8 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
                 Vector<float> &verts = attachment->_vertices;
                 deformLength = weighted ? verts.size() / 3 * 2 : verts.size();
 
-                timeline = new(__FILE__, __LINE__) DeformTimeline(timelineMap->_size, slotIndex, attachment);
+                timeline = new(__FILE__, __LINE__) DeformTimeline(timelineMap->_size, 0, slotIndex, attachment);
+                Vector<float> curves;
 
                 for (valueMap = timelineMap->_child, frameIndex = 0; valueMap; valueMap = valueMap->_next, ++frameIndex) {
                     Json *vertices = Json::getItem(valueMap, "vertices");
@@ -946,9 +977,10 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
                         }
                     }
                     timeline->setFrame(frameIndex, Json::getFloat(valueMap, "time", 0), deformed);
-                    readCurve(valueMap, timeline, frameIndex);
+                    readCurve(valueMap, timeline, frameIndex, curves);
                 }
 
+                timeline->setNormalizedCurves(curves, 0);
                 timelines.add(timeline);
                 timelinesCount++;
             }
@@ -1029,7 +1061,7 @@ Animation *JsonLoader38::readAnimation(Json *root, SkeletonData *skeletonData) {
     float duration = 0;
     for (size_t i = 0; i < timelines.size(); i++)
         duration = MathUtil::max(duration, timelines[i]->getDuration());
-    return new(__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
+    return new(__FILE__, __LINE__) Animation(intern(root->_name), timelines, duration);
 }
 
 void JsonLoader38::readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength) {
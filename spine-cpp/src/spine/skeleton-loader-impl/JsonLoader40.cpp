@@ -70,7 +70,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             }
         }
 
-        data = new (__FILE__, __LINE__) BoneData(bonesCount, Json::getString(boneMap, "name", 0), parent);
+        data = new (__FILE__, __LINE__) BoneData(bonesCount, intern(Json::getString(boneMap, "name", 0)), parent);
 
         data->_length = Json::getFloat(boneMap, "length", 0) * _scale;
         data->_x = Json::getFloat(boneMap, "x", 0) * _scale;
@@ -120,7 +120,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
                 return NULL;
             }
 
-            data = new (__FILE__, __LINE__) SlotData(i, Json::getString(slotMap, "name", 0), *boneData);
+            data = new (__FILE__, __LINE__) SlotData(i, intern(Json::getString(slotMap, "name", 0)), *boneData);
 
             color = Json::getString(slotMap, "color", 0);
             if (color) {
@@ -142,7 +142,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             }
 
             item = Json::getItem(slotMap, "attachment");
-            if (item) data->setAttachmentName(item->_valueString);
+            if (item) data->setAttachmentName(intern(item->_valueString));
 
             item = Json::getItem(slotMap, "blend");
             if (item) {
@@ -167,7 +167,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *targetName;
 
             IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -212,7 +212,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *name;
 
             TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -267,7 +267,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *item;
 
             PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -339,7 +339,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
             Json *attachmentsMap;
             Json *curves;
 
-            Skin *skin = new (__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
+            Skin *skin = new (__FILE__, __LINE__) Skin(intern(Json::getString(skinMap, "name", "")));
 
             Json *item = Json::getItem(skinMap, "bones");
             if (item) {
@@ -407,9 +407,9 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
 
                     for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
                         Attachment *attachment = NULL;
-                        const char *skinAttachmentName = attachmentMap->_name;
-                        const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
-                        const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
+                        String skinAttachmentName = intern(attachmentMap->_name);
+                        String attachmentName = intern(Json::getString(attachmentMap, "name", attachmentMap->_name));
+                        String attachmentPath = intern(Json::getString(attachmentMap, "path", attachmentName.buffer()));
                         const char *color;
                         Json *entry;
 
@@ -513,11 +513,11 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
                                 } else {
                                     bool inheritDeform = Json::getInt(attachmentMap, "deform", 1) ? true : false;
                                     LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
-                                                                                                 String(Json::getString(
+                                                                                                 intern(Json::getString(
                                                                                                          attachmentMap,
                                                                                                          "skin", 0)),
                                                                                                  slot->getIndex(),
-                                                                                                 String(entry->_valueString),
+                                                                                                 intern(entry->_valueString),
                                                                                                  inheritDeform);
                                     _linkedMeshes.add(linkedMesh);
                                 }
@@ -626,7 +626,7 @@ SkeletonData *JsonLoader40::readSkeleton(Json *root, SkeletonData *skeletonData)
         skeletonData->_events.ensureCapacity(events->_size);
         skeletonData->_events.setSize(events->_size, 0);
         for (eventMap = events->_child, i = 0; eventMap; eventMap = eventMap->_next, ++i) {
-            EventData *eventData = new (__FILE__, __LINE__) EventData(String(eventMap->_name));
+            EventData *eventData = new (__FILE__, __LINE__) EventData(intern(eventMap->_name));
 
             eventData->_intValue = Json::getInt(eventMap, "int", 0);
             eventData->_floatValue = Json::getFloat(eventMap, "float", 0);
@@ -738,7 +738,8 @@ Timeline *JsonLoader40::readTimeline(Json *keyMap, CurveTimeline2 *timeline, con
 }
 
 int JsonLoader40::findSlotIndex(SkeletonData *skeletonData, const String &slotName, Vector<Timeline *> timelines) {
-    int slotIndex = ContainerUtil::findIndexWithName(skeletonData->getSlots(), slotName);
+    SlotData *slotData = skeletonData->findSlot(slotName);
+    int slotIndex = slotData ? slotData->getIndex() : -1;
     if (slotIndex == -1) {
         ContainerUtil::cleanUpVectorOfPointers(timelines);
         setError(NULL, "Slot not found: ", slotName);
@@ -771,7 +772,7 @@ Animation *JsonLoader40::readAnimation(Json *root, SkeletonData *skeletonData) {
                 AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frames, slotIndex);
                 for (keyMap = timelineMap->_child, frame = 0; keyMap; keyMap = keyMap->_next, ++frame) {
                     timeline->setFrame(frame, Json::getFloat(keyMap, "time", 0),
-                                       Json::getItem(keyMap, "name")->_valueString);
+                                       intern(Json::getItem(keyMap, "name")->_valueString));
                 }
                 timelines.add(timeline);
 
@@ -907,7 +908,8 @@ Animation *JsonLoader40::readAnimation(Json *root, SkeletonData *skeletonData) {
 
     /** Bone timelines. */
     for (boneMap = bones ? bones->_child : 0; boneMap; boneMap = boneMap->_next) {
-        int boneIndex = ContainerUtil::findIndexWithName(skeletonData->_bones, boneMap->_name);
+        BoneData *timelineBone = skeletonData->findBone(boneMap->_name);
+        int boneIndex = timelineBone ? timelineBone->getIndex() : -1;
         if (boneIndex == -1) {
             ContainerUtil::cleanUpVectorOfPointers(timelines);
             setError(NULL, "Bone not found: ", boneMap->_name);
@@ -1138,7 +1140,7 @@ Animation *JsonLoader40::readAnimation(Json *root, SkeletonData *skeletonData) {
                 keyMap = timelineMap->_child;
                 if (keyMap == NULL) continue;
 
-                Attachment *baseAttachment = skin->getAttachment(slotIndex, timelineMap->_name);
+                Attachment *baseAttachment = skin->getAttachment(slotIndex, intern(timelineMap->_name));
                 if (!baseAttachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
                     setError(NULL, "Attachment not found: ", timelineMap->_name);
@@ -1274,7 +1276,7 @@ Animation *JsonLoader40::readAnimation(Json *root, SkeletonData *skeletonData) {
     float duration = 0;
     for (size_t i = 0; i < timelines.size(); i++)
         duration = MathUtil::max(duration, timelines[i]->getDuration());
-    return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
+    return new (__FILE__, __LINE__) Animation(intern(root->_name), timelines, duration);
 }
 
 void JsonLoader40::readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength) {
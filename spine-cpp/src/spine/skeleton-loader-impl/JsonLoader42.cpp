@@ -73,7 +73,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             }
         }
 
-        data = new (__FILE__, __LINE__) BoneData(bonesCount, Json::getString(boneMap, "name", 0), parent);
+        data = new (__FILE__, __LINE__) BoneData(bonesCount, intern(Json::getString(boneMap, "name", 0)), parent);
 
         data->_length = Json::getFloat(boneMap, "length", 0) * _scale;
         data->_x = Json::getFloat(boneMap, "x", 0) * _scale;
@@ -126,7 +126,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
                 return NULL;
             }
 
-            String slotName = String(Json::getString(slotMap, "name", 0));
+            String slotName = intern(Json::getString(slotMap, "name", 0));
             data = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
             color = Json::getString(slotMap, "color", 0);
@@ -149,7 +149,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             }
 
             item = Json::getItem(slotMap, "attachment");
-            if (item) data->setAttachmentName(item->_valueString);
+            if (item) data->setAttachmentName(intern(item->_valueString));
 
             item = Json::getItem(slotMap, "blend");
             if (item) {
@@ -174,7 +174,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *targetName;
 
             IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -219,7 +219,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *name;
 
             TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -274,7 +274,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *item;
 
             PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -345,7 +345,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             const char *name;
 
             PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(
-                    Json::getString(constraintMap, "name", 0));
+                    intern(Json::getString(constraintMap, "name", 0)));
             data->setOrder(Json::getInt(constraintMap, "order", 0));
             data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -394,7 +394,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
             Json *attachmentsMap;
             Json *curves;
 
-            Skin *skin = new (__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
+            Skin *skin = new (__FILE__, __LINE__) Skin(intern(Json::getString(skinMap, "name", "")));
 
             Json *item = Json::getItem(skinMap, "bones");
             if (item) {
@@ -475,9 +475,9 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
 
                     for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
                         Attachment *attachment = NULL;
-                        const char *skinAttachmentName = attachmentMap->_name;
-                        const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
-                        const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
+                        String skinAttachmentName = intern(attachmentMap->_name);
+                        String attachmentName = intern(Json::getString(attachmentMap, "name", attachmentMap->_name));
+                        String attachmentPath = intern(Json::getString(attachmentMap, "path", attachmentName.buffer()));
                         const char *color;
                         Json *entry;
 
@@ -585,11 +585,11 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
                                 } else {
                                     bool inheritTimelines = Json::getInt(attachmentMap, "timelines", 1) ? true : false;
                                     LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
-                                                                                                 String(Json::getString(
+                                                                                                 intern(Json::getString(
                                                                                                          attachmentMap,
                                                                                                          "skin", 0)),
                                                                                                  slot->getIndex(),
-                                                                                                 String(entry->_valueString),
+                                                                                                 intern(entry->_valueString),
                                                                                                  inheritTimelines);
                                     _linkedMeshes.add(linkedMesh);
                                 }
@@ -698,7 +698,7 @@ SkeletonData *JsonLoader42::readSkeleton(Json *root, SkeletonData *skeletonData)
         skeletonData->_events.ensureCapacity(events->_size);
         skeletonData->_events.setSize(events->_size, 0);
         for (eventMap = events->_child, i = 0; eventMap; eventMap = eventMap->_next, ++i) {
-            EventData *eventData = new (__FILE__, __LINE__) EventData(String(eventMap->_name));
+            EventData *eventData = new (__FILE__, __LINE__) EventData(intern(eventMap->_name));
 
             eventData->_intValue = Json::getInt(eventMap, "int", 0);
             eventData->_floatValue = Json::getFloat(eventMap, "float", 0);
@@ -819,7 +819,8 @@ Timeline *JsonLoader42::readTimeline(Json *keyMap, CurveTimeline2 *timeline, con
 }
 
 int JsonLoader42::findSlotIndex(SkeletonData *skeletonData, const String &slotName, Vector<Timeline *> timelines) {
-    int slotIndex = ContainerUtil::findIndexWithName(skeletonData->getSlots(), slotName);
+    SlotData *slotData = skeletonData->findSlot(slotName);
+    int slotIndex = slotData ? slotData->getIndex() : -1;
     if (slotIndex == -1) {
         ContainerUtil::cleanUpVectorOfPointers(timelines);
         setError(NULL, "Slot not found: ", slotName);
@@ -853,7 +854,7 @@ Animation *JsonLoader42::readAnimation(Json *root, SkeletonData *skeletonData) {
                 AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frames, slotIndex);
                 for (keyMap = timelineMap->_child, frame = 0; keyMap; keyMap = keyMap->_next, ++frame) {
                     timeline->setFrame(frame, Json::getFloat(keyMap, "time", 0),
-                                       Json::getItem(keyMap, "name") ? Json::getItem(keyMap, "name")->_valueString : NULL);
+                                       intern(Json::getItem(keyMap, "name") ? Json::getItem(keyMap, "name")->_valueString : NULL));
                 }
                 timelines.add(timeline);
 
@@ -989,7 +990,8 @@ Animation *JsonLoader42::readAnimation(Json *root, SkeletonData *skeletonData) {
 
     /** Bone timelines. */
     for (boneMap = bones ? bones->_child : 0; boneMap; boneMap = boneMap->_next) {
-        int boneIndex = ContainerUtil::findIndexWithName(skeletonData->_bones, boneMap->_name);
+        BoneData *timelineBone = skeletonData->findBone(boneMap->_name);
+        int boneIndex = timelineBone ? timelineBone->getIndex() : -1;
         if (boneIndex == -1) {
             ContainerUtil::cleanUpVectorOfPointers(timelines);
             setError(NULL, "Bone not found: ", boneMap->_name);
@@ -1287,7 +1289,7 @@ Animation *JsonLoader42::readAnimation(Json *root, SkeletonData *skeletonData) {
             if (slotIndex == -1) return NULL;
 
             for (Json *attachmentMap = slotMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
-                Attachment *attachment = skin->getAttachment(slotIndex, attachmentMap->_name);
+                Attachment *attachment = skin->getAttachment(slotIndex, intern(attachmentMap->_name));
                 if (!attachment) {
                     ContainerUtil::cleanUpVectorOfPointers(timelines);
                     setError(NULL, "Attachment not found: ", attachmentMap->_name);
@@ -1449,7 +1451,7 @@ Animation *JsonLoader42::readAnimation(Json *root, SkeletonData *skeletonData) {
     float duration = 0;
     for (size_t i = 0; i < timelines.size(); i++)
         duration = MathUtil::max(duration, timelines[i]->getDuration());
-    return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
+    return new (__FILE__, __LINE__) Animation(intern(root->_name), timelines, duration);
 }
 
 void JsonLoader42::readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength) {
@@ -0,0 +1,203 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Regression checks for runtime behavior that has no exported files to test it with. The skeletons are built in code.
+// Pass a test name to run only that test. Exits with 1 if any check failed.
+
+#include <spine/spine.h>
+
+#include <atomic>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+namespace {
+	int failures = 0;
+
+	void check(bool condition, const char *message, float time) {
+		if (condition) return;
+		printf("  FAILED at %.2f: %s\n", time, message);
+		failures++;
+	}
+
+	bool equals(float a, float b) {
+		return fabsf(a - b) < 0.0001f;
+	}
+
+	/// Compares the world transforms of two instances of the same skeleton.
+	bool sameWorldTransforms(Skeleton &a, Skeleton &b) {
+		for (size_t i = 0, n = a.getBones().size(); i < n; i++) {
+			Bone *boneA = a.getBones()[i], *boneB = b.getBones()[i];
+			if (!equals(boneA->getA(), boneB->getA()) || !equals(boneA->getB(), boneB->getB()) ||
+				!equals(boneA->getC(), boneB->getC()) || !equals(boneA->getD(), boneB->getD()) ||
+				!equals(boneA->getWorldX(), boneB->getWorldX()) || !equals(boneA->getWorldY(), boneB->getWorldY()))
+				return false;
+		}
+		return true;
+	}
+
+	/// A bone whose inherit mode is keyed, with no transform keyed, must be recomputed by incremental updates.
+	void testIncrementalInherit() {
+		SkeletonData *data = new SkeletonData();
+		BoneData *root = new BoneData(0, "root");
+		root->setRotation(45);
+		data->getBones().add(root);
+		BoneData *boneData = new BoneData(1, "bone", root);
+		boneData->setX(10);
+		boneData->setRotation(10);
+		data->getBones().add(boneData);
+		data->getBones().add(new BoneData(2, "child", boneData));
+
+		InheritTimeline *timeline = new InheritTimeline(2, 1);
+		timeline->setFrame(0, 0, Inherit_Normal);
+		timeline->setFrame(1, 1, Inherit_NoRotationOrReflection);
+		Vector<Timeline *> timelines;
+		timelines.add(timeline);
+		Animation *animation = new Animation("inherit", timelines, 2);
+		data->getAnimations().add(animation);
+		data->buildIndices();
+
+		Skeleton full(data), incremental(data);
+		incremental.setIncrementalUpdate(true);
+		for (int frame = 0; frame <= 10; frame++) {
+			float lastTime = (frame - 1) * 0.2f, time = frame * 0.2f;
+			animation->apply(full, lastTime, time, false, NULL, 1, MixBlend_Replace, MixDirection_In);
+			animation->apply(incremental, lastTime, time, false, NULL, 1, MixBlend_Replace, MixDirection_In);
+			full.updateWorldTransform(Physics_None);
+			incremental.updateWorldTransform(Physics_None);
+			check(sameWorldTransforms(full, incremental), "incremental world transforms differ from a full update", time);
+			float expected = time < 1 ? cosf(55 * MathUtil::Deg_Rad) : cosf(10 * MathUtil::Deg_Rad);
+			check(equals(incremental.findBone("bone")->getA(), expected), "bone world rotation ignores inherit", time);
+		}
+		delete data;
+	}
+
+	/// Skeletons updated by a SkeletonBatch on a ThreadPool use the RuntimeContext current when update is called.
+	void testBatchContext() {
+		SkeletonData *data = new SkeletonData();
+		BoneData *root = new BoneData(0, "root");
+		root->setRotation(30);
+		data->getBones().add(root);
+		data->buildIndices();
+		AnimationStateData stateData(data);
+
+		RuntimeContext context(NULL, true);
+		{
+			RuntimeContextScope scope(&context);
+			Skeleton serial(data);
+			serial.updateWorldTransform(Physics_None);
+
+			ThreadPool pool(2);
+			SkeletonBatch batch(&pool);
+			batch.setGrainSize(1);
+			for (int i = 0; i < 8; i++) batch.add(data, &stateData);
+			batch.update(0, Physics_None);
+			for (size_t i = 0; i < batch.size(); i++)
+				check(sameWorldTransforms(serial, *batch.getSkeleton(i)), "batch skeleton ignores the current context", 0);
+			batch.clear();
+		}
+		delete data;
+	}
+
+	/// Finds items indexed by NameIndex, items in slots filled after a build, and items appended after a build.
+	void testNameIndex() {
+		Vector<EventData *> events;
+		events.setSize(4, NULL);
+		events[0] = new EventData("a");
+		events[1] = new EventData("b");
+		NameIndex index;
+		index.build(events);
+		check(index.find(events, "b") == events[1], "indexed item not found", 0);
+		check(index.find(events, "c") == NULL, "missing item found", 0);
+		events[2] = new EventData("c");
+		events[3] = new EventData("d");
+		check(index.find(events, "c") == events[2], "item filled in after a build not found", 0);
+		events.add(new EventData("e"));
+		check(index.find(events, "e") == events[4], "item appended after a build not found", 0);
+		index.build(events);
+		for (size_t i = 0; i < events.size(); i++)
+			check(index.find(events, events[i]->getName()) == events[i], "item not found after rebuilding", 0);
+		check(index.find(events, "f") == NULL, "missing item found after rebuilding", 0);
+		ContainerUtil::cleanUpVectorOfPointers(events);
+	}
+
+	struct NestedBatch {
+		ThreadPool *pool;
+		std::atomic<int> count;
+	};
+
+	void countTask(void *context, int index) {
+		SP_UNUSED(index);
+		((NestedBatch *) context)->count++;
+	}
+
+	void nestedTask(void *context, int index) {
+		SP_UNUSED(index);
+		((NestedBatch *) context)->pool->run(countTask, context, 4);
+	}
+
+	/// A task running on a ThreadPool can run a batch on the same pool.
+	void testNestedThreadPool() {
+		ThreadPool pool(2);
+		NestedBatch batch;
+		batch.pool = &pool;
+		batch.count = 0;
+		pool.run(nestedTask, &batch, 8);
+		check(batch.count == 32, "nested batch did not run every task", 0);
+	}
+
+	struct Test {
+		const char *name;
+		void (*run)();
+	};
+
+	const Test tests[] = {
+			{"incremental-inherit", testIncrementalInherit},
+			{"batch-context", testBatchContext},
+			{"name-index", testNameIndex},
+			{"nested-thread-pool", testNestedThreadPool},
+	};
+}
+
+int main(int argc, char **argv) {
+	const char *filter = argc > 1 ? argv[1] : NULL;
+	for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+		if (filter && strcmp(filter, tests[i].name) != 0) continue;
+		printf("%s\n", tests[i].name);
+		tests[i].run();
+	}
+	printf(failures ? "%d checks failed\n" : "all checks passed\n", failures);
+	return failures ? 1 : 0;
+}